@@ -0,0 +1,53 @@
+/*---  Bench.h - Minimal micro-benchmark harness  ------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Registers benchmark functions and times them with sge::Clock.
+ *
+ * A benchmark body receives an iteration count and must run its kernel that
+ * many times. The runner grows the count until a run takes long enough to
+ * time reliably, then reports nanoseconds per iteration.
+ */
+#ifndef __SGE_BENCH_H
+#define __SGE_BENCH_H
+
+#include "lib.h"
+
+namespace bench {
+
+typedef void (*BenchFn) (u64 iterations);
+
+/** Adds a benchmark to the global list at static initialisation time. */
+struct Registrar {
+    Registrar (const char *group, const char *name, BenchFn fn);
+};
+
+/** Stop the optimiser from discarding a value. */
+template <typename T>
+inline void keep (T &&value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/** Stop the optimiser from assuming it knows the contents of memory. */
+inline void clobber () {
+    asm volatile("" : : : "memory");
+}
+
+} /* namespace bench */
+
+/**
+ * Define a benchmark. Benchmarks in the same group are reported together,
+ * so scalar/SIMD variants of a kernel should share a group.
+ */
+#define BENCHMARK(group, name)                                            \
+    static void group##_##name (u64 iterations);                          \
+    static bench::Registrar group##_##name##_registrar(#group, #name,     \
+                                                       group##_##name);   \
+    static void group##_##name (u64 iterations)
+
+#endif /* __SGE_BENCH_H */
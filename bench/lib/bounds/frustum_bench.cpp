@@ -0,0 +1,86 @@
+//
+// Frustum culling benchmarks: per-object tests vs batch SoA culling.
+//
+#include "../../bench.h"
+
+#include <vector>
+
+using sge::Frustum;
+using sge::Sphere;
+using sge::SphereArray;
+using sge::Aabb;
+using sge::AabbArray;
+
+static constexpr u32 kObjects = 32768;
+
+// 60 degree fov camera at the origin, looking down -z. Objects are
+// spread all around it, so most are culled.
+static Frustum camera () {
+    const float n = 0.1f;
+    const float f = 200.0f;
+    const float s = 1.0f / tanf(math::rad(30.0f));
+    return Frustum(Mat4f(s, 0.0f, 0.0f, 0.0f,
+                         0.0f, s, 0.0f, 0.0f,
+                         0.0f, 0.0f, -(f + n) / (f - n), -1.0f,
+                         0.0f, 0.0f, -(2.0f * f * n) / (f - n), 0.0f));
+}
+
+// Clusters of 8 nearby objects, as a spatially sorted scene would give.
+static std::vector<Sphere> randomSpheres () {
+    sge::Random r(1);
+    std::vector<Sphere> v;
+    for (u32 k = 0; k < kObjects; k += 8) {
+        const Vec3f c = Vec3f(r.nextFloat(-250.0f, 250.0f), r.nextFloat(-20.0f, 20.0f), r.nextFloat(-250.0f, 250.0f));
+        for (u32 i = 0; i < 8; ++i) {
+            v.emplace_back(c + Vec3f(r.nextFloat(-4.0f, 4.0f), r.nextFloat(-4.0f, 4.0f), r.nextFloat(-4.0f, 4.0f)),
+                           r.nextFloat(0.5f, 3.0f));
+        }
+    }
+    return v;
+}
+
+// One iteration culls every object.
+#define CULL_BENCH(setup, body)                           \
+    static const Frustum f = camera();                    \
+    setup;                                                \
+    static std::vector<u64> visible((kObjects + 63) / 64); \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        body;                                             \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(visible[0])
+
+BENCHMARK (Frustum_Spheres_32K, scalar) {
+    CULL_BENCH(static const std::vector<Sphere> s = randomSpheres(),
+               for (u32 i = 0; i < kObjects; i += 64) {
+                   u64 bits = 0;
+                   for (u32 j = 0; j < 64; ++j) {
+                       bits |= static_cast<u64>(intersects(f, s[i + j])) << j;
+                   }
+                   visible[i / 64] = bits;
+               });
+}
+
+static SphereArray sphereArray () {
+    SphereArray a;
+    for (const Sphere &s : randomSpheres()) {
+        a.add(s);
+    }
+    return a;
+}
+
+BENCHMARK (Frustum_Spheres_32K, batch) {
+    CULL_BENCH(static SphereArray s = sphereArray(), f.cull(s, visible));
+}
+
+static AabbArray aabbArray () {
+    AabbArray a;
+    for (const Sphere &s : randomSpheres()) {
+        a.add(Aabb(s.center - Vec3f(s.radius), s.center + Vec3f(s.radius)));
+    }
+    return a;
+}
+
+BENCHMARK (Frustum_Aabbs_32K, batch) {
+    CULL_BENCH(static AabbArray b = aabbArray(), f.cull(b, visible));
+}
@@ -0,0 +1,144 @@
+//
+// Mesh benchmarks: hashed vertex weld of a 512 x 512 quad grid, which
+// starts with every inner corner repeated four times, and triangle and
+// vertex reordering.
+//
+#include "../../bench.h"
+#include "../../../test/lib/geom/meshfixtures.h"
+
+using sge::Mesh;
+using sge::Vertex;
+
+static const Mesh kGrid = fixture::quadGrid(512, 512);
+
+// One iteration welds a fresh copy of the grid.
+#define SIMPLIFY_BENCH(epsilon, threaded)                 \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        Mesh m = kGrid;                                   \
+        m.simplify(epsilon, threaded);                    \
+        bench::keep(m.vertices[0]);                       \
+    }
+
+BENCHMARK (Mesh_Simplify_1M, exact)          { SIMPLIFY_BENCH(0.0f, false); }
+BENCHMARK (Mesh_Simplify_1M, epsilon)        { SIMPLIFY_BENCH(1e-4f, false); }
+BENCHMARK (Mesh_Simplify_1M, exact_threaded) { SIMPLIFY_BENCH(0.0f, true); }
+
+static Mesh weldedGrid (const u32 size) {
+    Mesh m = fixture::quadGrid(size, size);
+    m.simplify();
+    return m;
+}
+
+static const Mesh kWelded = weldedGrid(256);
+
+// One iteration reorders a fresh copy of a welded 256 x 256 quad grid.
+#define OPTIMIZE_BENCH(body)                              \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        Mesh m = kWelded;                                 \
+        body;                                             \
+        bench::keep(m.indices[0]);                        \
+    }
+
+BENCHMARK (Mesh_Optimize_128K, vertex_cache) { OPTIMIZE_BENCH(sge::optimizeVertexCache(m.indices, m.vertCount())); }
+BENCHMARK (Mesh_Optimize_128K, overdraw)     { OPTIMIZE_BENCH(sge::optimizeOverdraw(m.indices, m.positions())); }
+BENCHMARK (Mesh_Optimize_128K, all)          { OPTIMIZE_BENCH(m.optimize()); }
+
+static const Mesh kWeldedLarge = weldedGrid(512);
+
+// One iteration decimates a welded 512 x 512 quad grid, bent into a
+// bowl so collapses have a cost.
+static Mesh bowl () {
+    Mesh m = kWeldedLarge;
+    for (Vertex &v : m.vertices) {
+        const float x = v.position.x / 256.0f - 1.0f;
+        const float y = v.position.y / 256.0f - 1.0f;
+        v.position.z = (x * x + y * y) * 64.0f;
+    }
+    return m;
+}
+
+static const Mesh kBowl = bowl();
+
+BENCHMARK (Mesh_Decimate_512K, half)      { for (u64 k = 0; k < iterations; ++k) { bench::keep(sge::decimate(kBowl, 0.5f).error); } }
+BENCHMARK (Mesh_Decimate_512K, lod_chain) { for (u64 k = 0; k < iterations; ++k) { bench::keep(sge::buildLodChain(kBowl, {0.5f, 0.25f, 0.125f, 0.0625f}).back().error); } }
+
+// Meshlets of the bowl, culled from above its rim looking across it.
+static const sge::MeshletMesh kBowlMeshlets(kBowl);
+
+BENCHMARK (Mesh_Meshlets_512K, build) { for (u64 k = 0; k < iterations; ++k) { bench::keep(sge::MeshletMesh(kBowl).meshletCount()); } }
+BENCHMARK (Mesh_Meshlets_512K, cull) {
+    static sge::MeshletMesh mm = kBowlMeshlets;
+    static std::vector<u32> indices;
+    const float n = 1.0f;
+    const float f = 1000.0f;
+    const Mat4f projection(1.0f, 0.0f, 0.0f, 0.0f,
+                           0.0f, 1.0f, 0.0f, 0.0f,
+                           0.0f, 0.0f, -(f + n) / (f - n), -1.0f,
+                           0.0f, 0.0f, -(2.0f * f * n) / (f - n), 0.0f);
+    const Mat4f view(1.0f, 0.0f, 0.0f, 0.0f,
+                     0.0f, 1.0f, 0.0f, 0.0f,
+                     0.0f, 0.0f, 1.0f, 0.0f,
+                     -128.0f, -256.0f, -200.0f, 1.0f);
+    const sge::Frustum frustum(projection * view);
+    for (u64 k = 0; k < iterations; ++k) {
+        bench::keep(mm.cull(frustum, Vec3f(128.0f, 256.0f, 200.0f), indices));
+    }
+}
+
+// Bounds of the bowl's positions, interleaved and as a separate stream.
+static const sge::MeshSoA kBowlSoA(kBowl);
+
+BENCHMARK (Mesh_Bounds_256K, interleaved) {
+    for (u64 k = 0; k < iterations; ++k) {
+        sge::Aabb box;
+        for (const Vertex &v : kBowl.vertices) {
+            box.addPoint(v.position);
+        }
+        bench::keep(box);
+    }
+}
+BENCHMARK (Mesh_Bounds_256K, soa) { for (u64 k = 0; k < iterations; ++k) { bench::keep(kBowlSoA.bounds()); } }
+
+// Packing the indices of an optimised 200 x 200 quad grid, which has few
+// enough vertices for 16 bit indices, as a list and as strips.
+static Mesh optimizedGrid (const u32 size) {
+    Mesh m = weldedGrid(size);
+    m.optimize();
+    return m;
+}
+
+static const Mesh kOptimized = optimizedGrid(200);
+
+BENCHMARK (Mesh_Indices_80K, list16) {
+    for (u64 k = 0; k < iterations; ++k) {
+        bench::keep(sge::IndexBuffer(kOptimized.indices, kOptimized.vertCount()).size());
+    }
+}
+BENCHMARK (Mesh_Indices_80K, strip16) {
+    for (u64 k = 0; k < iterations; ++k) {
+        bench::keep(sge::IndexBuffer(kOptimized.indices, kOptimized.vertCount(), sge::kTriangleStrip).size());
+    }
+}
+
+// Normals of the 256K vertex bowl, generated from scratch and updated in
+// place with a prebuilt corner table as for a deforming mesh.
+static const sge::CornerTable kBowlCorners(kBowl);
+
+#define NORMALS_BENCH(body)                               \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        Mesh m = kBowl;                                   \
+        body;                                             \
+        bench::keep(m.vertices[0].normal);                \
+    }
+
+BENCHMARK (Mesh_Normals_256K, generate)        { NORMALS_BENCH(m.generateNormals(math::kPi)); }
+BENCHMARK (Mesh_Normals_256K, update)          { NORMALS_BENCH(sge::updateNormals(m, kBowlCorners, math::kPi)); }
+BENCHMARK (Mesh_Normals_256K, update_threaded) { NORMALS_BENCH(sge::updateNormals(m, kBowlCorners, math::kPi, true)); }
+BENCHMARK (Mesh_Normals_256K, tangents)        { for (u64 k = 0; k < iterations; ++k) { bench::keep(kBowl.generateTangents()[0]); } }
+
+// Building a subdivided sphere of 81920 faces.
+BENCHMARK (Mesh_ICOSphere_80K, level6) {
+    for (u64 k = 0; k < iterations; ++k) {
+        bench::keep(sge::ICOSphere(Vec3f_Zero, 1.0f, 6).toMesh().vertCount());
+    }
+}
@@ -0,0 +1,57 @@
+//
+// Wavefront .obj benchmarks: parsing a 256 x 256 quad grid with texture
+// coordinates and normals, about 10MB of text, serially and split into a
+// chunk per worker, and building its indexed mesh.
+//
+#include "../../bench.h"
+
+#include <cstdio>
+#include <string>
+
+static constexpr u32 kGridSize = 256;
+
+static std::string gridText () {
+    std::string text = "o grid\n";
+    char line[128];
+    sge::Random r(1);
+    for (u32 y = 0; y <= kGridSize; ++y) {
+        for (u32 x = 0; x <= kGridSize; ++x) {
+            snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn %.6f %.6f %.6f\n",
+                     static_cast<float>(x), static_cast<float>(y), r.nextFloat(),
+                     static_cast<float>(x) / kGridSize, static_cast<float>(y) / kGridSize,
+                     r.nextFloat(), r.nextFloat(), 1.0f);
+            text += line;
+        }
+    }
+    text += "g grid\n";
+    for (u32 y = 0; y < kGridSize; ++y) {
+        for (u32 x = 0; x < kGridSize; ++x) {
+            const u32 v = y * (kGridSize + 1) + x + 1;
+            const u32 w = v + kGridSize + 1;
+            snprintf(line, sizeof(line), "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n",
+                     v, v, v, v + 1, v + 1, v + 1, w + 1, w + 1, w + 1, w, w, w);
+            text += line;
+        }
+    }
+    return text;
+}
+
+static const std::string kText = gridText();
+
+static void parseBench (const u64 iterations, const size_t chunks) {
+    for (u64 k = 0; k < iterations; ++k) {
+        const sge::ObjDocument doc(kText.data(), kText.data() + kText.size(), chunks);
+        bench::keep(doc.groups[0].positionIndex[0]);
+    }
+}
+
+BENCHMARK (Obj_Parse_10MB, serial)  { parseBench(iterations, 1); }
+BENCHMARK (Obj_Parse_10MB, chunked) { parseBench(iterations, sge::workerCount()); }
+
+static const sge::ObjDocument kDoc(kText.data(), kText.data() + kText.size(), 1);
+
+BENCHMARK (Obj_Mesh_66K, index_triples) {
+    for (u64 k = 0; k < iterations; ++k) {
+        bench::keep(sge::meshFromObjDocument(kDoc).indices[0]);
+    }
+}
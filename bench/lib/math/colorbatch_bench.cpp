@@ -0,0 +1,71 @@
+//
+// Batch color benchmarks: scalar Color conversions in a loop vs batch
+// kernels, over 4096 pixels.
+//
+#include "../../bench.h"
+
+#include <vector>
+
+static constexpr u32 kPixels = 4096;
+
+static std::vector<Color> randomColors () {
+    sge::Random r(1);
+    std::vector<Color> c;
+    for (u32 k = 0; k < kPixels; ++k) {
+        c.emplace_back(static_cast<u32>(r.nextInt()));
+    }
+    return c;
+}
+
+template <typename T, typename F>
+static std::vector<T> convert (const std::vector<Color> &c, F f) {
+    std::vector<T> v;
+    for (const Color &x : c) {
+        v.push_back(f(x));
+    }
+    return v;
+}
+
+static const std::vector<Color> kColors = randomColors();
+static const std::vector<u32> kPacked = convert<u32>(kColors, [](const Color &c) { return c.toU32(); });
+static const std::vector<Vec3f> kHSL = convert<Vec3f>(kColors, [](const Color &c) { return c.toHSL(); });
+static const std::vector<Vec4f> kLinear = convert<Vec4f>(kColors, [](const Color &c) { return c.toLinear(); });
+
+// One iteration converts every pixel of src into dst, which starts as a
+// copy of init.
+#define COLOR_SCALAR_BENCH(init, src, expr)               \
+    static auto dst = init;                               \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        for (u32 i = 0; i < kPixels; ++i) {               \
+            const auto &x = src[i];                       \
+            dst[i] = (expr);                              \
+        }                                                 \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(dst[0])
+
+#define COLOR_BATCH_BENCH(init, src, fn)                  \
+    static auto dst = init;                               \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        fn(src, dst);                                     \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(dst[0])
+
+BENCHMARK (Color_Unpack_4K, scalar) { COLOR_SCALAR_BENCH(kColors, kPacked, Color(x)); }
+BENCHMARK (Color_Unpack_4K, batch)  { COLOR_BATCH_BENCH(kColors, kPacked, unpackColors); }
+
+BENCHMARK (Color_ToVec4f_4K, scalar) { COLOR_SCALAR_BENCH(kLinear, kColors, x.toVec4f(true)); }
+BENCHMARK (Color_ToVec4f_4K, batch)  { COLOR_BATCH_BENCH(kLinear, kColors, colorsToVec4f); }
+
+BENCHMARK (Color_FromHSL_4K, scalar) { COLOR_SCALAR_BENCH(kColors, kHSL, Color::fromHSL(x.x, x.y, x.z)); }
+BENCHMARK (Color_FromHSL_4K, batch)  { COLOR_BATCH_BENCH(kColors, kHSL, colorsFromHSL); }
+
+BENCHMARK (Color_ToHSL_4K, scalar) { COLOR_SCALAR_BENCH(kHSL, kColors, x.toHSL()); }
+BENCHMARK (Color_ToHSL_4K, batch)  { COLOR_BATCH_BENCH(kHSL, kColors, colorsToHSL); }
+
+BENCHMARK (Color_ToLinear_4K, scalar) { COLOR_SCALAR_BENCH(kLinear, kColors, x.toLinear()); }
+BENCHMARK (Color_ToLinear_4K, batch)  { COLOR_BATCH_BENCH(kLinear, kColors, colorsToLinear); }
+
+BENCHMARK (Color_FromLinear_4K, scalar) { COLOR_SCALAR_BENCH(kColors, kLinear, Color::fromLinear(x)); }
+BENCHMARK (Color_FromLinear_4K, batch)  { COLOR_BATCH_BENCH(kColors, kLinear, colorsFromLinear); }
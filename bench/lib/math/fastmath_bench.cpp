@@ -0,0 +1,64 @@
+//
+// math::fast benchmarks: <cmath> vs the approximations, one float at a
+// time and 8 at a time, over 4096 values.
+//
+#include "../../bench.h"
+
+#include <cmath>
+#include <vector>
+
+using math::fast::kLow;
+using math::fast::kHigh;
+
+static constexpr u32 kValues = 4096;
+
+static std::vector<float> randomValues (const float lo, const float hi) {
+    sge::Random r(1);
+    std::vector<float> v;
+    for (u32 k = 0; k < kValues; ++k) {
+        v.push_back(r.nextFloat(lo, hi));
+    }
+    return v;
+}
+
+// One iteration maps every value of src through a function into dst.
+#define FASTMATH_BENCH(lo, hi, body)                                    \
+    static const std::vector<float> src = randomValues(lo, hi);         \
+    static std::vector<float> dst(kValues);                             \
+    for (u64 k = 0; k < iterations; ++k) {                              \
+        body;                                                           \
+        bench::clobber();                                               \
+    }                                                                   \
+    bench::keep(dst[0])
+
+#define EACH_FLOAT(expr)                                                \
+    for (u32 i = 0; i < kValues; ++i) {                                 \
+        const float x = src[i];                                         \
+        dst[i] = (expr);                                                \
+    }
+
+#define EACH_FLOATX8(expr)                                              \
+    for (u32 i = 0; i < kValues; i += 8) {                              \
+        const Floatx8 x = Floatx8::load(&src[i]);                       \
+        (expr).store(&dst[i]);                                          \
+    }
+
+BENCHMARK (FastMath_Sin_4K, std)     { FASTMATH_BENCH(-100.0f, 100.0f, EACH_FLOAT(std::sin(x))); }
+BENCHMARK (FastMath_Sin_4K, high)    { FASTMATH_BENCH(-100.0f, 100.0f, EACH_FLOAT(math::fast::sin<kHigh>(x))); }
+BENCHMARK (FastMath_Sin_4K, low)     { FASTMATH_BENCH(-100.0f, 100.0f, EACH_FLOAT(math::fast::sin<kLow>(x))); }
+BENCHMARK (FastMath_Sin_4K, high_x8) { FASTMATH_BENCH(-100.0f, 100.0f, EACH_FLOATX8(math::fast::sin<kHigh>(x))); }
+BENCHMARK (FastMath_Sin_4K, low_x8)  { FASTMATH_BENCH(-100.0f, 100.0f, EACH_FLOATX8(math::fast::sin<kLow>(x))); }
+
+BENCHMARK (FastMath_Atan2_4K, std)     { FASTMATH_BENCH(-10.0f, 10.0f, EACH_FLOAT(std::atan2(x, 1.5f))); }
+BENCHMARK (FastMath_Atan2_4K, high)    { FASTMATH_BENCH(-10.0f, 10.0f, EACH_FLOAT(math::fast::atan2<kHigh>(x, 1.5f))); }
+BENCHMARK (FastMath_Atan2_4K, high_x8) { FASTMATH_BENCH(-10.0f, 10.0f, EACH_FLOATX8(math::fast::atan2<kHigh>(x, Floatx8(1.5f)))); }
+
+BENCHMARK (FastMath_Pow_4K, std)     { FASTMATH_BENCH(0.01f, 10.0f, EACH_FLOAT(std::pow(x, 2.2f))); }
+BENCHMARK (FastMath_Pow_4K, high)    { FASTMATH_BENCH(0.01f, 10.0f, EACH_FLOAT(math::fast::pow<kHigh>(x, 2.2f))); }
+BENCHMARK (FastMath_Pow_4K, high_x8) { FASTMATH_BENCH(0.01f, 10.0f, EACH_FLOATX8(math::fast::pow<kHigh>(x, Floatx8(2.2f)))); }
+BENCHMARK (FastMath_Pow_4K, low_x8)  { FASTMATH_BENCH(0.01f, 10.0f, EACH_FLOATX8(math::fast::pow<kLow>(x, Floatx8(2.2f)))); }
+
+BENCHMARK (FastMath_Rsqrt_4K, std)     { FASTMATH_BENCH(0.01f, 100.0f, EACH_FLOAT(1.0f / std::sqrt(x))); }
+BENCHMARK (FastMath_Rsqrt_4K, high)    { FASTMATH_BENCH(0.01f, 100.0f, EACH_FLOAT(math::fast::rsqrt<kHigh>(x))); }
+BENCHMARK (FastMath_Rsqrt_4K, low_x8)  { FASTMATH_BENCH(0.01f, 100.0f, EACH_FLOATX8(math::fast::rsqrt<kLow>(x))); }
+BENCHMARK (FastMath_Rsqrt_4K, std_x8)  { FASTMATH_BENCH(0.01f, 100.0f, EACH_FLOATX8(Floatx8(1.0f) / sqrt(x))); }
@@ -0,0 +1,133 @@
+//
+// Matrix multiplication benchmarks: scalar reference vs SIMD backend.
+//
+#include "../../bench.h"
+
+#include <vector>
+
+static constexpr u32 kCount = 256; // Working set stays in L1.
+
+template <typename M>
+static std::vector<M> randomMatrices (const s64 seed);
+
+template <>
+std::vector<Mat2f> randomMatrices<Mat2f> (const s64 seed) {
+    sge::Random r(seed);
+    std::vector<Mat2f> v;
+    for (u32 k = 0; k < kCount; ++k) {
+        v.emplace_back(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f),
+                       r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f));
+    }
+    return v;
+}
+
+template <>
+std::vector<Mat3f> randomMatrices<Mat3f> (const s64 seed) {
+    sge::Random r(seed);
+    std::vector<Mat3f> v(kCount);
+    for (auto &m : v) {
+        for (int c = 0; c < 3; ++c) {
+            m[c] = Vec3f(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f));
+        }
+    }
+    return v;
+}
+
+template <>
+std::vector<Mat4f> randomMatrices<Mat4f> (const s64 seed) {
+    sge::Random r(seed);
+    std::vector<Mat4f> v(kCount);
+    for (auto &m : v) {
+        for (int c = 0; c < 4; ++c) {
+            m[c] = Vec4f(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f),
+                         r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f));
+        }
+    }
+    return v;
+}
+
+// One iteration is one matrix product. Products stream over a small array
+// of independent inputs, as a per-entity transform loop would.
+#define MATRIX_MUL_BENCH(M, expr)                         \
+    static std::vector<M> a = randomMatrices<M>(1);       \
+    static std::vector<M> b = randomMatrices<M>(2);       \
+    static std::vector<M> out(kCount);                    \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        const u32 i = k % kCount;                         \
+        out[i] = (expr);                                  \
+        if (i == kCount - 1) {                            \
+            bench::clobber();                             \
+        }                                                 \
+    }                                                     \
+    bench::keep(out[0])
+
+BENCHMARK (Mat2f_Multiply, scalar) { MATRIX_MUL_BENCH(Mat2f, mulScalar(a[i], b[i])); }
+BENCHMARK (Mat2f_Multiply, simd)   { MATRIX_MUL_BENCH(Mat2f, a[i] * b[i]); }
+
+BENCHMARK (Mat3f_Multiply, scalar) { MATRIX_MUL_BENCH(Mat3f, mulScalar(a[i], b[i])); }
+BENCHMARK (Mat3f_Multiply, simd)   { MATRIX_MUL_BENCH(Mat3f, a[i] * b[i]); }
+
+BENCHMARK (Mat4f_Multiply, scalar) { MATRIX_MUL_BENCH(Mat4f, mulScalar(a[i], b[i])); }
+BENCHMARK (Mat4f_Multiply, simd)   { MATRIX_MUL_BENCH(Mat4f, a[i] * b[i]); }
+
+static std::vector<Vec4f> randomPoints () {
+    sge::Random r(4);
+    std::vector<Vec4f> v;
+    for (u32 k = 0; k < kCount; ++k) {
+        v.emplace_back(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), 1.0f);
+    }
+    return v;
+}
+
+#define MATRIX_VEC_BENCH(expr)                            \
+    static std::vector<Mat4f> m = randomMatrices<Mat4f>(3); \
+    static std::vector<Vec4f> v = randomPoints();         \
+    static std::vector<Vec4f> out(kCount);                \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        const u32 i = k % kCount;                         \
+        out[i] = (expr);                                  \
+        if (i == kCount - 1) {                            \
+            bench::clobber();                             \
+        }                                                 \
+    }                                                     \
+    bench::keep(out[0])
+
+BENCHMARK (Mat4f_Vec4f_Multiply, scalar) { MATRIX_VEC_BENCH(mulScalar(m[i], v[i])); }
+BENCHMARK (Mat4f_Vec4f_Multiply, simd)   { MATRIX_VEC_BENCH(m[i] * v[i]); }
+
+// Rotation, per-axis scale and translation, as built by Transform.
+static std::vector<Mat4f> randomTransforms () {
+    sge::Random r(5);
+    std::vector<Mat4f> v;
+    for (u32 k = 0; k < kCount; ++k) {
+        Transform t;
+        t.setPosition(Vec3f(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f)));
+        t.setOrientation(Quat4f(r.nextFloat(-3.0f, 3.0f), Vec3f(0.0f, 0.6f, 0.8f)));
+        t.setScale(Vec3f(r.nextFloat(0.5f, 2.0f), r.nextFloat(0.5f, 2.0f), r.nextFloat(0.5f, 2.0f)));
+        v.push_back(t.transformationMatrix());
+    }
+    return v;
+}
+
+#define MATRIX_INVERSE_BENCH(M, init, expr)               \
+    static std::vector<M> m = (init);                     \
+    static std::vector<M> out(kCount);                    \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        const u32 i = k % kCount;                         \
+        out[i] = (expr);                                  \
+        if (i == kCount - 1) {                            \
+            bench::clobber();                             \
+        }                                                 \
+    }                                                     \
+    bench::keep(out[0])
+
+BENCHMARK (Mat3f_Inverse, scalar)      { MATRIX_INVERSE_BENCH(Mat3f, randomMatrices<Mat3f>(6), inverseScalar(m[i])); }
+BENCHMARK (Mat3f_Inverse, simd)        { MATRIX_INVERSE_BENCH(Mat3f, randomMatrices<Mat3f>(6), m[i].inverse()); }
+BENCHMARK (Mat3f_Inverse, orthogonal)  { MATRIX_INVERSE_BENCH(Mat3f, randomMatrices<Mat3f>(6), m[i].inverseOrthogonal()); }
+BENCHMARK (Mat3f_Inverse, normal)      { MATRIX_INVERSE_BENCH(Mat3f, randomMatrices<Mat3f>(6), m[i].normalMatrix()); }
+
+BENCHMARK (Mat4f_Inverse, scalar)      { MATRIX_INVERSE_BENCH(Mat4f, randomTransforms(), inverseScalar(m[i])); }
+BENCHMARK (Mat4f_Inverse, simd)        { MATRIX_INVERSE_BENCH(Mat4f, randomTransforms(), m[i].inverse()); }
+BENCHMARK (Mat4f_Inverse, affine)      { MATRIX_INVERSE_BENCH(Mat4f, randomTransforms(), m[i].inverseAffine()); }
+BENCHMARK (Mat4f_Inverse, orthogonal)  { MATRIX_INVERSE_BENCH(Mat4f, randomTransforms(), m[i].inverseOrthogonal()); }
+BENCHMARK (Mat4f_Inverse, rigid)       { MATRIX_INVERSE_BENCH(Mat4f, randomTransforms(), m[i].inverseRigid()); }
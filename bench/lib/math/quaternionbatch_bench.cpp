@@ -0,0 +1,62 @@
+//
+// Batch quaternion benchmarks: scalar Quat4f operations in a loop vs
+// batch kernels, blending two poses of 4096 rotations.
+//
+#include "../../bench.h"
+
+#include <vector>
+
+static constexpr u32 kQuats = 4096;
+
+static std::vector<Quat4f> randomRotations (const s64 seed) {
+    sge::Random r(seed);
+    std::vector<Quat4f> q;
+    for (u32 k = 0; k < kQuats; ++k) {
+        const Vec3f axis = Vec3f(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f),
+                                 r.nextFloat(-1.0f, 1.0f)).normalize();
+        q.push_back(Quat4f(r.nextFloat(-math::kPi, math::kPi), axis).normalize());
+    }
+    return q;
+}
+
+static Quat4fArray toArray (const std::vector<Quat4f> &q) {
+    Quat4fArray a;
+    for (const Quat4f &x : q) {
+        a.add(x);
+    }
+    return a;
+}
+
+static const std::vector<Quat4f> kPoseA = randomRotations(1);
+static const std::vector<Quat4f> kPoseB = randomRotations(2);
+
+// One iteration blends every rotation of pose a towards pose b.
+#define QUAT_SCALAR_BENCH(body)                           \
+    static std::vector<Quat4f> dst(kQuats);               \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        for (u32 i = 0; i < kQuats; ++i) {                \
+            body;                                         \
+        }                                                 \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(dst[0])
+
+#define QUAT_BATCH_BENCH(body)                            \
+    static const Quat4fArray a = toArray(kPoseA);         \
+    static const Quat4fArray b = toArray(kPoseB);         \
+    static Quat4fArray dst(kQuats);                       \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        body;                                             \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(dst.w[0])
+
+BENCHMARK (Quat_Nlerp_4K, scalar) { QUAT_SCALAR_BENCH(dst[i] = nlerp(kPoseA[i], kPoseB[i], 0.3f)); }
+BENCHMARK (Quat_Nlerp_4K, batch)  { QUAT_BATCH_BENCH(nlerp(a, b, 0.3f, dst)); }
+
+BENCHMARK (Quat_Slerp_4K, scalar) { QUAT_SCALAR_BENCH(dst[i] = slerp(kPoseA[i], kPoseB[i], 0.3f)); }
+BENCHMARK (Quat_Slerp_4K, batch)  { QUAT_BATCH_BENCH(slerp(a, b, 0.3f, dst)); }
+BENCHMARK (Quat_Slerp_4K, fast)   { QUAT_BATCH_BENCH(slerpFast(a, b, 0.3f, dst)); }
+
+BENCHMARK (Quat_Normalize_4K, scalar) { QUAT_SCALAR_BENCH(dst[i] = kPoseA[i].normalize()); }
+BENCHMARK (Quat_Normalize_4K, batch)  { QUAT_BATCH_BENCH((dst = a, normalize(dst))); }
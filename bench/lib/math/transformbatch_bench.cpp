@@ -0,0 +1,73 @@
+//
+// Batch transform benchmarks: per-vertex Mat4f * Vec4f vs batch kernels.
+//
+#include "../../bench.h"
+
+#include <vector>
+
+using sge::Mesh;
+using sge::Vertex;
+
+static constexpr u32 kVerts = 512;           // Mesh positions, strided in place.
+static constexpr u32 kLargeVerts = 1 << 20;  // Enough to split across threads.
+
+static Mesh randomMesh (const u32 count) {
+    sge::Random r(1);
+    Mesh mesh;
+    mesh.vertices.reserve(count);
+    for (u32 k = 0; k < count; ++k) {
+        mesh.addVertex(Vertex(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f),
+                              0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 255, 255, 255, 255));
+    }
+    return mesh;
+}
+
+static const Mat4f kXform = Mat4f(0.8f, 0.6f, 0.0f, 0.0f,
+                                  -0.6f, 0.8f, 0.0f, 0.0f,
+                                  0.0f, 0.0f, 1.0f, 0.0f,
+                                  0.1f, 0.2f, 0.3f, 1.0f);
+
+// One iteration transforms every position of the mesh from src into dst.
+#define TRANSFORM_BENCH(count, body)                      \
+    static const Mesh src = randomMesh(count);            \
+    static Mesh dst = src;                                \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        body;                                             \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(dst.vertices[0])
+
+BENCHMARK (TransformPoints_512, per_vertex) {
+    TRANSFORM_BENCH(kVerts, for (u32 i = 0; i < kVerts; ++i) {
+        dst.vertices[i].position = (kXform * Vec4f(src.vertices[i].position, 1.0f)).xyz();
+    });
+}
+BENCHMARK (TransformPoints_512, scalar) { TRANSFORM_BENCH(kVerts, transformPointsScalar(kXform, src.positions(), dst.positions())); }
+BENCHMARK (TransformPoints_512, batch)  { TRANSFORM_BENCH(kVerts, transformPoints(kXform, src.positions(), dst.positions())); }
+
+BENCHMARK (TransformDirections_512, scalar) { TRANSFORM_BENCH(kVerts, transformDirectionsScalar(kXform, src.normals(), dst.normals())); }
+BENCHMARK (TransformDirections_512, batch)  { TRANSFORM_BENCH(kVerts, transformDirections(kXform, src.normals(), dst.normals())); }
+
+BENCHMARK (TransformPoints_1M, batch)    { TRANSFORM_BENCH(kLargeVerts, transformPoints(kXform, src.positions(), dst.positions())); }
+BENCHMARK (TransformPoints_1M, threaded) { TRANSFORM_BENCH(kLargeVerts, transformPoints(kXform, src.positions(), dst.positions(), true)); }
+
+static std::vector<Vec4f> randomVec4s () {
+    sge::Random r(2);
+    std::vector<Vec4f> v;
+    for (u32 k = 0; k < kVerts; ++k) {
+        v.emplace_back(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), 1.0f);
+    }
+    return v;
+}
+
+#define TRANSFORM_VEC4_BENCH(body)                        \
+    static const std::vector<Vec4f> src = randomVec4s();  \
+    static std::vector<Vec4f> dst(kVerts);                \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        body;                                             \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(dst[0])
+
+BENCHMARK (TransformVec4f_512, scalar) { TRANSFORM_VEC4_BENCH(transformPointsScalar(kXform, src, dst)); }
+BENCHMARK (TransformVec4f_512, batch)  { TRANSFORM_VEC4_BENCH(transformPoints(kXform, src, dst)); }
@@ -0,0 +1,40 @@
+//
+// Transform hierarchy benchmarks: full vs incremental world matrix updates.
+//
+#include "../../bench.h"
+
+#include <vector>
+
+static constexpr u32 kRoots = 1024;
+static constexpr u32 kChildren = 15;  // Per root, as a chain.
+
+static TransformHierarchy makeHierarchy (std::vector<u32> &roots) {
+    sge::Random r(1);
+    TransformHierarchy h;
+    for (u32 k = 0; k < kRoots; ++k) {
+        u32 parent = h.add(Transform(Vec3f(r.nextFloat(-10.0f, 10.0f), 0.0f, r.nextFloat(-10.0f, 10.0f))));
+        roots.push_back(parent);
+        for (u32 c = 0; c < kChildren; ++c) {
+            parent = h.add(Transform(Vec3f(0.0f, 1.0f, 0.0f), Quat4f(r.nextFloat(-1.0f, 1.0f), Vec3f_Y)), parent);
+        }
+    }
+    h.update();
+    return h;
+}
+
+// One iteration touches `dirty` roots and updates the hierarchy.
+#define HIERARCHY_BENCH(dirty, threaded)                  \
+    static std::vector<u32> roots;                        \
+    static TransformHierarchy h = makeHierarchy(roots);   \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        for (u32 i = 0; i < (dirty); ++i) {               \
+            h.modify(roots[(k + i) % kRoots]).rotateL(0.01f, Vec3f_Y); \
+        }                                                 \
+        h.update(threaded);                               \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(h.world(0))
+
+BENCHMARK (TransformHierarchy_16K, all_dirty)      { HIERARCHY_BENCH(kRoots, false); }
+BENCHMARK (TransformHierarchy_16K, all_threaded)   { HIERARCHY_BENCH(kRoots, true); }
+BENCHMARK (TransformHierarchy_16K, one_dirty)      { HIERARCHY_BENCH(1, false); }
@@ -0,0 +1,83 @@
+//
+// SoA wide vector benchmarks: Vec3f loops vs Vec3x4 / Vec3x8.
+//
+#include "../../bench.h"
+
+#include <vector>
+
+static constexpr u32 kCount = 1024; // Working set stays in L1.
+
+static std::vector<Vec3f> randomVec3s (const s64 seed) {
+    sge::Random r(seed);
+    std::vector<Vec3f> v;
+    for (u32 k = 0; k < kCount; ++k) {
+        v.emplace_back(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f));
+    }
+    return v;
+}
+
+// One iteration normalizes the cross product of every pair in a, b.
+#define CROSS_NORMALIZE_BENCH(body)                       \
+    static const std::vector<Vec3f> a = randomVec3s(1);   \
+    static const std::vector<Vec3f> b = randomVec3s(2);   \
+    static std::vector<Vec3f> out(kCount);                \
+    for (u64 k = 0; k < iterations; ++k) {                \
+        body;                                             \
+        bench::clobber();                                 \
+    }                                                     \
+    bench::keep(out[0])
+
+BENCHMARK (Vec3f_CrossNormalize, aos) {
+    CROSS_NORMALIZE_BENCH(for (u32 i = 0; i < kCount; ++i) {
+        out[i] = a[i].cross(b[i]).normalize();
+    });
+}
+
+BENCHMARK (Vec3f_CrossNormalize, vec3x4) {
+    CROSS_NORMALIZE_BENCH(for (u32 i = 0; i < kCount; i += 4) {
+        Vec3x4::gather(a, i).cross(Vec3x4::gather(b, i)).normalize().scatter(out, i);
+    });
+}
+
+BENCHMARK (Vec3f_CrossNormalize, vec3x8) {
+    CROSS_NORMALIZE_BENCH(for (u32 i = 0; i < kCount; i += 8) {
+        Vec3x8::gather(a, i).cross(Vec3x8::gather(b, i)).normalize().scatter(out, i);
+    });
+}
+
+// One iteration sums the dot product of every pair; data stays SoA.
+static std::vector<float> lanes (const std::vector<Vec3f> &v, const int axis) {
+    std::vector<float> r;
+    for (auto &e : v) {
+        r.push_back(e[axis]);
+    }
+    return r;
+}
+
+BENCHMARK (Vec3f_DotSum, aos) {
+    static const std::vector<Vec3f> a = randomVec3s(1);
+    static const std::vector<Vec3f> b = randomVec3s(2);
+    for (u64 k = 0; k < iterations; ++k) {
+        float sum = 0.0f;
+        for (u32 i = 0; i < kCount; ++i) {
+            sum += a[i].dot(b[i]);
+        }
+        bench::keep(sum);
+    }
+}
+
+BENCHMARK (Vec3f_DotSum, soa_vec3x8) {
+    static const std::vector<Vec3f> a = randomVec3s(1);
+    static const std::vector<Vec3f> b = randomVec3s(2);
+    static const std::vector<float> ax = lanes(a, 0), ay = lanes(a, 1), az = lanes(a, 2);
+    static const std::vector<float> bx = lanes(b, 0), by = lanes(b, 1), bz = lanes(b, 2);
+    for (u64 k = 0; k < iterations; ++k) {
+        Floatx8 sum;
+        for (u32 i = 0; i < kCount; i += 8) {
+            const Vec3x8 va(Floatx8::load(&ax[i]), Floatx8::load(&ay[i]), Floatx8::load(&az[i]));
+            const Vec3x8 vb(Floatx8::load(&bx[i]), Floatx8::load(&by[i]), Floatx8::load(&bz[i]));
+            sum += va.dot(vb);
+        }
+        bench::keep(sum);
+    }
+}
@@ -0,0 +1,48 @@
+//
+// Scanner benchmarks: reading 64K .obj style floats with strtof vs
+// parseFloat.
+//
+#include "../../bench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static constexpr u32 kFloats = 65536;
+
+static std::string floatText () {
+    sge::Random r(1);
+    std::string text;
+    char buffer[32];
+    for (u32 k = 0; k < kFloats; ++k) {
+        snprintf(buffer, sizeof(buffer), "%.6f ", r.nextFloat(-100.0f, 100.0f));
+        text += buffer;
+    }
+    return text;
+}
+
+static const std::string kText = floatText();
+
+BENCHMARK (Scanner_Floats_64K, strtof) {
+    for (u64 k = 0; k < iterations; ++k) {
+        float sum = 0.0f;
+        const char *p = kText.c_str();
+        char *next = nullptr;
+        for (u32 i = 0; i < kFloats; ++i, p = next) {
+            sum += strtof(p, &next);
+        }
+        bench::keep(sum);
+    }
+}
+
+BENCHMARK (Scanner_Floats_64K, scanner) {
+    for (u64 k = 0; k < iterations; ++k) {
+        float sum = 0.0f;
+        sge::Scanner s(kText.data(), kText.data() + kText.size());
+        float f;
+        while (s.readFloat(f)) {
+            sum += f;
+        }
+        bench::keep(sum);
+    }
+}
@@ -0,0 +1,95 @@
+//
+// SGEngine benchmark runner.
+//
+#include "bench.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace bench {
+
+struct Entry {
+    const char *group;
+    const char *name;
+    BenchFn fn;
+};
+
+static std::vector<Entry> &entries () {
+    static std::vector<Entry> list;
+    return list;
+}
+
+Registrar::Registrar (const char *group, const char *name, BenchFn fn) {
+    entries().push_back(Entry{group, name, fn});
+}
+
+} /* namespace bench */
+
+using sge::Clock;
+
+static constexpr u64 kMinRunNanos = 50000000; // 0.05s per measurement.
+static constexpr int kRepeats = 7;            // Report the fastest repeat.
+
+/** Time fn, growing the iteration count until the run is long enough. */
+static double nanosPerIteration (bench::BenchFn fn) {
+    u64 iterations = 1;
+
+    for (;;) {
+        u64 start = Clock::nanoTime();
+        fn(iterations);
+        u64 elapsed = Clock::nanoTime() - start;
+
+        if (elapsed >= kMinRunNanos || iterations >= (1ull << 40)) {
+            // Other processes only ever make a run slower, so the fastest
+            // repeat is the best estimate of the kernel's cost.
+            double best = static_cast<double>(elapsed) / iterations;
+            for (int r = 1; r < kRepeats; ++r) {
+                start = Clock::nanoTime();
+                fn(iterations);
+                elapsed = Clock::nanoTime() - start;
+                double ns = static_cast<double>(elapsed) / iterations;
+                best = ns < best ? ns : best;
+            }
+            return best;
+        }
+
+        // Aim a little past the target so the next run is usually the last.
+        u64 next = elapsed > 0 ? (kMinRunNanos * 12 / 10) * iterations / elapsed : iterations * 100;
+        iterations = next > iterations * 100 ? iterations * 100 : (next > iterations ? next : iterations * 2);
+    }
+}
+
+// Usage: sgebench [filter] -- only run groups containing filter.
+int main (int argc, char *argv[]) {
+    const char *filter = argc > 1 ? argv[1] : nullptr;
+
+    std::printf("SIMD backend: %s\n", simd::kBackend);
+
+    const char *group = "";
+    double baseline = 0.0;
+
+    for (const auto &e : bench::entries()) {
+        if (filter && !std::strstr(e.group, filter)) {
+            continue;
+        }
+
+        bool newGroup = std::strcmp(group, e.group) != 0;
+        if (newGroup) {
+            group = e.group;
+            std::printf("\n%s\n", group);
+        }
+
+        double ns = nanosPerIteration(e.fn);
+
+        // The first benchmark in a group is the reference for the others.
+        if (newGroup) {
+            baseline = ns;
+            std::printf("  %-28s %12.3f ns\n", e.name, ns);
+        } else {
+            std::printf("  %-28s %12.3f ns  %6.2fx\n", e.name, ns, baseline / ns);
+        }
+    }
+
+    return 0;
+}
@@ -35,9 +35,12 @@ static GLSLProgram readShaderData (const json::Value &json) {
     return program;
 }
 
-/** Parse mesh data from json file. */
-static Mesh readMeshData (const json::Value &json) {
-    return meshFromObjDocument(json.GetString());
+/**
+ * Parse mesh data from json file: the mesh's cooked cache, cooked now if
+ * it is missing or older than the .obj file.
+ */
+static MeshCache readMeshData (const json::Value &json) {
+    return loadCookedMesh(json.GetString());
 }
 
 /** Parse primitive object data from json file. */
@@ -78,15 +81,50 @@ static Material readMaterialData (const json::Value &json) {
     return m;
 }
 
+/** Bounding sphere of a mesh, centered on its bounding box. */
+static Sphere meshBounds (const Mesh &m) {
+    if (m.vertices.empty()) {
+        Sphere s;
+        s.maximize();
+        return s;
+    }
+
+    Aabb box;
+    for (const Vertex &v : m.vertices) {
+        const Vec3f &p = v.position;
+        box.min = Vec3f(math::min(box.min.x, p.x), math::min(box.min.y, p.y),
+                        math::min(box.min.z, p.z));
+        box.max = Vec3f(math::max(box.max.x, p.x), math::max(box.max.y, p.y),
+                        math::max(box.max.z, p.z));
+    }
+
+    Sphere s(box.center(), 0.0f);
+    for (const Vertex &v : m.vertices) {
+        s.radius = math::max(s.radius, (v.position - s.center).mag());
+    }
+    return s;
+}
+
+/** Bounding sphere of a cached mesh, around its bounding box. */
+static Sphere meshBounds (const MeshCache &cache) {
+    const Aabb box = cache.bounds();
+    return Sphere(box.center(), (box.max - box.min).mag() * 0.5f);
+}
+
 /** Parse Object (entity) data from json file. */
 static Entity readObjectData (const json::Value &json) {
     assert(json.HasMember("shader"));
     Mesh m;
+    MeshCache cache;
     Transform t;
     Material mat = {0.0f, 0.0f};
 
     if (json.HasMember("mesh")) {
-        m = readMeshData(json["mesh"]);
+        cache = readMeshData(json["mesh"]);
+        if (!cache.isValid()) {
+            // No cache could be written; load the .obj file directly.
+            m = meshFromObjDocument(json["mesh"].GetString());
+        }
     } else if (json.HasMember("primitive")) {
         m = readPrimitiveData(json["primitive"]);
     } else {
@@ -108,7 +146,15 @@ static Entity readObjectData (const json::Value &json) {
         t = json::readTransform(json["transform"]);
     }
 
-    return Entity(t, MeshRenderer(m), mat, imagePath, json["shader"].GetString());
+    if (cache.isValid()) {
+        Entity e(t, MeshRenderer(cache), mat, imagePath, json["shader"].GetString());
+        e.bounds = meshBounds(cache);
+        return e;
+    }
+
+    Entity e(t, MeshRenderer(m), mat, imagePath, json["shader"].GetString());
+    e.bounds = meshBounds(m);
+    return e;
 }
 
 /** Read a table of preset color values from a json file. */
@@ -179,7 +225,7 @@ bool Game::init () {
 
     // Emulate a camera/view transform
     view = Transform();
-    view.position = Vec3f(0.0f, 3.0f, 18.0f);
+    view.setPosition(Vec3f(0.0f, 3.0f, 18.0f));
 
     lightData.lights[0] = GLSLLight(Vec3f(0.05f, 0.001f, 0.01f),  Vec3f(0.0f, 4.0f, 0.0f),   Vec3f(0.0f, -1.0f, 0.0f), GLSLAttenuation(1.0f, 0.5f, 0.2f), 0.0f);
     lightData.lights[1] = GLSLLight(Vec3f(1.0f, 1.0f, 0.5f),     Vec3f(0.0f, 4.0f, 0.0f),   Vec3f(1.0f, -1.0f, 0.0f).normalize(), GLSLAttenuation(1.0f, 0.5f, 0.2f), 0.0f);
@@ -221,16 +267,16 @@ void Game::input () {
     }
 
     if (Input::keyDown('a')) {
-        view.position += view.right() * -camSpeed;
+        view.translate(view.right() * -camSpeed);
     }
     if (Input::keyDown('d')) {
-        view.position += view.right() * camSpeed;
+        view.translate(view.right() * camSpeed);
     }
     if (Input::keyDown('w')) {
-        view.position += view.forward() * -camSpeed;
+        view.translate(view.forward() * -camSpeed);
     }
     if (Input::keyDown('s')) {
-        view.position += view.forward() * camSpeed;
+        view.translate(view.forward() * camSpeed);
     }
 
     if (Input::mbPressed(1)) {
@@ -279,9 +325,29 @@ void Game::render () {
     memcpy(p, &lightData, sizeof(light_data_t));
     glUnmapBuffer(GL_UNIFORM_BUFFER);
 
+    // Cull entities against the view frustum.
+    mBounds.x.resize(mObjects.size());
+    mBounds.y.resize(mObjects.size());
+    mBounds.z.resize(mObjects.size());
+    mBounds.radius.resize(mObjects.size());
+    for (size_t i = 0; i < mObjects.size(); ++i) {
+        const Entity &e = mObjects[i];
+        const Vec3f scale = e.transform.scale();
+        const Vec4f center = e.transform.transformationMatrix() * Vec4f(e.bounds.center, 1.0f);
+        const float radius = e.bounds.radius *
+            math::max(fabsf(scale.x), math::max(fabsf(scale.y), fabsf(scale.z)));
+        mBounds.set(i, Sphere(center.xyz(), radius));
+    }
+    Frustum(viewMat).cull(mBounds, mVisible);
+
     // Custom drawing...
     GLSLProgram *shader;
-    for (const auto &e : mObjects) {
+    for (size_t i = 0; i < mObjects.size(); ++i) {
+        if (!(mVisible[i / 64] & (u64(1) << (i % 64)))) {
+            continue;
+        }
+
+        const Entity &e = mObjects[i];
         shader = bindShader(e.shader);
 
         // TODO [smh] Uniform buffer for transformations.
@@ -296,7 +362,7 @@ void Game::render () {
         memcpy(p, &matrixData, sizeof(matrix_data_t));
         glUnmapBuffer(GL_UNIFORM_BUFFER);
 
-        shader->setUniform("eyePos", view.position);
+        shader->setUniform("eyePos", view.position());
 
         shader->bindUniformBuffer("MatrixBlock", matBuffer, 1);
         shader->bindUniformBuffer("LightingBlock", lightBuffer, 2);
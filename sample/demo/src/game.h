@@ -31,6 +31,7 @@ public:
     Material mat;
     std::string texture;
     std::string shader;
+    Sphere bounds;      /**< Local space bounds of the mesh, for culling. */
 
     Entity (const Transform &pTransform,
             const MeshRenderer &pMeshRenderer,
@@ -38,7 +39,7 @@ public:
             const std::string &pTex,
             const std::string &pShader)
             : transform{pTransform}, mr{pMeshRenderer}, mat{pMat},
-              texture{pTex}, shader{pShader} { }
+              texture{pTex}, shader{pShader} { bounds.maximize(); }
 };
 
 class Game {
@@ -59,6 +60,8 @@ public:
 
 private:
     std::vector<Entity> mObjects;
+    SphereArray mBounds;        /**< World space entity bounds. */
+    std::vector<u64> mVisible;  /**< Entity visibility bits. */
     std::map<std::string, GLSLProgram> mShaders;
 
     u32 mWidth;
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <fstream>
 #include <ctime>
+#include <vector>
 
 #include "lib.h"
 
@@ -17,9 +18,14 @@ int main (int argc, char *argv[]) {
 
     if (output_file.is_open()) {
         output_file << "P3\n# Colors Demo\n512 768\n255\n";
+        std::vector<Vec3f> hsl(512);
+        std::vector<Color> row(512, Color(0u));
         for (int x = 0; x < 256; ++x) {
             for (int y = 0; y < 512; ++y) {
-                Color c = Color::fromHSL(math::fit(y, 0.0f, 512.0f, 0.0f, 360.0f), 1.0f, math::toRatio(x, 255, 0));
+                hsl[y] = Vec3f(math::fit(y, 0.0f, 512.0f, 0.0f, 360.0f), 1.0f, math::toRatio(x, 255, 0));
+            }
+            colorsFromHSL(hsl, row);
+            for (const Color &c : row) {
                 output_file << "" << (u32)c.r << " " << (u32)c.g << " " << (u32)c.b << " ";
             }
             output_file << "\n";
@@ -43,9 +49,12 @@ int main (int argc, char *argv[]) {
             }
             output_file << "\n";
         }
+        for (int y = 0; y < 512; ++y) {
+            hsl[y] = Vec3f(math::fit(y, 0, 512.0f, 0, 360.0f), 1.0f, 0.5f);
+        }
+        colorsFromHSL(hsl, row);
         for (int x = 0; x < 256; ++x) {
-            for (int y = 0; y < 512; ++y) {
-                Color c = Color::fromHSL(math::fit(y, 0, 512.0f, 0, 360.0f), 1.0f, 0.5f);
+            for (const Color &c : row) {
                 output_file << "" << (u32)c.r << " " << (u32)c.g << " " << (u32)c.b << " ";
             }
             output_file << "\n";
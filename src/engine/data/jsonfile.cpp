@@ -103,15 +103,15 @@ Transform readTransform (const json::Value &json) {
     Transform t;
 
     if (json.HasMember("location")) {
-        t.position = readVec3f(json["location"]);
+        t.setPosition(readVec3f(json["location"]));
     }
 
     if (json.HasMember("orientation")) {
-        t.orientation = ReadOrientation(json["orientation"]);
+        t.setOrientation(ReadOrientation(json["orientation"]));
     }
 
     if (json.HasMember("size")) {
-        t.scale = readVec3f(json["size"]);
+        t.setScale(readVec3f(json["size"]));
     }
 
     return t;
@@ -36,7 +36,7 @@
 
 #include "image/image.h"
 
-#include "model/obj.h"
+#include "model/meshcook.h"
 
 #include "render/meshrenderer.h"
 #include "render/debuggraphics.h"
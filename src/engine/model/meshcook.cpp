@@ -0,0 +1,28 @@
+//
+// Mesh Cooking Implementation.
+//
+#include "../engine.h"
+
+#include <iterator>
+
+namespace sge {
+
+MeshCache loadCookedMesh (const char * const objFilename) {
+    const std::string cachePath = meshCachePath(objFilename);
+
+    if (isMeshCacheFresh(objFilename, cachePath.c_str())) {
+        MeshCache cache(cachePath.c_str());
+        if (cache.isValid()) {
+            return cache;
+        }
+    }
+
+    const std::vector<float> lodRatios(std::begin(kDefaultCookLodRatios), std::end(kDefaultCookLodRatios));
+    gConsole.debugf("Cooking mesh -- %s.\n", objFilename);
+    if (!cookObjMesh(objFilename, cachePath.c_str(), lodRatios)) {
+        return MeshCache();
+    }
+    return MeshCache(cachePath.c_str());
+}
+
+} /* namespace sge */
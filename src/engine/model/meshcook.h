@@ -0,0 +1,34 @@
+/*---  MeshCook.h - Cooked Mesh Caches for Model Files  --------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Convert .obj files to MeshCache files once with cookObjMesh(),
+ *   and load the cache instead of the .obj file from then on.
+ *
+ * A cache lives next to its .obj file and is used while it is newer than
+ * the .obj file and of the current format version; otherwise it is
+ * cooked again. Caches can also be cooked ahead of time with the
+ * sge-meshcook tool.
+ */
+#ifndef __SGE_MESHCOOK_H
+#define __SGE_MESHCOOK_H
+
+namespace sge {
+
+/**
+ * Load the cache of objFilename at meshCachePath(), cooking it first with
+ * kDefaultCookLodRatios if it is missing, stale or of another version.
+ *
+ * @return The cache, which is invalid if the .obj file couldn't be read
+ *   or the cache couldn't be written.
+ */
+MeshCache loadCookedMesh (const char * const objFilename);
+
+} /* namespace sge */
+
+#endif /* __SGE_MESHCOOK_H */
@@ -3,8 +3,6 @@
 //
 #include "../engine.h"
 
-#include <cmath> // cos, sin
-
 namespace sge {
 
 //=====================================================
@@ -60,12 +58,14 @@ void DebugGraphics::sphere (const Vec3f &pCenter, const float pRadius,
     constexpr float limit = math::rad(360.0f);
     constexpr float increment = limit / 12.0f;
 
-    float x_ = pRadius * std::cos(0.0f);
-    float y_ = pRadius * std::sin(0.0f);
+    float x_ = pRadius;
+    float y_ = 0.0f;
 
     for (float theta = increment, thetaMax = limit + increment; theta <= thetaMax; theta += increment) {
-        float x = pRadius * std::cos(theta);
-        float y = pRadius * std::sin(theta);
+        float s, c;
+        math::fast::sincos<math::fast::kLow>(theta, s, c);
+        float x = pRadius * c;
+        float y = pRadius * s;
 
         edge(pCenter + Vec3f(x_, 0.0f, y_), pCenter + Vec3f(x, 0.0f, y),
              pCol);
@@ -3,55 +3,160 @@
 //
 #include "../engine.h"
 
+#include <cstdint> // uintptr_t
+
 namespace sge {
 
+template <typename V>
+static std::vector<u8> bytesOf (const std::vector<V> &v) {
+    const u8 *p = reinterpret_cast<const u8 *>(v.data());
+    return std::vector<u8>(p, p + v.size() * sizeof(V));
+}
+
+static GLenum glType (const AttribType type) {
+    switch (type) {
+    case kFloat16:
+        return GL_HALF_FLOAT;
+    case kSnorm16:
+        return GL_SHORT;
+    case kUnorm16:
+        return GL_UNSIGNED_SHORT;
+    case kSnorm8:
+        return GL_BYTE;
+    case kUnorm8:
+        return GL_UNSIGNED_BYTE;
+    default:
+        return GL_FLOAT;
+    }
+}
+
+static GLenum glIndexType (const IndexFormat format) {
+    return (format == kIndex16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+}
+
+// Optimise a copy of mesh for drawing, reporting the vertex cache
+// efficiency gained.
+template <typename M>
+static M optimized (const M &mesh) {
+    M m = mesh;
+    const VertexCacheStats before = analyzeVertexCache(m.indices, m.vertCount());
+    m.optimize();
+    const VertexCacheStats after = analyzeVertexCache(m.indices, m.vertCount());
+
+    gConsole.debugf("Optimised mesh: %u faces, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+                    m.indexCount() / 3, before.acmr, after.acmr, before.atvr, after.atvr);
+    return m;
+}
+
+template <typename V>
+void MeshRenderer::addStream (const VertexLayout &layout, const std::vector<V> &data) {
+    mStreams.push_back(Stream{layout, bytesOf(data), 0});
+}
+
+void MeshRenderer::addStream (const VertexLayout &layout, const u8 *data, const size_t size) {
+    mStreams.push_back(Stream{layout, std::vector<u8>(data, data + size), 0});
+}
+
+MeshRenderer::MeshRenderer (const Mesh &pMesh, const PrimitiveType primitive)
+      : mGlVaoId{0}, mIndexBuffer{0} {
+    const Mesh m = optimized(pMesh);
+    addStream(Vertex::layout(), m.vertices);
+    mIndices = IndexBuffer(m.indices, m.vertCount(), primitive);
+}
+
+MeshRenderer::MeshRenderer (const PackedMesh &pMesh, const PrimitiveType primitive)
+      : mGlVaoId{0}, mIndexBuffer{0} {
+    const PackedMesh m = optimized(pMesh);
+    addStream(PackedVertex::layout(), m.vertices);
+    mIndices = IndexBuffer(m.indices, m.vertCount(), primitive);
+}
+
+MeshRenderer::MeshRenderer (const MeshSoA &pMesh, const PrimitiveType primitive)
+      : mGlVaoId{0}, mIndexBuffer{0} {
+    const MeshSoA m(optimized(pMesh.toMesh()));
+    addStream(MeshSoA::positionLayout(), m.positions);
+    addStream(MeshSoA::normalLayout(), m.normals);
+    addStream(MeshSoA::texCoordLayout(), m.texCoords);
+    addStream(MeshSoA::colorLayout(), m.colors);
+    mIndices = IndexBuffer(m.indices, m.vertCount(), primitive);
+}
+
+MeshRenderer::MeshRenderer (const MeshCache &pCache, const u32 level)
+      : mGlVaoId{0}, mIndexBuffer{0} {
+    verify(pCache.isValid());
+    addStream(pCache.layout(), pCache.vertexData(level),
+              static_cast<size_t>(pCache.lod(level).vertexCount) * pCache.layout().stride());
+    mIndices = pCache.indices(level);
+}
+
 void MeshRenderer::compile () {
 
     if (mGlVaoId == 0) {
         glGenVertexArrays(1, &mGlVaoId);
     }
 
-    if (mBuffers[0] == 0) {
-        glGenBuffers(2, mBuffers);
+    if (mIndexBuffer == 0) {
+        glGenBuffers(1, &mIndexBuffer);
     }
 
     glBindVertexArray(mGlVaoId);
 
-    glBindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
-    glBufferData(GL_ARRAY_BUFFER, mesh.vertCount() * sizeof(Vertex), mesh.vertices.data(), GL_STATIC_DRAW);
+    for (Stream &s : mStreams) {
+        if (s.buffer == 0) {
+            glGenBuffers(1, &s.buffer);
+        }
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), BUFFER_OFFSET(0));        // Position
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), BUFFER_OFFSET(3));        // Normal
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), BUFFER_OFFSET(6));        // Texture coord
-    glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), BUFFER_OFFSET(8)); // Color
+        glBindBuffer(GL_ARRAY_BUFFER, s.buffer);
+        glBufferData(GL_ARRAY_BUFFER, s.data.size(), s.data.data(), GL_STATIC_DRAW);
+
+        for (const VertexAttrib &a : s.layout.attributes()) {
+            glVertexAttribPointer(a.location, static_cast<GLint>(a.components), glType(a.type),
+                                  VertexLayout::isNormalized(a.type) ? GL_TRUE : GL_FALSE,
+                                  static_cast<GLsizei>(s.layout.stride()),
+                                  reinterpret_cast<const GLvoid *>(static_cast<uintptr_t>(a.offset)));
+        }
+    }
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBuffers[1]);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indexCount() * sizeof(int), mesh.indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndices.size(), mIndices.data(), GL_STATIC_DRAW);
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 }
 
-void MeshRenderer::render () const {
+void MeshRenderer::draw (const bool positionsOnly) const {
     if (!isCompiled()) {
         IF_DEBUG(gConsole.error("Attempt to render mesh before compilation!\n"); );
         return;
     }
 
     glBindVertexArray(mGlVaoId);
-    glEnableVertexAttribArray(0); // Position
-    glEnableVertexAttribArray(1); // Normal
-    glEnableVertexAttribArray(2); // Texture coord
-    glEnableVertexAttribArray(3); // Color
+    for (const Stream &s : mStreams) {
+        for (const VertexAttrib &a : s.layout.attributes()) {
+            if (!positionsOnly || a.location == kAttribPosition) {
+                glEnableVertexAttribArray(a.location);
+            }
+        }
+    }
 
     // Debug: Line Rendering
     // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mesh.indexCount()), GL_UNSIGNED_INT, BUFFER_OFFSET(0));
+    if (mIndices.primitive() == kTriangleStrip) {
+        glEnable(GL_PRIMITIVE_RESTART);
+        glPrimitiveRestartIndex(mIndices.restartIndex());
+        glDrawElements(GL_TRIANGLE_STRIP, static_cast<GLsizei>(mIndices.count()),
+                       glIndexType(mIndices.format()), BUFFER_OFFSET(0));
+        glDisable(GL_PRIMITIVE_RESTART);
+    } else {
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mIndices.count()),
+                       glIndexType(mIndices.format()), BUFFER_OFFSET(0));
+    }
 
-    glDisableVertexAttribArray(0);
-    glDisableVertexAttribArray(1);
-    glDisableVertexAttribArray(2);
-    glDisableVertexAttribArray(3);
+    for (const Stream &s : mStreams) {
+        for (const VertexAttrib &a : s.layout.attributes()) {
+            glDisableVertexAttribArray(a.location);
+        }
+    }
 
     glBindVertexArray(0);
 }
@@ -12,6 +12,8 @@
 #ifndef __SGE_MESHRENDERER_H
 #define __SGE_MESHRENDERER_H
 
+#include <vector>
+
 namespace sge {
 
 class MeshRenderer {
@@ -19,12 +21,47 @@ public:
 
     /**
      * Create a Renderable object for mesh data using an input Mesh.
+     * The triangles and vertices sent to the GPU are reordered with
+     * Mesh::optimize(); pMesh itself is unchanged. Indices are sent as
+     * 16 bit values when the mesh has few enough vertices.
      *
      * @param pMesh Geometry mesh data
+     * @param primitive kTriangleStrip to draw the triangles as strips
+     *                  with primitive restart, sending fewer indices.
      * @return
      */
-    explicit MeshRenderer(const Mesh &pMesh)
-            : mGlVaoId{0}, mBuffers{0, 0}, mesh{pMesh} { }
+    explicit MeshRenderer(const Mesh &pMesh, const PrimitiveType primitive = kTriangles);
+
+    /**
+     * Create a Renderable object for packed mesh data. Vertices are
+     * uploaded as PackedVertex, so the shader must apply
+     * pMesh.decodeMatrix() to positions and unfold normals. They are
+     * reordered with PackedMesh::optimize().
+     *
+     * @param pMesh Packed geometry mesh data
+     * @param primitive Triangle list or strips, as for a Mesh.
+     */
+    explicit MeshRenderer(const PackedMesh &pMesh, const PrimitiveType primitive = kTriangles);
+
+    /**
+     * Create a Renderable object for mesh data stored as attribute
+     * arrays. Each array is uploaded to its own vertex buffer, so
+     * renderDepth() only reads positions. Reordered as for a Mesh.
+     *
+     * @param pMesh Geometry mesh data
+     * @param primitive Triangle list or strips, as for a Mesh.
+     */
+    explicit MeshRenderer(const MeshSoA &pMesh, const PrimitiveType primitive = kTriangles);
+
+    /**
+     * Create a Renderable object for one level of a mesh cache. Its
+     * buffers are copied as they are, having been optimised and packed
+     * when the cache was written.
+     *
+     * @param pCache Valid mesh cache
+     * @param level Level of detail, 0 for the full mesh.
+     */
+    explicit MeshRenderer(const MeshCache &pCache, const u32 level = 0);
 
     /**
      * @return true if mesh has been compiled and has valid bound GPU buffers.
@@ -41,16 +78,72 @@ public:
      */
     void render () const;
 
+    /**
+     * Draw mesh data with only the position attribute enabled, e.g. for a
+     * depth or shadow pass.
+     */
+    void renderDepth () const;
+
+    /**
+     * @return Number of vertex buffers sent to the GPU.
+     */
+    u32 streamCount () const;
+
+    /**
+     * @return Layout of the vertices in one vertex buffer.
+     */
+    const VertexLayout &layout (const u32 stream = 0) const;
+
+    /**
+     * @return Indices sent to the GPU.
+     */
+    const IndexBuffer &indices () const;
+
 private:
+    /** One vertex buffer. */
+    struct Stream {
+        VertexLayout layout;
+        std::vector<u8> data;
+        GLuint buffer;
+    };
+
+    template <typename V>
+    void addStream (const VertexLayout &layout, const std::vector<V> &data);
+
+    void addStream (const VertexLayout &layout, const u8 *data, const size_t size);
+
+    void draw (const bool positionsOnly) const;
+
     GLuint mGlVaoId;
-    GLuint mBuffers[2];
-    Mesh mesh;
+    GLuint mIndexBuffer;
+    std::vector<Stream> mStreams;
+    IndexBuffer mIndices;
 };
 
 // --------------------------------------------------------------------------
 
 inline bool MeshRenderer::isCompiled () const {
-    return (mGlVaoId > 0 && mBuffers[0] > 0 && mBuffers[1] > 0);
+    return (mGlVaoId > 0 && mIndexBuffer > 0 && !mStreams.empty() && mStreams[0].buffer > 0);
+}
+
+inline void MeshRenderer::render () const {
+    draw(false);
+}
+
+inline void MeshRenderer::renderDepth () const {
+    draw(true);
+}
+
+inline u32 MeshRenderer::streamCount () const {
+    return static_cast<u32>(mStreams.size());
+}
+
+inline const VertexLayout &MeshRenderer::layout (const u32 stream) const {
+    return mStreams[stream].layout;
+}
+
+inline const IndexBuffer &MeshRenderer::indices () const {
+    return mIndices;
 }
 
 } /* namespace sge */
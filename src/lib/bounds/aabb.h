@@ -80,6 +80,12 @@ public:
      */
     void expandSelf (const float val);
 
+    /**
+     * Grow this AABB to contain point.
+     * Destructive.
+     */
+    void addPoint (const Vec3f &point);
+
     /** Test if rectangle contains point. */
     friend bool contains (const Aabb &aabb, const Vec3f &point);
 
@@ -135,6 +141,15 @@ inline void Aabb::expandSelf (const float val) {
     max.z += val;
 }
 
+inline void Aabb::addPoint (const Vec3f &point) {
+    min.x = math::min(min.x, point.x);
+    min.y = math::min(min.y, point.y);
+    min.z = math::min(min.z, point.z);
+    max.x = math::max(max.x, point.x);
+    max.y = math::max(max.y, point.y);
+    max.z = math::max(max.z, point.z);
+}
+
 //=================
 // Aabb Comparison
 //=================
@@ -0,0 +1,154 @@
+//
+// Frustum Implementation
+//
+#include "../lib.h"
+
+#include <algorithm>
+
+namespace sge {
+
+Frustum::Frustum () {
+    for (Vec4f &p : mPlanes) {
+        p = Vec4f(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+}
+
+// Gribb/Hartmann: with r0..r3 the rows of the matrix, a clip space point
+// is inside -w <= x when (r3 + r0) . p >= 0, inside x <= w when
+// (r3 - r0) . p >= 0, and so on for y and z.
+void Frustum::set (const Mat4f &m) {
+    const Vec4f r0 = Vec4f(m[0].x, m[1].x, m[2].x, m[3].x);
+    const Vec4f r1 = Vec4f(m[0].y, m[1].y, m[2].y, m[3].y);
+    const Vec4f r2 = Vec4f(m[0].z, m[1].z, m[2].z, m[3].z);
+    const Vec4f r3 = Vec4f(m[0].w, m[1].w, m[2].w, m[3].w);
+
+    mPlanes[kLeft] = r3 + r0;
+    mPlanes[kRight] = r3 - r0;
+    mPlanes[kBottom] = r3 + r1;
+    mPlanes[kTop] = r3 - r1;
+    mPlanes[kNear] = r3 + r2;
+    mPlanes[kFar] = r3 - r2;
+
+    for (Vec4f &p : mPlanes) {
+        p /= p.xyz().mag();
+    }
+}
+
+//==================================
+// Batch Culling
+//==================================
+
+static constexpr size_t kBlock = Floatx8::kWidth;
+
+namespace {
+
+// One plane, splatted across 8 lanes.
+struct PlaneX8 {
+    Floatx8 a, b, c, d;
+    Floatx8 absA, absB, absC;
+};
+
+// Load count (<= 8) floats from v, starting at first. Missing lanes are 0.
+inline Floatx8 loadBlock (const std::vector<float> &v, const size_t first,
+                          const size_t count) {
+    if (count == kBlock) {
+        return Floatx8::load(&v[first]);
+    }
+
+    float tmp[kBlock] = {};
+    for (size_t i = 0; i < count; ++i) {
+        tmp[i] = v[first + i];
+    }
+    return Floatx8::load(tmp);
+}
+
+struct SphereBlock {
+    Floatx8 x, y, z, negRadius;
+
+    SphereBlock (const SphereArray &s, const size_t first, const size_t count)
+          : x(loadBlock(s.x, first, count)), y(loadBlock(s.y, first, count)),
+            z(loadBlock(s.z, first, count)), negRadius(-loadBlock(s.radius, first, count)) { }
+
+    // Mask of the lanes entirely behind p.
+    int outside (const PlaneX8 &p) const {
+        const Floatx8 dist = madd(p.a, x, madd(p.b, y, madd(p.c, z, p.d)));
+        return cmpLt(dist, negRadius).movemask();
+    }
+};
+
+struct AabbBlock {
+    Floatx8 x, y, z, ex, ey, ez;
+
+    AabbBlock (const AabbArray &b, const size_t first, const size_t count)
+          : x(loadBlock(b.x, first, count)), y(loadBlock(b.y, first, count)),
+            z(loadBlock(b.z, first, count)), ex(loadBlock(b.extentX, first, count)),
+            ey(loadBlock(b.extentY, first, count)), ez(loadBlock(b.extentZ, first, count)) { }
+
+    int outside (const PlaneX8 &p) const {
+        const Floatx8 dist = madd(p.a, x, madd(p.b, y, madd(p.c, z, p.d)));
+        const Floatx8 r = madd(p.absA, ex, madd(p.absB, ey, p.absC * ez));
+        return cmpLt(dist + r, Floatx8(0.0f)).movemask();
+    }
+};
+
+} /* namespace */
+
+// Test each block of 8 against the planes, starting with the one which
+// last rejected the whole block, and stop as soon as every lane is
+// rejected. Partly visible blocks test all six planes.
+template <typename Block, typename Array>
+static void cullBlocks (const Vec4f (&planes)[Frustum::kPlaneCount], Array &array,
+                        std::vector<u64> &visible) {
+    PlaneX8 p[Frustum::kPlaneCount];
+    for (int i = 0; i < Frustum::kPlaneCount; ++i) {
+        p[i].a = Floatx8(planes[i].x);
+        p[i].b = Floatx8(planes[i].y);
+        p[i].c = Floatx8(planes[i].z);
+        p[i].d = Floatx8(planes[i].w);
+        p[i].absA = Floatx8(fabsf(planes[i].x));
+        p[i].absB = Floatx8(fabsf(planes[i].y));
+        p[i].absC = Floatx8(fabsf(planes[i].z));
+    }
+
+    const size_t n = array.size();
+    const size_t blocks = (n + kBlock - 1) / kBlock;
+    array.lastPlane.resize(blocks, 0);
+    visible.assign((n + 63) / 64, 0);
+
+    for (size_t b = 0; b < blocks; ++b) {
+        const size_t first = b * kBlock;
+        const size_t count = std::min(kBlock, n - first);
+        const int valid = (1 << count) - 1;
+        const Block block(array, first, count);
+
+        int outside = 0;
+        u32 plane = array.lastPlane[b];
+        for (int k = 0; k < Frustum::kPlaneCount; ++k) {
+            outside |= block.outside(p[plane]);
+            if ((outside & valid) == valid) {
+                array.lastPlane[b] = static_cast<u8>(plane);
+                break;
+            }
+            plane = (plane + 1 < Frustum::kPlaneCount) ? plane + 1 : 0;
+        }
+
+        visible[first / 64] |= static_cast<u64>(~outside & valid) << (first % 64);
+    }
+}
+
+void Frustum::cull (SphereArray &spheres, std::vector<u64> &visible) const {
+    verify(spheres.y.size() == spheres.size() && spheres.z.size() == spheres.size() &&
+           spheres.radius.size() == spheres.size());
+
+    cullBlocks<SphereBlock>(mPlanes, spheres, visible);
+}
+
+void Frustum::cull (AabbArray &boxes, std::vector<u64> &visible) const {
+    verify(boxes.y.size() == boxes.size() && boxes.z.size() == boxes.size() &&
+           boxes.extentX.size() == boxes.size() && boxes.extentY.size() == boxes.size() &&
+           boxes.extentZ.size() == boxes.size());
+
+    cullBlocks<AabbBlock>(mPlanes, boxes, visible);
+}
+
+} /* namespace sge */
@@ -0,0 +1,232 @@
+/*---  Frustum.h - View Frustum Header  ----------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Defines a view frustum for culling bounding volumes, one at a
+ *   time or in batches.
+ *
+ * Batch culling takes bounds as structures of arrays (SphereArray,
+ * AabbArray) and tests 8 of them per plane at once, writing one
+ * visibility bit per volume. Each block of 8 remembers the plane which
+ * last rejected all of it and tries that plane first on the next cull,
+ * so blocks which stay out of view are usually rejected by one plane.
+ */
+#ifndef __SGE_FRUSTUM_H
+#define __SGE_FRUSTUM_H
+
+#include <vector>
+
+namespace sge {
+
+/**
+ * Bounding spheres stored as a structure of arrays, for batch culling.
+ */
+class SphereArray {
+public:
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> radius;
+
+    /** Culling state, one entry per block of 8 spheres. */
+    std::vector<u8> lastPlane;
+
+public:
+    size_t size () const { return x.size(); }
+
+    void add (const Sphere &sphere);
+
+    void set (const size_t i, const Sphere &sphere);
+
+    void clear ();
+};
+
+/**
+ * Axis-aligned bounding boxes stored as a structure of arrays of centers
+ * and half extents, for batch culling.
+ */
+class AabbArray {
+public:
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> extentX;
+    std::vector<float> extentY;
+    std::vector<float> extentZ;
+
+    /** Culling state, one entry per block of 8 boxes. */
+    std::vector<u8> lastPlane;
+
+public:
+    size_t size () const { return x.size(); }
+
+    void add (const Aabb &aabb);
+
+    void set (const size_t i, const Aabb &aabb);
+
+    void clear ();
+};
+
+/**
+ * View frustum as six inward facing planes. A point p is inside plane
+ * (a, b, c, d) when a * p.x + b * p.y + c * p.z + d >= 0.
+ */
+class Frustum {
+public:
+    enum Plane { kLeft, kRight, kBottom, kTop, kNear, kFar, kPlaneCount };
+
+public:
+    /** Default Constructor. Contains everything. */
+    Frustum ();
+
+    /**
+     * Extract the frustum of a view-projection matrix, i.e. the volume
+     * which it maps into the OpenGL clip volume -w <= x, y, z <= w.
+     * Bounds passed to the tests must be in the space the matrix
+     * transforms from (world space for projection * view).
+     */
+    explicit Frustum (const Mat4f &viewProjection);
+
+    void set (const Mat4f &viewProjection);
+
+    /**
+     * Get a plane as (a, b, c, d), with (a, b, c) unit length.
+     */
+    const Vec4f& plane (const Plane p) const { return mPlanes[p]; }
+
+    /** Test if frustum contains point. */
+    friend bool contains (const Frustum &frustum, const Vec3f &point);
+
+    /**
+     * Test if a sphere is at least partly inside the frustum. Conservative
+     * near the corners of the frustum, where a sphere outside it may
+     * still pass.
+     */
+    friend bool intersects (const Frustum &frustum, const Sphere &sphere);
+
+    /**
+     * Test if a box is at least partly inside the frustum. Conservative
+     * in the same way as for spheres.
+     */
+    friend bool intersects (const Frustum &frustum, const Aabb &aabb);
+
+    /**
+     * Test every sphere against the frustum. Bit i % 64 of visible[i / 64]
+     * is set if sphere i passes intersects(); visible is resized to fit.
+     * Updates spheres.lastPlane.
+     */
+    void cull (SphereArray &spheres, std::vector<u64> &visible) const;
+
+    /**
+     * Test every box against the frustum, as above.
+     */
+    void cull (AabbArray &boxes, std::vector<u64> &visible) const;
+
+private:
+    Vec4f mPlanes[kPlaneCount];
+};
+
+// --------------------------------------------------------------------------
+
+inline void SphereArray::add (const Sphere &sphere) {
+    x.push_back(sphere.center.x);
+    y.push_back(sphere.center.y);
+    z.push_back(sphere.center.z);
+    radius.push_back(sphere.radius);
+}
+
+inline void SphereArray::set (const size_t i, const Sphere &sphere) {
+    x[i] = sphere.center.x;
+    y[i] = sphere.center.y;
+    z[i] = sphere.center.z;
+    radius[i] = sphere.radius;
+}
+
+inline void SphereArray::clear () {
+    x.clear();
+    y.clear();
+    z.clear();
+    radius.clear();
+    lastPlane.clear();
+}
+
+inline void AabbArray::add (const Aabb &aabb) {
+    const Vec3f c = aabb.center();
+    const Vec3f e = aabb.max - c;
+
+    x.push_back(c.x);
+    y.push_back(c.y);
+    z.push_back(c.z);
+    extentX.push_back(e.x);
+    extentY.push_back(e.y);
+    extentZ.push_back(e.z);
+}
+
+inline void AabbArray::set (const size_t i, const Aabb &aabb) {
+    const Vec3f c = aabb.center();
+    const Vec3f e = aabb.max - c;
+
+    x[i] = c.x;
+    y[i] = c.y;
+    z[i] = c.z;
+    extentX[i] = e.x;
+    extentY[i] = e.y;
+    extentZ[i] = e.z;
+}
+
+inline void AabbArray::clear () {
+    x.clear();
+    y.clear();
+    z.clear();
+    extentX.clear();
+    extentY.clear();
+    extentZ.clear();
+    lastPlane.clear();
+}
+
+inline Frustum::Frustum (const Mat4f &viewProjection) {
+    set(viewProjection);
+}
+
+inline bool contains (const Frustum &frustum, const Vec3f &point) {
+    for (const Vec4f &p : frustum.mPlanes) {
+        if (p.x * point.x + p.y * point.y + p.z * point.z + p.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool intersects (const Frustum &frustum, const Sphere &sphere) {
+    const Vec3f &c = sphere.center;
+    for (const Vec4f &p : frustum.mPlanes) {
+        if (p.x * c.x + p.y * c.y + p.z * c.z + p.w < -sphere.radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Compare the distance of the box's center against its projected half
+// extent along each plane normal.
+inline bool intersects (const Frustum &frustum, const Aabb &aabb) {
+    const Vec3f c = aabb.center();
+    const Vec3f e = aabb.max - c;
+    for (const Vec4f &p : frustum.mPlanes) {
+        const float d = p.x * c.x + p.y * c.y + p.z * c.z + p.w;
+        const float r = fabsf(p.x) * e.x + fabsf(p.y) * e.y + fabsf(p.z) * e.z;
+        if (d + r < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_FRUSTUM_H */
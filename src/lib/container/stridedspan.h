@@ -0,0 +1,101 @@
+/*---  StridedSpan.h - Strided Array View  -------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Defines a non-owning view of every n'th byte offset in an array.
+ */
+#ifndef __SGE_STRIDEDSPAN_H
+#define __SGE_STRIDEDSPAN_H
+
+#include <type_traits>
+#include <vector>
+
+#include "../sys/types.h"
+
+/**
+ * Non-owning view of count elements of type T, spaced stride bytes apart.
+ * Used to address one member of an array of structs in place, e.g. the
+ * positions of a vertex array:
+ *
+ * <pre>
+ *   StridedSpan<Vec3f> p(&verts[0].position, verts.size(), sizeof(Vertex));
+ * </pre>
+ *
+ * A StridedSpan<T> converts implicitly to a StridedSpan<const T>.
+ */
+template <typename T>
+class StridedSpan {
+public:
+    /** Empty span. */
+    StridedSpan ()
+          : mData{nullptr}, mCount{0}, mStride{sizeof(T)} { }
+
+    /**
+     * View count elements starting at data.
+     * @param pStride Distance in bytes between elements. Defaults to a
+     *                tightly packed array of T.
+     */
+    StridedSpan (T *data, const size_t count, const size_t pStride = sizeof(T))
+          : mData{data}, mCount{count}, mStride{pStride} { }
+
+    /** View every element of a vector. */
+    StridedSpan (std::vector<typename std::remove_const<T>::type> &v)
+          : mData{v.data()}, mCount{v.size()}, mStride{sizeof(T)} { }
+
+    /** View every element of a const vector. Only valid for const T. */
+    StridedSpan (const std::vector<typename std::remove_const<T>::type> &v)
+          : mData{v.data()}, mCount{v.size()}, mStride{sizeof(T)} { }
+
+    /** Non-const to const conversion. */
+    template <typename U,
+              typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+    StridedSpan (const StridedSpan<U> &other)
+          : mData{other.data()}, mCount{other.size()}, mStride{other.stride()} { }
+
+    T *data () const { return mData; }
+
+    size_t size () const { return mCount; }
+
+    size_t stride () const { return mStride; }
+
+    bool empty () const { return mCount == 0; }
+
+    /** True if the elements are tightly packed. */
+    bool isContiguous () const { return mStride == sizeof(T); }
+
+    /** Element access. */
+    T &operator[] (const size_t i) const;
+
+    /**
+     * Get a view of count elements starting at element first.
+     */
+    StridedSpan<T> subspan (const size_t first, const size_t count) const;
+
+private:
+    typedef typename std::conditional<std::is_const<T>::value,
+                                      const u8, u8>::type Byte;
+
+    T *mData;
+    size_t mCount;
+    size_t mStride;
+};
+
+// --------------------------------------------------------------------------
+
+template <typename T>
+inline T &StridedSpan<T>::operator[] (const size_t i) const {
+    return *reinterpret_cast<T *>(reinterpret_cast<Byte *>(mData) + i * mStride);
+}
+
+template <typename T>
+inline StridedSpan<T> StridedSpan<T>::subspan (const size_t first,
+                                               const size_t count) const {
+    return StridedSpan<T>(&(*this)[first], count, mStride);
+}
+
+#endif /* __SGE_STRIDEDSPAN_H */
@@ -0,0 +1,520 @@
+//
+// Mesh Decimation Implementation.
+//
+#include "../lib.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <queue>
+
+namespace sge {
+
+namespace {
+
+constexpr u32 kNone = 0xFFFFFFFF;
+
+// Cosine of the largest angle a collapse may turn a triangle through.
+constexpr float kMinTurnCos = 0.25f;
+
+// Weight of border and seam planes, per squared unit of edge length.
+constexpr double kBorderWeight = 10.0;
+
+enum VertexKind {
+    kManifold, /**< One vertex, inside the surface. */
+    kBorder,   /**< One vertex, on a single open border. */
+    kSeam,     /**< Two vertices, either side of a single seam. */
+    kLocked
+};
+
+// Weighted sum of squared distances to planes: p'Ap + 2b'p + c.
+struct Quadric {
+    double a00 = 0.0, a01 = 0.0, a02 = 0.0, a11 = 0.0, a12 = 0.0, a22 = 0.0;
+    double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+    double c = 0.0;
+    double w = 0.0; // Total weight
+
+    // Add the plane n.p + d = 0, n unit length.
+    void addPlane (const Vec3f &n, const float d, const double weight) {
+        a00 += weight * n.x * n.x;
+        a01 += weight * n.x * n.y;
+        a02 += weight * n.x * n.z;
+        a11 += weight * n.y * n.y;
+        a12 += weight * n.y * n.z;
+        a22 += weight * n.z * n.z;
+        b0 += weight * n.x * d;
+        b1 += weight * n.y * d;
+        b2 += weight * n.z * d;
+        c += weight * d * d;
+        w += weight;
+    }
+
+    Quadric &operator+= (const Quadric &q) {
+        a00 += q.a00; a01 += q.a01; a02 += q.a02;
+        a11 += q.a11; a12 += q.a12; a22 += q.a22;
+        b0 += q.b0; b1 += q.b1; b2 += q.b2;
+        c += q.c;
+        w += q.w;
+        return *this;
+    }
+
+    double eval (const Vec3f &p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        return a00 * x * x + a11 * y * y + a22 * z * z +
+               2.0 * (a01 * x * y + a02 * x * z + a12 * y * z + b0 * x + b1 * y + b2 * z) + c;
+    }
+};
+
+// Move every vertex at position group from onto group to.
+struct Collapse {
+    float cost; // Mean squared distance from the planes of both groups.
+    u32 from;
+    u32 to;
+    u32 fromVersion;
+    u32 toVersion;
+
+    bool operator> (const Collapse &other) const { return cost > other.cost; }
+};
+
+inline u32 floatBits (const float f) {
+    const float z = f + 0.0f; // -0 + 0 = +0
+    u32 b;
+    std::memcpy(&b, &z, sizeof(b));
+    return b;
+}
+
+inline bool samePosition (const Vec3f &a, const Vec3f &b) {
+    return floatBits(a.x) == floatBits(b.x) && floatBits(a.y) == floatBits(b.y) &&
+           floatBits(a.z) == floatBits(b.z);
+}
+
+inline u32 positionHash (const Vec3f &p) {
+    u32 h = floatBits(p.x) * 73856093u ^ floatBits(p.y) * 19349663u ^ floatBits(p.z) * 83492791u;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return h;
+}
+
+class Decimator {
+public:
+    explicit Decimator (const Mesh &mesh);
+
+    /** Collapse edges until at most target triangles are left. */
+    void run (const u32 target);
+
+    MeshLod snapshot () const;
+
+private:
+    void groupPositions ();
+    void classify (const u32 g);
+    void liveTris (const u32 g);
+    void neighbours (const u32 g, std::vector<u32> &out) const;
+    u32 corner (const u32 t, const u32 g) const;
+    bool hasGroup (const u32 t, const u32 g) const;
+    Vec3f triNormal (const u32 t) const;
+    void push (const u32 from, const u32 to);
+    bool collapse (const Collapse &c);
+
+    const Mesh &mMesh;
+    std::vector<u32> mIndices;
+    std::vector<bool> mDead;      // Per triangle
+    u32 mTriCount;
+    u32 mLiveCount;
+
+    std::vector<u32> mGroup;      // Position group of each vertex
+    std::vector<Vec3f> mPosition; // Per group
+    std::vector<std::vector<u32>> mTris;
+    std::vector<VertexKind> mKind;
+    std::vector<Quadric> mQuadric;
+    std::vector<u32> mVersion;
+    std::vector<bool> mRemoved;
+
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> mQueue;
+    float mError;
+
+    // Scratch space for collapse().
+    std::vector<u32> mFromNeighbours;
+    std::vector<u32> mToNeighbours;
+    std::vector<u32> mEdgeTris;
+    std::vector<std::pair<u32, u32>> mWedgeMap;
+};
+
+Decimator::Decimator (const Mesh &mesh)
+      : mMesh(mesh), mIndices(mesh.indices), mTriCount(mesh.faceCount()),
+        mLiveCount(0), mError(0.0f) {
+    mIndices.resize(mTriCount * 3);
+    mDead.assign(mTriCount, false);
+    groupPositions();
+
+    // Triangles around each group. Triangles with two corners at the same
+    // position have no area and are dropped.
+    const u32 groups = static_cast<u32>(mPosition.size());
+    mTris.resize(groups);
+    for (u32 t = 0; t < mTriCount; ++t) {
+        const u32 g0 = mGroup[mIndices[t * 3]];
+        const u32 g1 = mGroup[mIndices[t * 3 + 1]];
+        const u32 g2 = mGroup[mIndices[t * 3 + 2]];
+        if (g0 == g1 || g1 == g2 || g2 == g0) {
+            mDead[t] = true;
+            continue;
+        }
+        mTris[g0].push_back(t);
+        mTris[g1].push_back(t);
+        mTris[g2].push_back(t);
+        ++mLiveCount;
+    }
+
+    // Surface quadrics, weighted by area.
+    mQuadric.resize(groups);
+    for (u32 t = 0; t < mTriCount; ++t) {
+        if (mDead[t]) {
+            continue;
+        }
+        const Vec3f n = triNormal(t);
+        const float area2 = n.mag();
+        if (area2 > 0.0f) {
+            const Vec3f u = n / area2;
+            const float d = -u.dot(mPosition[mGroup[mIndices[t * 3]]]);
+            for (u32 k = 0; k < 3; ++k) {
+                mQuadric[mGroup[mIndices[t * 3 + k]]].addPlane(u, d, area2 * 0.5);
+            }
+        }
+    }
+
+    mKind.resize(groups);
+    for (u32 g = 0; g < groups; ++g) {
+        classify(g);
+    }
+
+    mVersion.assign(groups, 0);
+    mRemoved.assign(groups, false);
+
+    std::vector<u32> n;
+    for (u32 g = 0; g < groups; ++g) {
+        neighbours(g, n);
+        for (const u32 to : n) {
+            push(g, to);
+        }
+    }
+}
+
+// Give every distinct position an id, numbered in order of first use.
+void Decimator::groupPositions () {
+    const u32 n = static_cast<u32>(mMesh.vertices.size());
+    u32 size = 1;
+    while (size < n * 2 + 1) {
+        size <<= 1;
+    }
+    std::vector<u32> table(size, kNone);
+    const u32 mask = size - 1;
+
+    mGroup.resize(n);
+    for (u32 i = 0; i < n; ++i) {
+        const Vec3f &p = mMesh.vertices[i].position;
+        u32 slot = positionHash(p) & mask;
+        while (table[slot] != kNone && !samePosition(mMesh.vertices[table[slot]].position, p)) {
+            slot = (slot + 1) & mask;
+        }
+        if (table[slot] == kNone) {
+            table[slot] = i;
+            mGroup[i] = static_cast<u32>(mPosition.size());
+            mPosition.push_back(p);
+        } else {
+            mGroup[i] = mGroup[table[slot]];
+        }
+    }
+}
+
+// Decide how group g may move from its vertices and edges, and add planes
+// along any borders or seams to its quadric.
+void Decimator::classify (const u32 g) {
+    const std::vector<u32> &tris = mTris[g];
+    if (tris.empty()) {
+        mKind[g] = kLocked;
+        return;
+    }
+
+    u32 wedges[2] = {kNone, kNone};
+    u32 wedgeCount = 0;
+    u32 borders = 0;
+    u32 seams = 0;
+    bool complex = false;
+
+    std::vector<u32> n;
+    neighbours(g, n);
+    for (const u32 t : tris) {
+        const u32 w = corner(t, g);
+        if (w != wedges[0] && w != wedges[1]) {
+            if (wedgeCount < 2) {
+                wedges[wedgeCount] = w;
+            }
+            ++wedgeCount;
+        }
+    }
+
+    for (const u32 other : n) {
+        u32 edge[3];
+        u32 count = 0;
+        for (const u32 t : tris) {
+            if (hasGroup(t, other)) {
+                if (count < 3) {
+                    edge[count] = t;
+                }
+                ++count;
+            }
+        }
+
+        bool isBorder = (count == 1);
+        bool isSeam = (count == 2 && (corner(edge[0], g) != corner(edge[1], g) ||
+                                      corner(edge[0], other) != corner(edge[1], other)));
+        complex = complex || count > 2;
+
+        if (isBorder || isSeam) {
+            // A plane through the edge, perpendicular to the surface.
+            const Vec3f e = mPosition[other] - mPosition[g];
+            const Vec3f p = e.cross(triNormal(edge[0]));
+            const float len = p.mag();
+            if (len > 0.0f) {
+                const Vec3f u = p / len;
+                mQuadric[g].addPlane(u, -u.dot(mPosition[g]), e.magSq() * kBorderWeight);
+            }
+        }
+        borders += isBorder ? 1 : 0;
+        seams += isSeam ? 1 : 0;
+    }
+
+    if (complex) {
+        mKind[g] = kLocked;
+    } else if (wedgeCount == 1 && borders == 0) {
+        mKind[g] = kManifold;
+    } else if (wedgeCount == 1 && borders == 2) {
+        mKind[g] = kBorder;
+    } else if (wedgeCount == 2 && borders == 0 && seams == 2) {
+        mKind[g] = kSeam;
+    } else {
+        mKind[g] = kLocked;
+    }
+}
+
+// Drop dead triangles from around g.
+void Decimator::liveTris (const u32 g) {
+    std::vector<u32> &tris = mTris[g];
+    tris.erase(std::remove_if(tris.begin(), tris.end(),
+                              [this](const u32 t) { return static_cast<bool>(mDead[t]); }),
+               tris.end());
+}
+
+void Decimator::neighbours (const u32 g, std::vector<u32> &out) const {
+    out.clear();
+    for (const u32 t : mTris[g]) {
+        if (mDead[t]) {
+            continue;
+        }
+        for (u32 k = 0; k < 3; ++k) {
+            const u32 other = mGroup[mIndices[t * 3 + k]];
+            if (other != g && std::find(out.begin(), out.end(), other) == out.end()) {
+                out.push_back(other);
+            }
+        }
+    }
+}
+
+// The vertex of triangle t in group g.
+u32 Decimator::corner (const u32 t, const u32 g) const {
+    for (u32 k = 0; k < 3; ++k) {
+        if (mGroup[mIndices[t * 3 + k]] == g) {
+            return mIndices[t * 3 + k];
+        }
+    }
+    return kNone;
+}
+
+bool Decimator::hasGroup (const u32 t, const u32 g) const {
+    return corner(t, g) != kNone;
+}
+
+// Twice the area times the unit normal.
+Vec3f Decimator::triNormal (const u32 t) const {
+    const Vec3f &a = mPosition[mGroup[mIndices[t * 3]]];
+    const Vec3f &b = mPosition[mGroup[mIndices[t * 3 + 1]]];
+    const Vec3f &c = mPosition[mGroup[mIndices[t * 3 + 2]]];
+    return (b - a).cross(c - a);
+}
+
+void Decimator::push (const u32 from, const u32 to) {
+    if (mKind[from] == kLocked || (mKind[from] != kManifold && mKind[to] == kManifold)) {
+        return;
+    }
+
+    Quadric q = mQuadric[from];
+    q += mQuadric[to];
+    const double cost = (q.w > 0.0) ? std::max(q.eval(mPosition[to]) / q.w, 0.0) : 0.0;
+    mQueue.push(Collapse{static_cast<float>(cost), from, to, mVersion[from], mVersion[to]});
+}
+
+bool Decimator::collapse (const Collapse &c) {
+    const u32 from = c.from;
+    const u32 to = c.to;
+    if (mRemoved[from] || mRemoved[to] ||
+        mVersion[from] != c.fromVersion || mVersion[to] != c.toVersion) {
+        return false;
+    }
+
+    liveTris(from);
+    const std::vector<u32> &tris = mTris[from];
+
+    mEdgeTris.clear();
+    for (const u32 t : tris) {
+        if (hasGroup(t, to)) {
+            mEdgeTris.push_back(t);
+        }
+    }
+
+    // Borders and seams only move along themselves.
+    const u32 edgeCount = static_cast<u32>(mEdgeTris.size());
+    switch (mKind[from]) {
+    case kManifold:
+        if (edgeCount != 2) {
+            return false;
+        }
+        break;
+    case kBorder:
+        if (edgeCount != 1) {
+            return false;
+        }
+        break;
+    case kSeam:
+        if (edgeCount != 2 || corner(mEdgeTris[0], from) == corner(mEdgeTris[1], from)) {
+            return false;
+        }
+        break;
+    default:
+        return false;
+    }
+
+    // Only the triangles on the edge may be shared by both ends, or the
+    // surface would pinch.
+    neighbours(from, mFromNeighbours);
+    neighbours(to, mToNeighbours);
+    u32 shared = 0;
+    for (const u32 n : mFromNeighbours) {
+        if (std::find(mToNeighbours.begin(), mToNeighbours.end(), n) != mToNeighbours.end()) {
+            ++shared;
+        }
+    }
+    if (shared != edgeCount) {
+        return false;
+    }
+
+    // Each vertex at from takes the attributes of the vertex at to on the
+    // same side of any seam.
+    mWedgeMap.clear();
+    for (const u32 t : mEdgeTris) {
+        const u32 wf = corner(t, from);
+        const u32 wt = corner(t, to);
+        for (const auto &m : mWedgeMap) {
+            if (m.first == wf && m.second != wt) {
+                return false;
+            }
+        }
+        mWedgeMap.emplace_back(wf, wt);
+    }
+    auto mapped = [this](const u32 w) {
+        for (const auto &m : mWedgeMap) {
+            if (m.first == w) {
+                return m.second;
+            }
+        }
+        return kNone;
+    };
+
+    // No triangle may flip over, or turn so far it is nearly edge on to
+    // where it faced.
+    for (const u32 t : tris) {
+        if (hasGroup(t, to)) {
+            continue;
+        }
+        if (mapped(corner(t, from)) == kNone) {
+            return false;
+        }
+        const Vec3f before = triNormal(t);
+        const Vec3f saved = mPosition[from];
+        mPosition[from] = mPosition[to];
+        const Vec3f after = triNormal(t);
+        mPosition[from] = saved;
+        if (after.dot(before) <= kMinTurnCos * after.mag() * before.mag()) {
+            return false;
+        }
+    }
+
+    // Apply.
+    for (const u32 t : mEdgeTris) {
+        mDead[t] = true;
+        --mLiveCount;
+    }
+    for (const u32 t : tris) {
+        if (mDead[t]) {
+            continue;
+        }
+        for (u32 k = 0; k < 3; ++k) {
+            u32 &w = mIndices[t * 3 + k];
+            if (mGroup[w] == from) {
+                w = mapped(w);
+            }
+        }
+        mTris[to].push_back(t);
+    }
+    mTris[from].clear();
+    mRemoved[from] = true;
+    mQuadric[to] += mQuadric[from];
+    ++mVersion[to];
+    mError = std::max(mError, sqrtf(c.cost));
+
+    liveTris(to);
+    neighbours(to, mToNeighbours);
+    for (const u32 n : mToNeighbours) {
+        push(n, to);
+        push(to, n);
+    }
+    return true;
+}
+
+void Decimator::run (const u32 target) {
+    while (mLiveCount > target && !mQueue.empty()) {
+        const Collapse c = mQueue.top();
+        mQueue.pop();
+        collapse(c);
+    }
+}
+
+MeshLod Decimator::snapshot () const {
+    MeshLod lod;
+    lod.mesh.vertices = mMesh.vertices;
+    lod.mesh.indices.reserve(mLiveCount * 3);
+    for (u32 t = 0; t < mTriCount; ++t) {
+        if (!mDead[t]) {
+            lod.mesh.addFace(mIndices[t * 3], mIndices[t * 3 + 1], mIndices[t * 3 + 2]);
+        }
+    }
+    optimizeVertexFetch(lod.mesh.vertices, lod.mesh.indices);
+
+    lod.ratio = (mTriCount > 0) ? static_cast<float>(mLiveCount) / mTriCount : 1.0f;
+    lod.error = mError;
+    return lod;
+}
+
+} /* namespace */
+
+std::vector<MeshLod> buildLodChain (const Mesh &mesh, const std::vector<float> &ratios) {
+    Decimator d(mesh);
+    std::vector<MeshLod> lods;
+    for (const float ratio : ratios) {
+        d.run(static_cast<u32>(std::max(ratio, 0.0f) * mesh.faceCount()));
+        lods.push_back(d.snapshot());
+    }
+    return lods;
+}
+
+} /* namespace sge */
@@ -0,0 +1,93 @@
+/*---  Decimate.h - Quadric Mesh Decimation  ------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Reduce the triangle count of a Mesh for distant levels of detail.
+ *
+ * Edges are collapsed cheapest first from a heap, costed with Garland and
+ * Heckbert's quadric error metric. Each collapse moves one vertex onto a
+ * neighbour, so no new vertex data is created and texture coordinates,
+ * normals and colors stay exact.
+ *
+ * Vertices are grouped by position. A group with one vertex inside the
+ * surface can collapse along any edge. A group on an open border, or on a
+ * seam where two vertices share a position but not their other attributes,
+ * only collapses along that border or seam, and borders and seams add
+ * quadrics which keep them in shape. Any other group, e.g. a corner of a
+ * seam or a non-manifold vertex, is left where it is.
+ */
+#ifndef __SGE_DECIMATE_H
+#define __SGE_DECIMATE_H
+
+#include <vector>
+
+namespace sge {
+
+/**
+ * One level of detail of a mesh.
+ */
+struct MeshLod {
+    Mesh mesh;
+    float ratio; /**< Triangles kept, as a fraction of the original. */
+    float error; /**< Estimated distance from the original surface, in mesh units. */
+};
+
+/**
+ * Decimate mesh to ratio of its triangles. The result may have more
+ * triangles if no further collapse is allowed. Vertices no triangle uses
+ * are removed.
+ */
+MeshLod decimate (const Mesh &mesh, const float ratio);
+
+/**
+ * Decimate mesh in a single pass to each ratio, which should decrease,
+ * e.g. {1.0f, 0.5f, 0.25f, 0.125f}. Every level is measured against the
+ * original mesh, so errors increase along the chain.
+ */
+std::vector<MeshLod> buildLodChain (const Mesh &mesh, const std::vector<float> &ratios);
+
+/**
+ * Size in pixels of one mesh unit at distance from a perspective camera.
+ *
+ * @param fovY Vertical field of view, in radians.
+ * @param viewportHeight Viewport height, in pixels.
+ */
+float lodErrorScale (const float distance, const float fovY, const float viewportHeight);
+
+/**
+ * Choose the coarsest level whose error, multiplied by errorScale, is
+ * within maxError, e.g. using lodErrorScale() and a tolerance of one
+ * pixel. Returns 0 if none are.
+ */
+size_t selectLod (const std::vector<MeshLod> &lods, const float errorScale,
+                  const float maxError);
+
+// --------------------------------------------------------------------------
+
+inline MeshLod decimate (const Mesh &mesh, const float ratio) {
+    return buildLodChain(mesh, std::vector<float>(1, ratio))[0];
+}
+
+inline float lodErrorScale (const float distance, const float fovY, const float viewportHeight) {
+    return viewportHeight / (2.0f * distance * tanf(fovY * 0.5f));
+}
+
+inline size_t selectLod (const std::vector<MeshLod> &lods, const float errorScale,
+                         const float maxError) {
+    size_t best = 0;
+    for (size_t i = 0; i < lods.size(); ++i) {
+        if (lods[i].error * errorScale <= maxError) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_DECIMATE_H */
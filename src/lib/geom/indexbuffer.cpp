@@ -0,0 +1,156 @@
+//
+// IndexBuffer Implementation.
+//
+#include "../lib.h"
+
+#include <cstring>
+
+namespace sge {
+
+// Triangles searched ahead of the input order for one which continues
+// the current strip.
+static constexpr u32 kStripWindow = 16;
+
+// Find the corner of triangle t at which it continues edge (a, b), i.e.
+// with a and b as its first two corners in winding order.
+static u32 findEdge (const u32 *t, const u32 a, const u32 b) {
+    for (u32 k = 0; k < 3; ++k) {
+        if (t[k] == a && t[(k + 1) % 3] == b) {
+            return k;
+        }
+    }
+    return 3;
+}
+
+std::vector<u32> stripify (const std::vector<u32> &indices) {
+    const u32 triCount = static_cast<u32>(indices.size() / 3);
+
+    std::vector<u32> strip;
+    strip.reserve(indices.size() / 2 + 16);
+
+    std::vector<u32> window;
+    window.reserve(kStripWindow);
+    u32 next = 0;
+
+    // Last two vertices of the strip, and whether the next triangle is
+    // odd, i.e. wound (q, p, w) rather than (p, q, w).
+    u32 p = 0;
+    u32 q = 0;
+    bool odd = false;
+    bool open = false;
+
+    while (true) {
+        while (window.size() < kStripWindow && next < triCount) {
+            window.push_back(next++);
+        }
+        if (window.empty()) {
+            break;
+        }
+
+        if (open) {
+            const u32 a = odd ? q : p;
+            const u32 b = odd ? p : q;
+            size_t found = window.size();
+            u32 corner = 3;
+            for (size_t i = 0; i < window.size() && corner == 3; ++i) {
+                corner = findEdge(&indices[window[i] * 3], a, b);
+                found = i;
+            }
+            if (corner < 3) {
+                const u32 w = indices[window[found] * 3 + (corner + 2) % 3];
+                strip.push_back(w);
+                p = q;
+                q = w;
+                odd = !odd;
+                window.erase(window.begin() + found);
+                continue;
+            }
+        }
+
+        // Start a new strip with the oldest triangle, rotated so that the
+        // second triangle of the strip can follow it if possible.
+        const u32 *t = &indices[window[0] * 3];
+        u32 start = 3;
+        for (u32 k = 0; k < 3 && start == 3; ++k) {
+            const u32 b = t[(k + 1) % 3];
+            const u32 c = t[(k + 2) % 3];
+            for (size_t i = 1; i < window.size(); ++i) {
+                if (findEdge(&indices[window[i] * 3], c, b) < 3) {
+                    start = k;
+                    break;
+                }
+            }
+        }
+        if (start == 3) {
+            start = 0;
+        }
+
+        if (!strip.empty()) {
+            strip.push_back(kRestartIndex);
+        }
+        strip.push_back(t[start]);
+        strip.push_back(t[(start + 1) % 3]);
+        strip.push_back(t[(start + 2) % 3]);
+        p = t[(start + 1) % 3];
+        q = t[(start + 2) % 3];
+        odd = true;
+        open = true;
+        window.erase(window.begin());
+    }
+
+    return strip;
+}
+
+std::vector<u32> unstripify (const std::vector<u32> &strip) {
+    std::vector<u32> indices;
+    indices.reserve(strip.size() * 3);
+
+    size_t begin = 0;
+    for (size_t i = 0; i < strip.size(); ++i) {
+        if (strip[i] == kRestartIndex) {
+            begin = i + 1;
+            continue;
+        }
+        if (i < begin + 2) {
+            continue;
+        }
+
+        const bool odd = ((i - begin) % 2) == 1;
+        const u32 a = odd ? strip[i - 1] : strip[i - 2];
+        const u32 b = odd ? strip[i - 2] : strip[i - 1];
+        const u32 c = strip[i];
+        if (a != b && b != c && c != a) {
+            indices.push_back(a);
+            indices.push_back(b);
+            indices.push_back(c);
+        }
+    }
+
+    return indices;
+}
+
+IndexBuffer::IndexBuffer (const std::vector<u32> &indices, const u32 vertexCount,
+                          const PrimitiveType primitive)
+      : mPrimitive{primitive} {
+    const std::vector<u32> strip = (primitive == kTriangleStrip) ? stripify(indices)
+                                                                 : std::vector<u32>();
+    const std::vector<u32> &src = (primitive == kTriangleStrip) ? strip : indices;
+
+    mCount = static_cast<u32>(src.size());
+    if (fits16(vertexCount, primitive)) {
+        mFormat = kIndex16;
+        mData.resize(src.size() * sizeof(u16));
+        u16 *dst = reinterpret_cast<u16 *>(mData.data());
+        for (size_t i = 0; i < src.size(); ++i) {
+            dst[i] = static_cast<u16>(src[i]); // kRestartIndex truncates to 0xFFFF
+        }
+    } else {
+        mFormat = kIndex32;
+        mData.resize(src.size() * sizeof(u32));
+        if (!src.empty()) {
+            memcpy(mData.data(), src.data(), mData.size());
+        }
+    }
+}
+
+} /* namespace sge */
@@ -0,0 +1,174 @@
+/*---  IndexBuffer.h - Compact Index Lists and Triangle Strips  ------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Pack triangle indices into the smallest index format which holds
+ *   them, optionally as triangle strips separated by a restart index.
+ *
+ * Most meshes have fewer than 65536 vertices, so their indices fit in 16
+ * bits, halving the index memory and upload. Converting a cache optimised
+ * triangle list to strips cuts the index count further, to a little over
+ * one index per triangle on regular meshes; strips are drawn with
+ * primitive restart enabled so that unconnected strips need no degenerate
+ * triangles.
+ */
+#ifndef __SGE_INDEXBUFFER_H
+#define __SGE_INDEXBUFFER_H
+
+#include <vector>
+
+namespace sge {
+
+enum IndexFormat {
+    kIndex16,
+    kIndex32
+};
+
+enum PrimitiveType {
+    kTriangles,
+    kTriangleStrip
+};
+
+/** Index ending one triangle strip and starting the next, in u32 index lists. */
+static constexpr u32 kRestartIndex = 0xFFFFFFFF;
+
+/**
+ * Convert a triangle list to triangle strips separated by kRestartIndex.
+ * Triangles are taken close to their order in indices, so a cache
+ * optimised list stays cache friendly. Every triangle keeps its winding.
+ */
+std::vector<u32> stripify (const std::vector<u32> &indices);
+
+/**
+ * Convert triangle strips separated by kRestartIndex back to a triangle
+ * list, dropping degenerate triangles.
+ */
+std::vector<u32> unstripify (const std::vector<u32> &strip);
+
+/**
+ * Indices ready to send to the GPU, stored in 16 bits when every vertex
+ * can be addressed in 16 bits and 32 bits otherwise.
+ */
+class IndexBuffer {
+public:
+    /** Empty triangle list. */
+    IndexBuffer ();
+
+    /**
+     * Pack a triangle list of a mesh with vertexCount vertices, converting
+     * it to strips with stripify() if primitive is kTriangleStrip.
+     */
+    IndexBuffer (const std::vector<u32> &indices, const u32 vertexCount,
+                 const PrimitiveType primitive = kTriangles);
+
+    /**
+     * Copy count indices already packed in format, e.g. from a MeshCache.
+     */
+    IndexBuffer (const IndexFormat format, const PrimitiveType primitive, const u32 count,
+                 const void *data);
+
+    IndexFormat format () const;
+
+    PrimitiveType primitive () const;
+
+    /**
+     * @return Number of indices, including restart indices.
+     */
+    u32 count () const;
+
+    /**
+     * @return Size of each index in bytes.
+     */
+    u32 indexSize () const;
+
+    /**
+     * @return Size of the index data in bytes.
+     */
+    size_t size () const;
+
+    const u8 *data () const;
+
+    /**
+     * @return Index separating strips: all bits set in the index format.
+     */
+    u32 restartIndex () const;
+
+    /**
+     * Get index i, widened to 32 bits. Restart indices are returned as
+     * restartIndex().
+     */
+    u32 operator[] (const size_t i) const;
+
+    /**
+     * Test if a mesh with vertexCount vertices can use 16 bit indices.
+     * Strips reserve 0xFFFF for the restart index.
+     */
+    static bool fits16 (const u32 vertexCount, const PrimitiveType primitive);
+
+private:
+    IndexFormat mFormat;
+    PrimitiveType mPrimitive;
+    u32 mCount;
+    std::vector<u8> mData;
+};
+
+// --------------------------------------------------------------------------
+
+inline IndexBuffer::IndexBuffer ()
+      : mFormat{kIndex16}, mPrimitive{kTriangles}, mCount{0} {
+}
+
+inline IndexBuffer::IndexBuffer (const IndexFormat format, const PrimitiveType primitive,
+                                 const u32 count, const void *data)
+      : mFormat{format}, mPrimitive{primitive}, mCount{count},
+        mData(static_cast<const u8 *>(data),
+              static_cast<const u8 *>(data) + count * ((format == kIndex16) ? sizeof(u16) : sizeof(u32))) {
+}
+
+inline IndexFormat IndexBuffer::format () const {
+    return mFormat;
+}
+
+inline PrimitiveType IndexBuffer::primitive () const {
+    return mPrimitive;
+}
+
+inline u32 IndexBuffer::count () const {
+    return mCount;
+}
+
+inline u32 IndexBuffer::indexSize () const {
+    return (mFormat == kIndex16) ? sizeof(u16) : sizeof(u32);
+}
+
+inline size_t IndexBuffer::size () const {
+    return mData.size();
+}
+
+inline const u8 *IndexBuffer::data () const {
+    return mData.data();
+}
+
+inline u32 IndexBuffer::restartIndex () const {
+    return (mFormat == kIndex16) ? 0xFFFF : kRestartIndex;
+}
+
+inline u32 IndexBuffer::operator[] (const size_t i) const {
+    if (mFormat == kIndex16) {
+        return reinterpret_cast<const u16 *>(mData.data())[i];
+    }
+    return reinterpret_cast<const u32 *>(mData.data())[i];
+}
+
+inline bool IndexBuffer::fits16 (const u32 vertexCount, const PrimitiveType primitive) {
+    return vertexCount <= ((primitive == kTriangleStrip) ? 0xFFFFu : 0x10000u);
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_INDEXBUFFER_H */
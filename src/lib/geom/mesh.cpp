@@ -3,11 +3,157 @@
 //
 #include "../lib.h"
 
+#include <cmath>
+#include <cstring>
 #include <iostream>
-#include <algorithm>
 
 namespace sge {
 
+namespace {
+
+constexpr u32 kNoVertex = 0xFFFFFFFF;
+
+// Every attribute of a vertex as bits: eight floats and the color.
+struct WeldKey {
+    u32 bits[9];
+
+    bool operator== (const WeldKey &other) const {
+        return std::memcmp(bits, other.bits, sizeof(bits)) == 0;
+    }
+};
+
+inline u32 floatBits (const float f) {
+    const float z = f + 0.0f; // -0 + 0 = +0
+    u32 b;
+    std::memcpy(&b, &z, sizeof(b));
+    return b;
+}
+
+WeldKey weldKey (const Vertex &v, const float invEpsilon) {
+    const float f[8] = {v.position.x, v.position.y, v.position.z,
+                        v.normal.x, v.normal.y, v.normal.z,
+                        v.texCoord.x, v.texCoord.y};
+
+    WeldKey key;
+    for (u32 k = 0; k < 8; ++k) {
+        // Cells are kept as floats so large coordinates can't overflow.
+        key.bits[k] = floatBits(invEpsilon > 0.0f ? floorf(f[k] * invEpsilon + 0.5f) : f[k]);
+    }
+    key.bits[8] = v.color.toU32();
+    return key;
+}
+
+// FNV-1a over the words, then a final mix so the low bits, which pick
+// the table slot, depend on every word.
+u32 weldHash (const WeldKey &key) {
+    u32 h = 2166136261u;
+    for (const u32 b : key.bits) {
+        h = (h ^ b) * 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+inline u32 nextPow2 (u32 x) {
+    u32 p = 1;
+    while (p < x) {
+        p <<= 1;
+    }
+    return p;
+}
+
+// Partition of parts holding a hash. The high bits of the hash choose the
+// partition and the low bits the slot, so the two stay independent.
+inline u32 weldPart (const u32 hash, const u32 parts) {
+    return static_cast<u32>((static_cast<u64>(hash) * parts) >> 32);
+}
+
+// Find the first instance of every vertex in members, which lists one
+// partition's vertices in increasing order, or of vertices 0 to count if
+// members is null.
+void weldPartition (const std::vector<WeldKey> &keys, const std::vector<u32> &hashes,
+                    const u32 *members, const u32 count, std::vector<u32> &first) {
+    // Linear probing in a table at most half full.
+    std::vector<u32> table(nextPow2(count * 2 + 1), kNoVertex);
+    const u32 mask = static_cast<u32>(table.size()) - 1;
+
+    for (u32 m = 0; m < count; ++m) {
+        const u32 i = members ? members[m] : m;
+        u32 slot = hashes[i] & mask;
+        while (table[slot] != kNoVertex && !(keys[table[slot]] == keys[i])) {
+            slot = (slot + 1) & mask;
+        }
+        if (table[slot] == kNoVertex) {
+            table[slot] = i;
+        }
+        first[i] = table[slot];
+    }
+}
+
+// Map every vertex to its index once duplicates are removed.
+// @return The number of unique vertices.
+u32 weldMap (const std::vector<Vertex> &vertices, const float epsilon,
+             const bool threaded, std::vector<u32> &remap) {
+    const u32 n = static_cast<u32>(vertices.size());
+    const float invEpsilon = (epsilon > 0.0f) ? 1.0f / epsilon : 0.0f;
+    const bool split = threaded && n > kMeshWeldGrain;
+
+    std::vector<WeldKey> keys(n);
+    std::vector<u32> hashes(n);
+    auto hashRange = [&](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            keys[i] = weldKey(vertices[i], invEpsilon);
+            hashes[i] = weldHash(keys[i]);
+        }
+    };
+
+    std::vector<u32> first(n);
+    if (split) {
+        const u32 parts = workerCount();
+        parallelFor(n, kMeshWeldGrain, hashRange);
+
+        // Bucket the vertices by partition, keeping them in order, so each
+        // thread reads only its own.
+        std::vector<u32> offsets(parts + 1, 0);
+        for (u32 i = 0; i < n; ++i) {
+            ++offsets[weldPart(hashes[i], parts) + 1];
+        }
+        for (u32 p = 0; p < parts; ++p) {
+            offsets[p + 1] += offsets[p];
+        }
+        std::vector<u32> members(n);
+        std::vector<u32> fill(offsets.begin(), offsets.end() - 1);
+        for (u32 i = 0; i < n; ++i) {
+            members[fill[weldPart(hashes[i], parts)]++] = i;
+        }
+
+        parallelFor(parts, 1, [&](const size_t begin, const size_t end) {
+            for (size_t p = begin; p < end; ++p) {
+                weldPartition(keys, hashes, members.data() + offsets[p],
+                              offsets[p + 1] - offsets[p], first);
+            }
+        });
+    } else {
+        hashRange(0, n);
+        weldPartition(keys, hashes, nullptr, n, first);
+    }
+
+    // First instances are numbered in order, which doesn't depend on how
+    // the work was split.
+    remap.resize(n);
+    u32 unique = 0;
+    for (u32 i = 0; i < n; ++i) {
+        remap[i] = (first[i] == i) ? unique++ : remap[first[i]];
+    }
+    return unique;
+}
+
+} /* namespace */
+
 void Mesh::printVertexInfo () const {
     std::cout << "Compiling Mesh: " << vertCount() << " vertices, "
               << faceCount() << " faces (" << indexCount() << ")";
@@ -18,14 +164,45 @@ void Mesh::printVertexInfo () const {
         std::cout << " Invalid";
     }
 
-    for (const Vertex &vert : vertices) {
-        std::cout << " " << std::count(std::begin(vertices), std::end(vertices), vert)
-                  << " duplicates\n";
+    std::vector<u32> remap;
+    const u32 unique = weldMap(vertices, 0.0f, false, remap);
+    std::cout << ", " << (vertCount() - unique) << " duplicates\n";
+}
+
+void Mesh::simplify (const float epsilon, const bool threaded) {
+    std::vector<u32> remap;
+    const u32 unique = weldMap(vertices, epsilon, threaded, remap);
+    if (unique == vertCount()) {
+        return;
+    }
+
+    // A first instance maps to the number of vertices kept before it.
+    std::vector<Vertex> welded;
+    welded.reserve(unique);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        if (remap[i] == welded.size()) {
+            welded.push_back(vertices[i]);
+        }
+    }
+    vertices.swap(welded);
+
+    for (u32 &index : indices) {
+        index = remap[index];
     }
 }
 
-void Mesh::simplify () {
+void Mesh::optimize () {
+    optimizeVertexCache(indices, vertCount());
+    optimizeOverdraw(indices, positions());
+    optimizeVertexFetch(vertices, indices);
+}
+
+void Mesh::generateNormals (const float smoothingAngle, const bool threaded) {
+    sge::generateNormals(*this, smoothingAngle, threaded);
+}
 
+std::vector<Vec4f> Mesh::generateTangents (const bool threaded) const {
+    return sge::generateTangents(*this, threaded);
 }
 
 } /* namespace sge */
@@ -18,6 +18,12 @@
 
 namespace sge {
 
+/** Smallest number of vertices worth handing to another thread. */
+static constexpr size_t kMeshWeldGrain = 16384;
+
+/** Faces meeting at more than this angle, 60 degrees, are not smoothed. */
+static constexpr float kDefaultSmoothingAngle = math::kPi / 3.0f;
+
 class Mesh {
 public:
     void addVertex (const Vertex &v);
@@ -35,12 +41,61 @@ public:
 
     u32 faceCount () const;
 
+    /**
+     * Print the vertex, face and duplicate vertex counts.
+     */
     void printVertexInfo () const;
 
+    /**
+     * View the position of every vertex in place, e.g. for use with
+     * transformPoints.
+     */
+    StridedSpan<Vec3f> positions ();
+    StridedSpan<const Vec3f> positions () const;
+
+    /**
+     * View the normal of every vertex in place, e.g. for use with
+     * transformDirections.
+     */
+    StridedSpan<Vec3f> normals ();
+    StridedSpan<const Vec3f> normals () const;
+
     /**
      * Identify duplicate vertex data and fix indices to share a single instance.
+     * Runs in linear time by hashing each vertex. The first instance of each
+     * vertex is kept and the order of the survivors is unchanged.
+     *
+     * With epsilon = 0, vertices weld when every attribute is bitwise equal
+     * (treating -0 as 0). Otherwise each float attribute is rounded to a
+     * grid of spacing epsilon and vertices in the same cell weld; values
+     * within epsilon of each other but either side of a cell boundary
+     * stay apart.
+     *
+     * Passing threaded = true allows meshes with more than kMeshWeldGrain
+     * vertices to be split across threads. The result is the same.
      */
-    void simplify ();
+    void simplify (const float epsilon = 0.0f, const bool threaded = false);
+
+    /**
+     * Reorder triangles for vertex cache locality and then to reduce
+     * overdraw, and reorder vertices into the order they are first used.
+     * Vertices no triangle uses are removed. See meshoptimizer.h.
+     */
+    void optimize ();
+
+    /**
+     * Replace every vertex normal with the area and angle weighted average
+     * of the faces around it, splitting vertices along edges where faces
+     * meet at more than smoothingAngle radians. See meshnormals.h.
+     */
+    void generateNormals (const float smoothingAngle = kDefaultSmoothingAngle,
+                          const bool threaded = false);
+
+    /**
+     * Compute a MikkTSpace style tangent for every vertex, with the
+     * bitangent sign in w. Needs normals and texture coordinates.
+     */
+    std::vector<Vec4f> generateTangents (const bool threaded = false) const;
 
 public:
     std::vector<Vertex> vertices;
@@ -101,6 +156,34 @@ inline u32 Mesh::faceCount () const {
     return static_cast<u32>(indices.size()) / 3;
 }
 
+inline StridedSpan<Vec3f> Mesh::positions () {
+    if (vertices.empty()) {
+        return StridedSpan<Vec3f>();
+    }
+    return StridedSpan<Vec3f>(&vertices[0].position, vertices.size(), sizeof(Vertex));
+}
+
+inline StridedSpan<const Vec3f> Mesh::positions () const {
+    if (vertices.empty()) {
+        return StridedSpan<const Vec3f>();
+    }
+    return StridedSpan<const Vec3f>(&vertices[0].position, vertices.size(), sizeof(Vertex));
+}
+
+inline StridedSpan<Vec3f> Mesh::normals () {
+    if (vertices.empty()) {
+        return StridedSpan<Vec3f>();
+    }
+    return StridedSpan<Vec3f>(&vertices[0].normal, vertices.size(), sizeof(Vertex));
+}
+
+inline StridedSpan<const Vec3f> Mesh::normals () const {
+    if (vertices.empty()) {
+        return StridedSpan<const Vec3f>();
+    }
+    return StridedSpan<const Vec3f>(&vertices[0].normal, vertices.size(), sizeof(Vertex));
+}
+
 } /* namespace sge */
 
 #endif /* __SGE_MESH_H  */
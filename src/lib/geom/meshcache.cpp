@@ -0,0 +1,276 @@
+//
+// MeshCache Implementation.
+//
+#include "../lib.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <sys/stat.h>
+#include <utility>
+
+namespace sge {
+
+static u64 alignUp (const u64 offset) {
+    return (offset + kMeshCacheAlignment - 1) & ~static_cast<u64>(kMeshCacheAlignment - 1);
+}
+
+static bool isAligned (const u64 offset) {
+    return (offset % kMeshCacheAlignment) == 0;
+}
+
+// Test that a buffer of size bytes at offset is aligned and inside a file
+// of fileSize bytes, without overflowing.
+static bool inFile (const u64 offset, const u64 size, const u64 fileSize) {
+    return isAligned(offset) && offset <= fileSize && size <= fileSize - offset;
+}
+
+// Test that each of count indices names one of vertexCount vertices, or
+// is restart where strips allow it.
+template <typename T>
+static bool indicesInRange (const T *indices, const u32 count, const u32 vertexCount, const bool strips) {
+    const T restart = static_cast<T>(~T(0));
+    for (u32 i = 0; i < count; ++i) {
+        if (indices[i] >= vertexCount && !(strips && indices[i] == restart)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MeshCache::load () {
+    MeshCacheHeader header;
+    if (!mFile.isOpen() || mFile.size() < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, mFile.data(), sizeof(header));
+
+    if (header.magic != kMeshCacheMagic || header.version != kMeshCacheVersion ||
+        header.stride == 0 || header.attribCount > kMeshCacheMaxAttribs ||
+        header.primitive > kTriangleStrip || header.lodCount == 0) {
+        return false;
+    }
+
+    mLayout = VertexLayout(header.stride);
+    for (u32 i = 0; i < header.attribCount; ++i) {
+        const MeshCacheAttrib &a = header.attribs[i];
+        if (a.components < 1 || a.components > 4 || a.type > kUnorm8 ||
+            static_cast<u64>(a.offset) + a.components * VertexLayout::typeSize(static_cast<AttribType>(a.type)) >
+                header.stride) {
+            return false;
+        }
+        mLayout.add(a.location, a.components, static_cast<AttribType>(a.type), a.offset);
+    }
+    mBounds = Aabb(Vec3f(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]),
+                   Vec3f(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]));
+    mPrimitive = static_cast<PrimitiveType>(header.primitive);
+
+    const u64 fileSize = mFile.size();
+    const u64 tableSize = static_cast<u64>(header.lodCount) * sizeof(MeshCacheLod);
+    if (tableSize > fileSize - sizeof(header)) {
+        return false;
+    }
+    mLods.resize(header.lodCount);
+    memcpy(mLods.data(), mFile.data() + sizeof(header), tableSize);
+
+    for (const MeshCacheLod &l : mLods) {
+        const u64 indexSize = (l.indexFormat == kIndex16) ? sizeof(u16) : sizeof(u32);
+        if (l.indexFormat > kIndex32 ||
+            !inFile(l.vertexOffset, static_cast<u64>(l.vertexCount) * header.stride, fileSize) ||
+            !inFile(l.indexOffset, l.indexCount * indexSize, fileSize)) {
+            return false;
+        }
+    }
+
+    // The indices go straight to Mesh and glDrawElements, so check them too.
+    const bool strips = (mPrimitive == kTriangleStrip);
+    for (const MeshCacheLod &l : mLods) {
+        const void *indices = mFile.data() + l.indexOffset;
+        const bool ok = (l.indexFormat == kIndex16)
+            ? indicesInRange(static_cast<const u16 *>(indices), l.indexCount, l.vertexCount, strips)
+            : indicesInRange(static_cast<const u32 *>(indices), l.indexCount, l.vertexCount, strips);
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Mesh MeshCache::toMesh (const u32 level) const {
+    Mesh m;
+    if (!isValid() || mLayout.stride() != sizeof(Vertex) || mPrimitive != kTriangles) {
+        verify(false);
+        return m;
+    }
+
+    const MeshCacheLod &l = lod(level);
+    // The buffer is aligned for, and was written from, Vertex objects.
+    const Vertex *vertices = reinterpret_cast<const Vertex *>(vertexData(level));
+    m.vertices.assign(vertices, vertices + l.vertexCount);
+
+    const IndexBuffer ib = indices(level);
+    m.indices.resize(ib.count());
+    for (u32 i = 0; i < ib.count(); ++i) {
+        m.indices[i] = ib[i];
+    }
+    return m;
+}
+
+namespace {
+
+// Buffers of one level, as they will be written.
+struct CookedLod {
+    Mesh mesh;
+    IndexBuffer indices;
+    MeshCacheLod entry;
+};
+
+} /* namespace */
+
+// Write size bytes at offset, padding from the current position.
+static bool writeAt (FILE *file, u64 &position, const u64 offset, const void *data, const size_t size) {
+    static const u8 kZeros[kMeshCacheAlignment] = {0};
+    while (position < offset) {
+        const size_t pad = static_cast<size_t>((offset - position < kMeshCacheAlignment) ? offset - position
+                                                                                          : kMeshCacheAlignment);
+        if (fwrite(kZeros, 1, pad, file) != pad) {
+            return false;
+        }
+        position += pad;
+    }
+    if (size > 0 && fwrite(data, 1, size, file) != size) {
+        return false;
+    }
+    position += size;
+    return true;
+}
+
+bool writeMeshCache (const char * const filename, const Mesh &mesh,
+                     const std::vector<float> &lodRatios, const PrimitiveType primitive) {
+    std::vector<CookedLod> levels(1);
+    levels[0].mesh = mesh;
+    levels[0].entry.ratio = 1.0f;
+    levels[0].entry.error = 0.0f;
+    if (!lodRatios.empty()) {
+        for (MeshLod &l : buildLodChain(mesh, lodRatios)) {
+            CookedLod level;
+            level.mesh = std::move(l.mesh);
+            level.entry.ratio = l.ratio;
+            level.entry.error = l.error;
+            levels.push_back(std::move(level));
+        }
+    }
+
+    const VertexLayout layout = Vertex::layout();
+    MeshCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = kMeshCacheMagic;
+    header.version = kMeshCacheVersion;
+    header.stride = layout.stride();
+    header.attribCount = static_cast<u32>(layout.attributes().size());
+    for (u32 i = 0; i < header.attribCount; ++i) {
+        const VertexAttrib &a = layout.attributes()[i];
+        header.attribs[i] = MeshCacheAttrib{a.location, a.components, static_cast<u32>(a.type), a.offset};
+    }
+    Aabb bounds;
+    for (const Vertex &v : mesh.vertices) {
+        bounds.addPoint(v.position);
+    }
+    for (u32 k = 0; k < 3; ++k) {
+        header.boundsMin[k] = bounds.min[k];
+        header.boundsMax[k] = bounds.max[k];
+    }
+    header.primitive = primitive;
+    header.lodCount = static_cast<u32>(levels.size());
+
+    u64 offset = sizeof(header) + levels.size() * sizeof(MeshCacheLod);
+    for (CookedLod &level : levels) {
+        level.mesh.optimize();
+        level.indices = IndexBuffer(level.mesh.indices, level.mesh.vertCount(), primitive);
+
+        MeshCacheLod &e = level.entry;
+        e.vertexCount = level.mesh.vertCount();
+        e.indexCount = level.indices.count();
+        e.indexFormat = level.indices.format();
+        e.reserved = 0;
+        e.vertexOffset = alignUp(offset);
+        e.indexOffset = alignUp(e.vertexOffset + e.vertexCount * sizeof(Vertex));
+        offset = e.indexOffset + level.indices.size();
+    }
+
+    const std::string temp = std::string(filename) + ".tmp";
+    FILE *file = fopen(temp.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+
+    u64 position = 0;
+    bool ok = writeAt(file, position, 0, &header, sizeof(header));
+    for (const CookedLod &level : levels) {
+        ok = ok && writeAt(file, position, position, &level.entry, sizeof(level.entry));
+    }
+    for (const CookedLod &level : levels) {
+        ok = ok && writeAt(file, position, level.entry.vertexOffset, level.mesh.vertices.data(),
+                           level.mesh.vertices.size() * sizeof(Vertex));
+        ok = ok && writeAt(file, position, level.entry.indexOffset, level.indices.data(),
+                           level.indices.size());
+    }
+    ok = (fclose(file) == 0) && ok;
+
+#if defined(_WIN32)
+    // rename() won't replace an existing file on Windows.
+    if (ok) {
+        remove(filename);
+    }
+#endif
+    if (!ok || rename(temp.c_str(), filename) != 0) {
+        remove(temp.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::string meshCachePath (const char * const objFilename) {
+    return std::string(objFilename) + ".sgemesh";
+}
+
+bool cookObjMesh (const char * const objFilename, const char * const cacheFilename,
+                  const std::vector<float> &lodRatios, const bool threaded) {
+    const ObjDocument doc(objFilename, threaded);
+    if (!doc.isValid()) {
+        return false;
+    }
+
+    if (!writeMeshCache(cacheFilename, meshFromObjDocument(doc), lodRatios)) {
+        logError(("Failed to write mesh cache -- " + std::string(cacheFilename) + ".").c_str());
+        return false;
+    }
+    return true;
+}
+
+// Modification time of a file in nanoseconds, or in whole seconds where
+// stat has nothing finer.
+static u64 modifiedTime (const struct stat &st) {
+#if defined(__APPLE__)
+    return static_cast<u64>(st.st_mtimespec.tv_sec) * 1000000000u + static_cast<u64>(st.st_mtimespec.tv_nsec);
+#elif defined(_WIN32)
+    return static_cast<u64>(st.st_mtime) * 1000000000u;
+#else
+    return static_cast<u64>(st.st_mtim.tv_sec) * 1000000000u + static_cast<u64>(st.st_mtim.tv_nsec);
+#endif
+}
+
+bool isMeshCacheFresh (const char * const objFilename, const char * const cacheFilename) {
+    struct stat obj;
+    struct stat cache;
+    if (stat(cacheFilename, &cache) != 0) {
+        return false;
+    }
+    // Without the source the cache is all there is. With equal times the
+    // .obj file may have been saved after the cook within the clock's
+    // resolution, so only a strictly newer cache is trusted.
+    return stat(objFilename, &obj) != 0 || modifiedTime(cache) > modifiedTime(obj);
+}
+
+} /* namespace sge */
@@ -0,0 +1,229 @@
+/*---  MeshCache.h - Binary Mesh Cache Files  ------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Store meshes ready for drawing, so that loading one is a memory
+ *   map rather than parsing, welding and optimising a text file.
+ *
+ * A mesh cache file holds, in native byte order:
+ *
+ *   - a MeshCacheHeader: magic, format version, vertex layout, bounds and
+ *     the number of levels of detail,
+ *   - a MeshCacheLod for every level, level 0 being the full mesh,
+ *   - for every level, its vertex buffer and its index buffer, each
+ *     starting on a kMeshCacheAlignment byte boundary.
+ *
+ * The buffers are stored exactly as they are sent to the GPU: vertices in
+ * the header's layout and indices packed as by IndexBuffer, after
+ * Mesh::optimize(). A file from another version of the format, or another
+ * byte order, fails to load rather than being misread.
+ */
+#ifndef __SGE_MESHCACHE_H
+#define __SGE_MESHCACHE_H
+
+#include <string>
+#include <vector>
+
+namespace sge {
+
+/** "SGEM" read as a native u32. */
+static constexpr u32 kMeshCacheMagic = 0x4D454753;
+
+/** Changed whenever the format changes, invalidating existing caches. */
+static constexpr u32 kMeshCacheVersion = 1;
+
+/** Alignment of every buffer in the file, in bytes. */
+static constexpr u32 kMeshCacheAlignment = 64;
+
+/** Most vertex attributes a mesh cache can describe. */
+static constexpr u32 kMeshCacheMaxAttribs = 8;
+
+/** A VertexAttrib, with fixed size fields. */
+struct MeshCacheAttrib {
+    u32 location;
+    u32 components;
+    u32 type;   /**< AttribType */
+    u32 offset;
+};
+
+struct MeshCacheHeader {
+    u32 magic;
+    u32 version;
+    u32 stride;      /**< Bytes per vertex. */
+    u32 attribCount;
+    MeshCacheAttrib attribs[kMeshCacheMaxAttribs];
+    float boundsMin[3];
+    float boundsMax[3];
+    u32 primitive;   /**< PrimitiveType of every level's indices. */
+    u32 lodCount;
+};
+
+/** One level of detail: where its buffers are, and its MeshLod metrics. */
+struct MeshCacheLod {
+    u64 vertexOffset; /**< From the start of the file. */
+    u64 indexOffset;  /**< From the start of the file. */
+    u32 vertexCount;
+    u32 indexCount;   /**< Including any restart indices. */
+    u32 indexFormat;  /**< IndexFormat */
+    float ratio;
+    float error;
+    u32 reserved;
+};
+
+/**
+ * A mesh cache file mapped into memory. Movable but not copyable; the
+ * buffers are valid for the lifetime of the object.
+ */
+class MeshCache {
+public:
+    /** No mesh. */
+    MeshCache ();
+
+    /**
+     * Map and check filename. Check isValid() to see whether it
+     * succeeded.
+     */
+    explicit MeshCache (const char * const filename);
+
+    /** @return True if a well formed cache of this version was loaded. */
+    bool isValid () const;
+
+    const VertexLayout &layout () const;
+
+    /** @return Bounds of the full mesh. */
+    Aabb bounds () const;
+
+    PrimitiveType primitive () const;
+
+    /** @return Number of levels of detail, including the full mesh. */
+    u32 lodCount () const;
+
+    const MeshCacheLod &lod (const u32 level = 0) const;
+
+    /** @return The vertex buffer of a level, lod(level).vertexCount * layout().stride() bytes. */
+    const u8 *vertexData (const u32 level = 0) const;
+
+    /** @return The index buffer of a level. */
+    const u8 *indexData (const u32 level = 0) const;
+
+    /**
+     * @return A copy of the indices of a level.
+     */
+    IndexBuffer indices (const u32 level = 0) const;
+
+    /**
+     * Unpack a level back into a Mesh. The layout must be Vertex::layout(),
+     * as written by writeMeshCache(), and the indices a triangle list.
+     */
+    Mesh toMesh (const u32 level = 0) const;
+
+private:
+    MappedFile mFile;
+    VertexLayout mLayout;
+    Aabb mBounds;
+    PrimitiveType mPrimitive;
+    std::vector<MeshCacheLod> mLods;
+
+    bool load ();
+};
+
+/**
+ * Write mesh to filename as a mesh cache. Level 0 is mesh itself, and a
+ * further level is made for each of lodRatios with buildLodChain(). Each
+ * level is optimised with Mesh::optimize() and stored in Vertex::layout()
+ * with indices packed by IndexBuffer as primitive.
+ *
+ * The file is written under a temporary name and then renamed, so a
+ * partly written cache is never seen under filename.
+ *
+ * @return True if the file was written.
+ */
+bool writeMeshCache (const char * const filename, const Mesh &mesh,
+                     const std::vector<float> &lodRatios = std::vector<float>(),
+                     const PrimitiveType primitive = kTriangles);
+
+/** Ratios of the levels of detail cooked after the full mesh. */
+static const float kDefaultCookLodRatios[] = {0.5f, 0.25f, 0.125f};
+
+/**
+ * @return Path of the cache cooked from objFilename: objFilename with
+ *   ".sgemesh" appended.
+ */
+std::string meshCachePath (const char * const objFilename);
+
+/**
+ * Parse objFilename, on several threads if threaded, and write it with a
+ * level of detail for each of lodRatios to cacheFilename.
+ *
+ * @return True if the cache was written.
+ */
+bool cookObjMesh (const char * const objFilename, const char * const cacheFilename,
+                  const std::vector<float> &lodRatios, const bool threaded = true);
+
+/**
+ * Test if cacheFilename exists and was modified after objFilename, or
+ * objFilename doesn't exist. Says nothing about the cache's version,
+ * which MeshCache checks.
+ */
+bool isMeshCacheFresh (const char * const objFilename, const char * const cacheFilename);
+
+// --------------------------------------------------------------------------
+
+inline MeshCache::MeshCache () : mPrimitive{kTriangles} {
+}
+
+inline MeshCache::MeshCache (const char * const filename)
+      : mFile(filename), mPrimitive{kTriangles} {
+    if (!load()) {
+        mFile.close();
+        mLods.clear();
+    }
+}
+
+inline bool MeshCache::isValid () const {
+    return !mLods.empty();
+}
+
+inline const VertexLayout &MeshCache::layout () const {
+    return mLayout;
+}
+
+inline Aabb MeshCache::bounds () const {
+    return mBounds;
+}
+
+inline PrimitiveType MeshCache::primitive () const {
+    return mPrimitive;
+}
+
+inline u32 MeshCache::lodCount () const {
+    return static_cast<u32>(mLods.size());
+}
+
+inline const MeshCacheLod &MeshCache::lod (const u32 level) const {
+    verify(level < mLods.size());
+    return mLods[level];
+}
+
+inline const u8 *MeshCache::vertexData (const u32 level) const {
+    return reinterpret_cast<const u8 *>(mFile.data()) + lod(level).vertexOffset;
+}
+
+inline const u8 *MeshCache::indexData (const u32 level) const {
+    return reinterpret_cast<const u8 *>(mFile.data()) + lod(level).indexOffset;
+}
+
+inline IndexBuffer MeshCache::indices (const u32 level) const {
+    const MeshCacheLod &l = lod(level);
+    return IndexBuffer(static_cast<IndexFormat>(l.indexFormat), mPrimitive, l.indexCount,
+                       indexData(level));
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_MESHCACHE_H */
@@ -0,0 +1,167 @@
+//
+// Meshlet Implementation.
+//
+#include "../lib.h"
+
+#include <cmath>
+
+namespace sge {
+
+static constexpr u32 kNotInMeshlet = 0xFFFFFFFF;
+
+// Fill in the bounds and normal cone of m from its triangles.
+static void computeBounds (const Mesh &mesh, const MeshletMesh &mm, Meshlet &m) {
+    const u32 *verts = &mm.vertices[m.vertexOffset];
+
+    m.box = Aabb();
+    for (u32 k = 0; k < m.vertexCount; ++k) {
+        m.box.addPoint(mesh.vertices[verts[k]].position);
+    }
+    m.sphere = Sphere(m.box.center(), 0.0f);
+    for (u32 k = 0; k < m.vertexCount; ++k) {
+        m.sphere.radius = math::max(m.sphere.radius,
+                                    (mesh.vertices[verts[k]].position - m.sphere.center).mag());
+    }
+
+    std::vector<Vec3f> normals;
+    Vec3f axis = Vec3f_Zero;
+    const u8 *tri = &mm.triangles[m.triangleOffset * 3];
+    for (u32 t = 0; t < m.triangleCount; ++t, tri += 3) {
+        const Vec3f &a = mesh.vertices[verts[tri[0]]].position;
+        const Vec3f &b = mesh.vertices[verts[tri[1]]].position;
+        const Vec3f &c = mesh.vertices[verts[tri[2]]].position;
+        const Vec3f n = (b - a).cross(c - a);
+        const float len = n.mag();
+        if (len > 0.0f) {
+            normals.push_back(n / len);
+            axis += normals.back();
+        }
+    }
+
+    // The cone is only useful when every normal is within 90 degrees of
+    // the axis.
+    m.coneAxis = Vec3f_Zero;
+    m.coneCutoff = 1.0f;
+    const float len = axis.mag();
+    if (len > 0.0f) {
+        axis /= len;
+        float minDot = 1.0f;
+        for (const Vec3f &n : normals) {
+            minDot = math::min(minDot, n.dot(axis));
+        }
+        m.coneAxis = axis;
+        if (minDot > 0.0f) {
+            m.coneCutoff = sqrtf(1.0f - minDot * minDot);
+        }
+    }
+}
+
+MeshletMesh::MeshletMesh (const Mesh &mesh, const u32 maxVertices, const u32 maxTriangles) {
+    verify(maxVertices >= 3 && maxVertices <= 256);
+    verify(maxTriangles >= 1);
+
+    const u32 vertexCount = mesh.vertCount();
+    const u32 triCount = mesh.faceCount();
+    const std::vector<u32> &indices = mesh.indices;
+
+    // Triangles using each vertex.
+    std::vector<u32> offset(vertexCount + 1, 0);
+    for (u32 i = 0; i < triCount * 3; ++i) {
+        ++offset[indices[i] + 1];
+    }
+    for (u32 v = 0; v < vertexCount; ++v) {
+        offset[v + 1] += offset[v];
+    }
+    std::vector<u32> fill(offset.begin(), offset.end() - 1);
+    std::vector<u32> adjacency(triCount * 3);
+    for (u32 i = 0; i < triCount * 3; ++i) {
+        adjacency[fill[indices[i]]++] = i / 3;
+    }
+
+    std::vector<bool> used(triCount, false);
+    std::vector<u32> local(vertexCount, kNotInMeshlet); // Meshlet vertex of each mesh vertex
+    u32 seed = 0;
+
+    while (true) {
+        while (seed < triCount && used[seed]) {
+            ++seed;
+        }
+        if (seed == triCount) {
+            break;
+        }
+
+        Meshlet m;
+        m.vertexOffset = static_cast<u32>(vertices.size());
+        m.vertexCount = 0;
+        m.triangleOffset = static_cast<u32>(triangles.size() / 3);
+        m.triangleCount = 0;
+
+        u32 next = seed;
+        while (next != kNotInMeshlet) {
+            const u32 *tri = &indices[next * 3];
+            used[next] = true;
+            for (u32 k = 0; k < 3; ++k) {
+                if (local[tri[k]] == kNotInMeshlet) {
+                    local[tri[k]] = m.vertexCount++;
+                    vertices.push_back(tri[k]);
+                }
+                triangles.push_back(static_cast<u8>(local[tri[k]]));
+            }
+            ++m.triangleCount;
+
+            if (m.triangleCount == maxTriangles) {
+                break;
+            }
+
+            // Of the triangles around the meshlet's vertices that still
+            // fit, take the one adding the fewest new vertices.
+            next = kNotInMeshlet;
+            u32 bestNew = 3;
+            const u32 *verts = &vertices[m.vertexOffset];
+            for (u32 k = 0; k < m.vertexCount && bestNew > 0; ++k) {
+                for (u32 a = offset[verts[k]]; a < offset[verts[k] + 1]; ++a) {
+                    const u32 t = adjacency[a];
+                    if (used[t]) {
+                        continue;
+                    }
+                    const u32 *c = &indices[t * 3];
+                    const u32 added = (local[c[0]] == kNotInMeshlet ? 1 : 0) +
+                                      (local[c[1]] == kNotInMeshlet ? 1 : 0) +
+                                      (local[c[2]] == kNotInMeshlet ? 1 : 0);
+                    if (added < bestNew && m.vertexCount + added <= maxVertices) {
+                        bestNew = added;
+                        next = t;
+                        if (added == 0) {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        for (u32 k = 0; k < m.vertexCount; ++k) {
+            local[vertices[m.vertexOffset + k]] = kNotInMeshlet;
+        }
+
+        computeBounds(mesh, *this, m);
+        meshlets.push_back(m);
+        spheres.add(m.sphere);
+    }
+}
+
+u32 MeshletMesh::cull (const Frustum &frustum, const Vec3f &eye, std::vector<u32> &indices) {
+    std::vector<u64> visible;
+    frustum.cull(spheres, visible);
+
+    indices.clear();
+    u32 count = 0;
+    for (size_t i = 0; i < meshlets.size(); ++i) {
+        if ((visible[i / 64] >> (i % 64) & 1) && !isBackFacing(i, eye)) {
+            appendIndices(i, indices);
+            ++count;
+        }
+    }
+    return count;
+}
+
+} /* namespace sge */
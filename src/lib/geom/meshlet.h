@@ -0,0 +1,124 @@
+/*---  Meshlet.h - Mesh Clusters  -----------------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Split a Mesh into small clusters of triangles (meshlets) which
+ *   can be culled individually, and cull them on the CPU.
+ *
+ * Each meshlet has a bounding sphere and box for frustum culling, and a
+ * cone bounding the normals of its triangles: when the camera looks at
+ * the meshlet from within a narrower cone behind it, every triangle faces
+ * away and the whole meshlet can be skipped.
+ *
+ * Meshlets are grown from a seed triangle by repeatedly adding the
+ * triangle which shares the most vertices with it, so they are compact
+ * patches of the surface. Running Mesh::optimize() first gives them a
+ * good vertex order within each meshlet.
+ */
+#ifndef __SGE_MESHLET_H
+#define __SGE_MESHLET_H
+
+#include <vector>
+
+namespace sge {
+
+static constexpr u32 kMeshletMaxVertices = 64;
+static constexpr u32 kMeshletMaxTriangles = 124;
+
+/**
+ * One cluster of a MeshletMesh.
+ */
+struct Meshlet {
+    u32 vertexOffset;   /**< First entry in MeshletMesh::vertices. */
+    u32 vertexCount;
+    u32 triangleOffset; /**< First triangle in MeshletMesh::triangles. */
+    u32 triangleCount;
+
+    Sphere sphere;
+    Aabb box;
+
+    /**
+     * Every triangle normal is within asin(coneCutoff) of coneAxis, so the
+     * meshlet is wholly back facing when viewed along a direction within
+     * acos(coneCutoff) of coneAxis. coneCutoff is 1 when the normals are
+     * too spread out for that.
+     */
+    Vec3f coneAxis;
+    float coneCutoff;
+};
+
+/**
+ * A Mesh's triangles divided into meshlets. Indices refer to the vertices
+ * of the original Mesh, which are not copied.
+ */
+class MeshletMesh {
+public:
+    /** Empty. */
+    MeshletMesh () = default;
+
+    /**
+     * Split every triangle of mesh into meshlets of at most maxVertices
+     * vertices and maxTriangles triangles. maxVertices is at most 256.
+     */
+    explicit MeshletMesh (const Mesh &mesh, const u32 maxVertices = kMeshletMaxVertices,
+                          const u32 maxTriangles = kMeshletMaxTriangles);
+
+    u32 meshletCount () const;
+
+    /**
+     * Test if meshlet i is wholly back facing when seen from eye.
+     */
+    bool isBackFacing (const size_t i, const Vec3f &eye) const;
+
+    /**
+     * Append the mesh indices of meshlet i to indices.
+     */
+    void appendIndices (const size_t i, std::vector<u32> &indices) const;
+
+    /**
+     * Build the index list of every meshlet which may be visible: inside
+     * the frustum and not back facing from eye. Updates spheres with the
+     * frustum culling state.
+     *
+     * @param indices Replaced with the indices of the visible meshlets, in
+     *                order, for drawing with the Mesh's vertices.
+     * @return Number of visible meshlets.
+     */
+    u32 cull (const Frustum &frustum, const Vec3f &eye, std::vector<u32> &indices);
+
+public:
+    std::vector<Meshlet> meshlets;
+    std::vector<u32> vertices; /**< Mesh vertex of each meshlet vertex. */
+    std::vector<u8> triangles; /**< Meshlet vertex of each corner, 3 per triangle. */
+    SphereArray spheres;       /**< Bounding sphere of each meshlet, for batch culling. */
+};
+
+// --------------------------------------------------------------------------
+
+inline u32 MeshletMesh::meshletCount () const {
+    return static_cast<u32>(meshlets.size());
+}
+
+inline bool MeshletMesh::isBackFacing (const size_t i, const Vec3f &eye) const {
+    const Meshlet &m = meshlets[i];
+    const Vec3f view = m.sphere.center - eye;
+    return view.dot(m.coneAxis) >= m.coneCutoff * view.mag() + m.sphere.radius;
+}
+
+inline void MeshletMesh::appendIndices (const size_t i, std::vector<u32> &indices) const {
+    const Meshlet &m = meshlets[i];
+    const u8 *tri = &triangles[m.triangleOffset * 3];
+    const u32 *verts = &vertices[m.vertexOffset];
+    for (u32 k = 0; k < m.triangleCount * 3; ++k) {
+        indices.push_back(verts[tri[k]]);
+    }
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_MESHLET_H */
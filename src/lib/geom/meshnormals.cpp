@@ -0,0 +1,279 @@
+//
+// Mesh Normal and Tangent Generation Implementation.
+//
+#include "../lib.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace sge {
+
+// Position as sortable bits, with -0 treated as 0.
+static void positionBits (const Vec3f &p, u32 bits[3]) {
+    const float f[3] = {p.x + 0.0f, p.y + 0.0f, p.z + 0.0f};
+    std::memcpy(bits, f, sizeof(f));
+}
+
+static Vec3f safeNormalize (const Vec3f &v) {
+    const float len = sqrtf(v.magSq());
+    return (len > 0.0f) ? v / len : Vec3f_Zero;
+}
+
+// Run fn over [0, count), across threads if requested and worth it.
+template <typename Fn>
+static void forRange (const size_t count, const bool threaded, const Fn &fn) {
+    if (threaded && count > kMeshNormalsGrain) {
+        parallelFor(count, kMeshNormalsGrain, fn);
+    } else {
+        fn(0, count);
+    }
+}
+
+// List the corners using each vertex, grouped by vertex.
+static void vertexCorners (const Mesh &mesh, std::vector<u32> &offsets, std::vector<u32> &corners) {
+    const u32 vertexCount = mesh.vertCount();
+
+    offsets.assign(vertexCount + 1, 0);
+    for (const u32 i : mesh.indices) {
+        ++offsets[i + 1];
+    }
+    for (u32 v = 0; v < vertexCount; ++v) {
+        offsets[v + 1] += offsets[v];
+    }
+    corners.resize(mesh.indices.size());
+    std::vector<u32> fill(offsets.begin(), offsets.end() - 1);
+    for (u32 c = 0; c < mesh.indexCount(); ++c) {
+        corners[fill[mesh.indices[c]]++] = c;
+    }
+}
+
+namespace {
+
+// A vertex's position as bits, ordered by position and then vertex.
+struct PositionKey {
+    u32 bits[3];
+    u32 vertex;
+
+    bool samePosition (const PositionKey &other) const {
+        return bits[0] == other.bits[0] && bits[1] == other.bits[1] && bits[2] == other.bits[2];
+    }
+
+    bool operator< (const PositionKey &other) const {
+        for (u32 k = 0; k < 3; ++k) {
+            if (bits[k] != other.bits[k]) {
+                return bits[k] < other.bits[k];
+            }
+        }
+        return vertex < other.vertex;
+    }
+};
+
+// Per face data shared by every corner gathering from a face.
+struct FaceData {
+    std::vector<Vec3f> normal; // Cross product of two edges: the normal scaled by twice the area.
+    std::vector<float> angle;  // Angle at each corner.
+
+    FaceData (const Mesh &mesh, const bool threaded)
+          : normal(mesh.faceCount()), angle(mesh.indexCount()) {
+        const size_t faceCount = mesh.faceCount();
+        const size_t blocks = (faceCount + 3) / 4;
+
+        // |e1 x e2| is twice the area at every corner of a face, so
+        // atan2(|e1 x e2|, e1 . e2) gives each angle without normalising
+        // the edges. Faces are taken four at a time to evaluate the
+        // atan2 of each corner of the block at once.
+        forRange(blocks, threaded, [&](const size_t begin, const size_t end) {
+            for (size_t block = begin; block < end; ++block) {
+                const size_t first = block * 4;
+                const size_t count = (faceCount - first < 4) ? faceCount - first : 4;
+
+                float len[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+                float dot[3][4] = {{0.0f}};
+                for (size_t i = 0; i < count; ++i) {
+                    const u32 *tri = &mesh.indices[(first + i) * 3];
+                    const Vec3f p[3] = {mesh.vertices[tri[0]].position,
+                                        mesh.vertices[tri[1]].position,
+                                        mesh.vertices[tri[2]].position};
+                    const Vec3f n = (p[1] - p[0]).cross(p[2] - p[0]);
+                    normal[first + i] = n;
+                    len[i] = sqrtf(n.magSq());
+                    for (u32 k = 0; k < 3; ++k) {
+                        dot[k][i] = (p[(k + 1) % 3] - p[k]).dot(p[(k + 2) % 3] - p[k]);
+                    }
+                }
+
+                const Floatx4 y = Floatx4::load(len);
+                float a[3][4];
+                for (u32 k = 0; k < 3; ++k) {
+                    math::fast::atan2<math::fast::kLow>(y, Floatx4::load(dot[k])).store(a[k]);
+                }
+                for (size_t i = 0; i < count; ++i) {
+                    for (u32 k = 0; k < 3; ++k) {
+                        angle[(first + i) * 3 + k] = a[k][i];
+                    }
+                }
+            }
+        });
+    }
+};
+
+// Normal at corner c: the weighted normals of the faces around its
+// position within the smoothing angle of its own face.
+Vec3f cornerNormal (const Mesh &mesh, const CornerTable &table, const FaceData &faces,
+                    const float cosAngle, const u32 c) {
+    const bool all = cosAngle <= -1.0f;
+    const Vec3f own = all ? Vec3f_Zero : safeNormalize(faces.normal[c / 3]);
+
+    Vec3f n = Vec3f_Zero;
+    const u32 g = table.vertexGroup[mesh.indices[c]];
+    for (u32 i = table.groupOffsets[g]; i < table.groupOffsets[g + 1]; ++i) {
+        const u32 v = table.groupVertices[i];
+        for (u32 j = table.cornerOffsets[v]; j < table.cornerOffsets[v + 1]; ++j) {
+            const u32 other = table.corners[j];
+            const Vec3f &face = faces.normal[other / 3];
+            if (all || other == c || face.dot(own) >= cosAngle * sqrtf(face.magSq())) {
+                n += face * faces.angle[other];
+            }
+        }
+    }
+    return safeNormalize(n);
+}
+
+} /* namespace */
+
+CornerTable::CornerTable (const Mesh &mesh) {
+    const u32 vertexCount = mesh.vertCount();
+    vertexCorners(mesh, cornerOffsets, corners);
+
+    // Group vertices with equal positions by sorting them.
+    std::vector<PositionKey> keys(vertexCount);
+    for (u32 v = 0; v < vertexCount; ++v) {
+        positionBits(mesh.vertices[v].position, keys[v].bits);
+        keys[v].vertex = v;
+    }
+    std::sort(keys.begin(), keys.end());
+
+    vertexGroup.resize(vertexCount);
+    groupVertices.resize(vertexCount);
+    groupOffsets.clear();
+    for (u32 k = 0; k < vertexCount; ++k) {
+        if (k == 0 || !keys[k].samePosition(keys[k - 1])) {
+            groupOffsets.push_back(k);
+        }
+        groupVertices[k] = keys[k].vertex;
+        vertexGroup[keys[k].vertex] = static_cast<u32>(groupOffsets.size() - 1);
+    }
+    groupOffsets.push_back(vertexCount);
+}
+
+void generateNormals (Mesh &mesh, const float smoothingAngle, const bool threaded) {
+    const CornerTable table(mesh);
+    const FaceData faces(mesh, threaded);
+    const float cosAngle = cosf(smoothingAngle);
+
+    std::vector<Vec3f> normals(mesh.indexCount());
+    forRange(normals.size(), threaded, [&](const size_t begin, const size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            normals[c] = cornerNormal(mesh, table, faces, cosAngle, static_cast<u32>(c));
+        }
+    });
+
+    // Give each vertex the normal of its first corner, and a copy of the
+    // vertex to corners wanting a different normal. Corners smoothed from
+    // the same faces have bitwise equal normals.
+    static constexpr u32 kNone = 0xFFFFFFFF;
+    const u32 vertexCount = mesh.vertCount();
+    std::vector<bool> assigned(vertexCount, false);
+    std::vector<u32> nextCopy(vertexCount, kNone);
+
+    for (u32 c = 0; c < mesh.indexCount(); ++c) {
+        u32 v = mesh.indices[c];
+        if (!assigned[v]) {
+            mesh.vertices[v].normal = normals[c];
+            assigned[v] = true;
+            continue;
+        }
+
+        while (mesh.vertices[v].normal != normals[c] && nextCopy[v] != kNone) {
+            v = nextCopy[v];
+        }
+        if (mesh.vertices[v].normal != normals[c]) {
+            const u32 copy = mesh.vertCount();
+            Vertex vert = mesh.vertices[v];
+            vert.normal = normals[c];
+            mesh.vertices.push_back(vert);
+            nextCopy[v] = copy;
+            nextCopy.push_back(kNone);
+            v = copy;
+        }
+        mesh.indices[c] = v;
+    }
+}
+
+void updateNormals (Mesh &mesh, const CornerTable &table, const float smoothingAngle,
+                    const bool threaded) {
+    verify(table.cornerOffsets.size() == mesh.vertices.size() + 1);
+
+    const FaceData faces(mesh, threaded);
+    const float cosAngle = cosf(smoothingAngle);
+
+    forRange(mesh.vertCount(), threaded, [&](const size_t begin, const size_t end) {
+        for (size_t v = begin; v < end; ++v) {
+            if (table.cornerOffsets[v] < table.cornerOffsets[v + 1]) {
+                const u32 c = table.corners[table.cornerOffsets[v]];
+                mesh.vertices[v].normal = cornerNormal(mesh, table, faces, cosAngle, c);
+            }
+        }
+    });
+}
+
+std::vector<Vec4f> generateTangents (const Mesh &mesh, const bool threaded) {
+    std::vector<u32> offsets;
+    std::vector<u32> corners;
+    vertexCorners(mesh, offsets, corners);
+    const FaceData faces(mesh, threaded);
+
+    std::vector<Vec4f> tangents(mesh.vertCount());
+    forRange(mesh.vertCount(), threaded, [&](const size_t begin, const size_t end) {
+        for (size_t v = begin; v < end; ++v) {
+            const Vec3f n = safeNormalize(mesh.vertices[v].normal);
+
+            Vec3f t = Vec3f_Zero;
+            Vec3f b = Vec3f_Zero;
+            for (u32 j = offsets[v]; j < offsets[v + 1]; ++j) {
+                const u32 c = corners[j];
+                const u32 *tri = &mesh.indices[c - c % 3];
+                const Vertex &p0 = mesh.vertices[tri[c % 3]];
+                const Vertex &p1 = mesh.vertices[tri[(c + 1) % 3]];
+                const Vertex &p2 = mesh.vertices[tri[(c + 2) % 3]];
+                const Vec3f e1 = p1.position - p0.position;
+                const Vec3f e2 = p2.position - p0.position;
+                const Vec2f d1 = p1.texCoord - p0.texCoord;
+                const Vec2f d2 = p2.texCoord - p0.texCoord;
+
+                // Directions of increasing u and v on the face. Dividing
+                // by the determinant would only rescale, but its sign
+                // keeps mirrored texture coordinates mirrored.
+                const float sign = (d1.x * d2.y - d2.x * d1.y < 0.0f) ? -1.0f : 1.0f;
+                const Vec3f ft = (e1 * d2.y - e2 * d1.y) * sign;
+                const Vec3f fb = (e2 * d1.x - e1 * d2.x) * sign;
+
+                const float angle = faces.angle[c];
+                t += safeNormalize(ft - n * n.dot(ft)) * angle;
+                b += safeNormalize(fb - n * n.dot(fb)) * angle;
+            }
+
+            t = safeNormalize(t - n * n.dot(t));
+            if (t == Vec3f_Zero) {
+                // Any direction orthogonal to the normal.
+                const Vec3f axis = (fabsf(n.x) < 0.9f) ? Vec3f(1.0f, 0.0f, 0.0f) : Vec3f(0.0f, 1.0f, 0.0f);
+                t = safeNormalize(axis - n * n.dot(axis));
+            }
+            tangents[v] = Vec4f(t, (n.cross(t).dot(b) < 0.0f) ? -1.0f : 1.0f);
+        }
+    });
+    return tangents;
+}
+
+} /* namespace sge */
@@ -0,0 +1,92 @@
+/*---  MeshNormals.h - Normal and Tangent Generation  ----------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Generate smooth vertex normals and tangent frames for a Mesh.
+ *
+ * Each face contributes its normal weighted by both its area and the angle
+ * of the corner at the vertex, so normals don't depend on how a surface is
+ * triangulated. Faces whose normals differ by more than a smoothing angle
+ * are not averaged together, keeping hard edges hard.
+ *
+ * Rather than every face adding to its vertices, which needs atomics or
+ * locks to run in parallel, every vertex gathers from the faces around it
+ * through a CornerTable. Each vertex is then written by exactly one
+ * thread, and a CornerTable built once can be reused every frame to
+ * recompute the normals of a deforming mesh with updateNormals().
+ *
+ * Tangents follow the MikkTSpace conventions: per face tangents from the
+ * texture coordinate derivatives are weighted by corner angle, made
+ * orthogonal to the vertex normal, and w holds the bitangent sign, so the
+ * bitangent is w * cross(normal, tangent).
+ */
+#ifndef __SGE_MESHNORMALS_H
+#define __SGE_MESHNORMALS_H
+
+#include <vector>
+
+namespace sge {
+
+/** Smallest number of vertices or faces worth handing to another thread. */
+static constexpr size_t kMeshNormalsGrain = 16384;
+
+/**
+ * The corners (triangle * 3 + k) around every vertex of a Mesh, and the
+ * vertices sharing each position. Depends only on the indices and which
+ * positions are equal, so it stays valid while a mesh deforms.
+ */
+class CornerTable {
+public:
+    /** Empty. */
+    CornerTable () = default;
+
+    explicit CornerTable (const Mesh &mesh);
+
+    /** Position group of each vertex. */
+    std::vector<u32> vertexGroup;
+
+    /** The corners using vertex v are corners[cornerOffsets[v] .. cornerOffsets[v + 1]). */
+    std::vector<u32> cornerOffsets;
+    std::vector<u32> corners;
+
+    /** The vertices in group g are groupVertices[groupOffsets[g] .. groupOffsets[g + 1]). */
+    std::vector<u32> groupOffsets;
+    std::vector<u32> groupVertices;
+};
+
+/**
+ * Replace the normal of every vertex with the weighted normals of the
+ * faces around its position whose normals are within smoothingAngle
+ * radians of the face using it. Where the faces using one vertex would
+ * get different normals the vertex is duplicated, so the vertex count can
+ * grow; with smoothingAngle = kPi no vertex is split.
+ */
+void generateNormals (Mesh &mesh, const float smoothingAngle = kDefaultSmoothingAngle,
+                      const bool threaded = false);
+
+/**
+ * Recompute the normals of a mesh whose positions have moved, without
+ * changing its vertices or indices. table must have been built from the
+ * mesh's indices. Each vertex is smoothed as its first face would be by
+ * generateNormals().
+ */
+void updateNormals (Mesh &mesh, const CornerTable &table,
+                    const float smoothingAngle = kDefaultSmoothingAngle,
+                    const bool threaded = false);
+
+/**
+ * Compute a tangent for every vertex from the positions, normals and
+ * texture coordinates of the faces using it. w is the bitangent sign,
+ * 1 or -1. Vertices used by no face, or whose faces have degenerate
+ * texture coordinates, get an arbitrary tangent orthogonal to the normal.
+ */
+std::vector<Vec4f> generateTangents (const Mesh &mesh, const bool threaded = false);
+
+} /* namespace sge */
+
+#endif /* __SGE_MESHNORMALS_H */
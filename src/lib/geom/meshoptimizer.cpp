@@ -0,0 +1,321 @@
+//
+// MeshOptimizer Implementation.
+//
+#include "../lib.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace sge {
+
+VertexCacheStats analyzeVertexCache (const std::vector<u32> &indices, const u32 vertexCount,
+                                     const u32 cacheSize) {
+    // A vertex is still in the FIFO until cacheSize more have been loaded
+    // after it.
+    std::vector<u32> loadedAt(vertexCount, 0);
+    std::vector<bool> seen(vertexCount, false);
+    u32 misses = 0;
+    u32 referenced = 0;
+
+    for (const u32 v : indices) {
+        if (!seen[v]) {
+            seen[v] = true;
+            ++referenced;
+        } else if (misses - loadedAt[v] <= cacheSize) {
+            continue;
+        }
+        loadedAt[v] = misses++;
+    }
+
+    const u32 triangles = static_cast<u32>(indices.size() / 3);
+    VertexCacheStats stats;
+    stats.transformed = misses;
+    stats.acmr = (triangles > 0) ? static_cast<float>(misses) / triangles : 0.0f;
+    stats.atvr = (referenced > 0) ? static_cast<float>(misses) / referenced : 0.0f;
+    return stats;
+}
+
+// --------------------------------------------------------------------------
+// Forsyth, "Linear-Speed Vertex Cache Optimisation", 2006.
+
+namespace {
+
+constexpr u32 kForsythCacheSize = 32;
+constexpr u32 kMaxValenceScore = 64;
+constexpr u32 kNoTriangle = 0xFFFFFFFF;
+
+struct ForsythScores {
+    float cache[kForsythCacheSize];
+    float valence[kMaxValenceScore];
+
+    ForsythScores () {
+        // The three vertices of the last triangle score the same, so the
+        // next triangle isn't biased towards one of its edges.
+        for (u32 k = 0; k < kForsythCacheSize; ++k) {
+            cache[k] = (k < 3) ? 0.75f
+                     : powf(1.0f - static_cast<float>(k - 3) / (kForsythCacheSize - 3), 1.5f);
+        }
+        // Favour vertices with few triangles left, to finish them off.
+        valence[0] = 0.0f;
+        for (u32 k = 1; k < kMaxValenceScore; ++k) {
+            valence[k] = 2.0f / sqrtf(static_cast<float>(k));
+        }
+    }
+
+    float score (const s32 cachePos, const u32 remaining) const {
+        if (remaining == 0) {
+            return -1.0f;
+        }
+        const float c = (cachePos >= 0) ? cache[cachePos] : 0.0f;
+        return c + ((remaining < kMaxValenceScore) ? valence[remaining]
+                                                    : 2.0f / sqrtf(static_cast<float>(remaining)));
+    }
+};
+
+} /* namespace */
+
+void optimizeVertexCache (std::vector<u32> &indices, const u32 vertexCount) {
+    static const ForsythScores kScores;
+    const u32 triCount = static_cast<u32>(indices.size() / 3);
+    if (triCount < 2) {
+        return;
+    }
+
+    // Triangles using each vertex. The first remaining[v] are not yet drawn.
+    std::vector<u32> offset(vertexCount + 1, 0);
+    for (u32 i = 0; i < triCount * 3; ++i) {
+        ++offset[indices[i] + 1];
+    }
+    for (u32 v = 0; v < vertexCount; ++v) {
+        offset[v + 1] += offset[v];
+    }
+    std::vector<u32> remaining(vertexCount, 0);
+    std::vector<u32> adjacency(triCount * 3);
+    for (u32 i = 0; i < triCount * 3; ++i) {
+        const u32 v = indices[i];
+        adjacency[offset[v] + remaining[v]++] = i / 3;
+    }
+
+    std::vector<float> vertScore(vertexCount);
+    for (u32 v = 0; v < vertexCount; ++v) {
+        vertScore[v] = kScores.score(-1, remaining[v]);
+    }
+
+    std::vector<float> triScore(triCount);
+    std::vector<bool> drawn(triCount, false);
+    u32 best = 0;
+    for (u32 t = 0; t < triCount; ++t) {
+        triScore[t] = vertScore[indices[t * 3]] + vertScore[indices[t * 3 + 1]] +
+                      vertScore[indices[t * 3 + 2]];
+        if (triScore[t] > triScore[best]) {
+            best = t;
+        }
+    }
+
+    std::vector<u32> out;
+    out.reserve(triCount * 3);
+    std::vector<u32> stamp(vertexCount, kNoTriangle);
+    std::vector<u32> cache;
+    std::vector<u32> nextCache;
+    cache.reserve(kForsythCacheSize + 3);
+    nextCache.reserve(kForsythCacheSize + 3);
+    u32 cursor = 0;
+
+    while (out.size() < triCount * 3) {
+        if (best == kNoTriangle) {
+            // Nothing in the cache has triangles left: start afresh from
+            // the next triangle in the input.
+            while (drawn[cursor]) {
+                ++cursor;
+            }
+            best = cursor;
+        }
+
+        const u32 *tri = &indices[best * 3];
+        drawn[best] = true;
+        for (u32 k = 0; k < 3; ++k) {
+            const u32 v = tri[k];
+            out.push_back(v);
+
+            u32 *first = &adjacency[offset[v]];
+            u32 *last = first + --remaining[v];
+            std::iter_swap(std::find(first, last + 1, best), last);
+        }
+
+        // The triangle's vertices move to the front, in LRU order.
+        nextCache.clear();
+        for (u32 k = 0; k < 3; ++k) {
+            if (stamp[tri[k]] != best) {
+                stamp[tri[k]] = best;
+                nextCache.push_back(tri[k]);
+            }
+        }
+        for (const u32 v : cache) {
+            if (stamp[v] != best) {
+                nextCache.push_back(v);
+            }
+        }
+
+        // Rescore every vertex whose position changed, including any that
+        // fell out, and the triangles still to draw around them.
+        best = kNoTriangle;
+        float bestScore = -1.0f;
+        for (u32 k = 0; k < nextCache.size(); ++k) {
+            const u32 v = nextCache[k];
+            const s32 pos = (k < kForsythCacheSize) ? static_cast<s32>(k) : -1;
+            const float score = kScores.score(pos, remaining[v]);
+            const float delta = score - vertScore[v];
+            vertScore[v] = score;
+
+            for (u32 a = offset[v], aEnd = offset[v] + remaining[v]; a < aEnd; ++a) {
+                const u32 t = adjacency[a];
+                triScore[t] += delta;
+            }
+        }
+        for (u32 k = 0; k < nextCache.size() && k < kForsythCacheSize; ++k) {
+            const u32 v = nextCache[k];
+            for (u32 a = offset[v], aEnd = offset[v] + remaining[v]; a < aEnd; ++a) {
+                const u32 t = adjacency[a];
+                if (triScore[t] > bestScore) {
+                    bestScore = triScore[t];
+                    best = t;
+                }
+            }
+        }
+
+        if (nextCache.size() > kForsythCacheSize) {
+            nextCache.resize(kForsythCacheSize);
+        }
+        cache.swap(nextCache);
+    }
+
+    indices.swap(out);
+}
+
+// --------------------------------------------------------------------------
+// Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality
+// and Reduced Overdraw", 2007.
+
+void optimizeOverdraw (std::vector<u32> &indices, StridedSpan<const Vec3f> positions,
+                       const float threshold) {
+    const u32 triCount = static_cast<u32>(indices.size() / 3);
+    if (triCount < 2) {
+        return;
+    }
+
+    // Cache misses of each triangle, through the same FIFO analyzeVertexCache
+    // uses. Where all three miss, the cache optimiser started afresh.
+    const u32 vertexCount = static_cast<u32>(positions.size());
+    std::vector<u32> loadedAt(vertexCount, 0);
+    std::vector<bool> seen(vertexCount, false);
+    u32 time = 0;
+    auto miss = [&](const u32 v) {
+        if (seen[v] && time - loadedAt[v] <= kVertexCacheSize) {
+            return 0u;
+        }
+        seen[v] = true;
+        loadedAt[v] = time++;
+        return 1u;
+    };
+
+    std::vector<u32> hardStarts;
+    std::vector<u32> misses(triCount);
+    for (u32 t = 0; t < triCount; ++t) {
+        misses[t] = miss(indices[t * 3]) + miss(indices[t * 3 + 1]) + miss(indices[t * 3 + 2]);
+        if (t == 0 || misses[t] == 3) {
+            hardStarts.push_back(t);
+        }
+    }
+    hardStarts.push_back(triCount);
+
+    // Split each of those wherever the part so far is within threshold of
+    // the ACMR of the whole, simulating a cold cache for each part.
+    std::vector<u32> starts;
+    for (size_t c = 0; c + 1 < hardStarts.size(); ++c) {
+        const u32 begin = hardStarts[c];
+        const u32 end = hardStarts[c + 1];
+
+        u32 total = 0;
+        for (u32 t = begin; t < end; ++t) {
+            total += misses[t];
+        }
+        const float limit = threshold * static_cast<float>(total) / (end - begin);
+
+        starts.push_back(begin);
+        time += kVertexCacheSize;
+        u32 partMisses = 0;
+        for (u32 t = begin; t < end; ++t) {
+            partMisses += miss(indices[t * 3]) + miss(indices[t * 3 + 1]) + miss(indices[t * 3 + 2]);
+            if (t + 1 < end && partMisses <= limit * (t + 1 - starts.back())) {
+                starts.push_back(t + 1);
+                time += kVertexCacheSize;
+                partMisses = 0;
+            }
+        }
+    }
+    const u32 clusterCount = static_cast<u32>(starts.size());
+    starts.push_back(triCount);
+
+    // Area weighted centroid and normal of each cluster.
+    std::vector<Vec3f> centroid(clusterCount, Vec3f_Zero);
+    std::vector<Vec3f> normal(clusterCount, Vec3f_Zero);
+    Vec3f meshCentroid = Vec3f_Zero;
+    float meshArea = 0.0f;
+    for (u32 c = 0; c < clusterCount; ++c) {
+        float area = 0.0f;
+        for (u32 t = starts[c]; t < starts[c + 1]; ++t) {
+            const Vec3f &a = positions[indices[t * 3]];
+            const Vec3f &b = positions[indices[t * 3 + 1]];
+            const Vec3f &p = positions[indices[t * 3 + 2]];
+            const Vec3f n = (b - a).cross(p - a);
+            const float w = n.mag();
+
+            centroid[c] += (a + b + p) * (w / 3.0f);
+            normal[c] += n;
+            area += w;
+        }
+        meshCentroid += centroid[c];
+        meshArea += area;
+        if (area > 0.0f) {
+            centroid[c] /= area;
+        }
+    }
+    if (meshArea > 0.0f) {
+        meshCentroid /= meshArea;
+    }
+
+    // Clusters facing out from the centre are likely to be in front of
+    // the rest from any viewpoint, so draw them first.
+    std::vector<float> key(clusterCount);
+    std::vector<u32> order(clusterCount);
+    for (u32 c = 0; c < clusterCount; ++c) {
+        const float n = normal[c].mag();
+        key[c] = (n > 0.0f) ? (centroid[c] - meshCentroid).dot(normal[c]) / n : 0.0f;
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&key](const u32 a, const u32 b) { return key[a] > key[b]; });
+
+    std::vector<u32> out;
+    out.reserve(indices.size());
+    for (const u32 c : order) {
+        out.insert(out.end(), indices.begin() + starts[c] * 3, indices.begin() + starts[c + 1] * 3);
+    }
+    indices.swap(out);
+}
+
+// --------------------------------------------------------------------------
+
+u32 vertexFetchRemap (const std::vector<u32> &indices, const u32 vertexCount,
+                      std::vector<u32> &remap) {
+    remap.assign(vertexCount, kUnusedVertex);
+    u32 next = 0;
+    for (const u32 v : indices) {
+        if (remap[v] == kUnusedVertex) {
+            remap[v] = next++;
+        }
+    }
+    return next;
+}
+
+} /* namespace sge */
@@ -0,0 +1,118 @@
+/*---  MeshOptimizer.h - Triangle and Vertex Reordering  ------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Reorder indexed triangles so the GPU transforms fewer vertices,
+ *   shades fewer hidden pixels, and fetches vertex data in order.
+ *
+ * The passes are meant to run in order: optimizeVertexCache(), then
+ * optimizeOverdraw() to sort clusters of the result front to back without
+ * losing much cache locality, then optimizeVertexFetch() to lay the
+ * vertices out in the order the triangles first use them. None of them
+ * change which triangles are drawn or the winding of any triangle.
+ *
+ * Vertex cache efficiency is measured as:
+ *   - ACMR, average cache miss ratio: vertices transformed per triangle.
+ *     3 is the worst; a large regular grid approaches 0.5.
+ *   - ATVR, average transformed vertex ratio: vertices transformed per
+ *     vertex referenced. 1 is ideal.
+ */
+#ifndef __SGE_MESHOPTIMIZER_H
+#define __SGE_MESHOPTIMIZER_H
+
+#include <vector>
+
+#include "../container/stridedspan.h"
+
+namespace sge {
+
+/** FIFO cache size used by analyzeVertexCache(). */
+static constexpr u32 kVertexCacheSize = 16;
+
+/** Vertex cache efficiency of an index list. */
+struct VertexCacheStats {
+    u32 transformed; /**< Vertices transformed, i.e. cache misses. */
+    float acmr;      /**< Transformed vertices per triangle. */
+    float atvr;      /**< Transformed vertices per vertex referenced. */
+};
+
+/**
+ * Simulate drawing indices through a FIFO post-transform cache of
+ * cacheSize vertices.
+ */
+VertexCacheStats analyzeVertexCache (const std::vector<u32> &indices, const u32 vertexCount,
+                                     const u32 cacheSize = kVertexCacheSize);
+
+/**
+ * Reorder triangles for post-transform vertex cache locality, using Tom
+ * Forsyth's linear-speed vertex cache optimisation. Tuned for an LRU cache
+ * of 32 vertices but works well for any cache size, FIFO or LRU.
+ */
+void optimizeVertexCache (std::vector<u32> &indices, const u32 vertexCount);
+
+/**
+ * Reorder clusters of triangles to reduce overdraw. indices should already
+ * be cache optimised; they are split into clusters wherever the cache
+ * optimiser started afresh, or where that keeps each cluster's ACMR within
+ * threshold times that of the whole, and clusters facing away from the
+ * centre of the mesh are drawn first.
+ *
+ * @param positions Position of every vertex.
+ * @param threshold Cache efficiency given up for finer clusters, e.g.
+ *                  1.05 allows the ACMR to grow by up to 5%.
+ */
+void optimizeOverdraw (std::vector<u32> &indices, StridedSpan<const Vec3f> positions,
+                       const float threshold = 1.05f);
+
+/** New index of a vertex no triangle uses. */
+static constexpr u32 kUnusedVertex = 0xFFFFFFFF;
+
+/**
+ * Compute the order in which indices first reference each vertex.
+ *
+ * @param remap Set to the new index of every vertex, or kUnusedVertex if
+ *              no triangle uses it.
+ * @return Number of vertices referenced.
+ */
+u32 vertexFetchRemap (const std::vector<u32> &indices, const u32 vertexCount,
+                      std::vector<u32> &remap);
+
+/**
+ * Reorder vertices into the order triangles first use them, and rewrite
+ * indices to match. Vertices no triangle uses are removed.
+ */
+template <typename V>
+void optimizeVertexFetch (std::vector<V> &vertices, std::vector<u32> &indices);
+
+// --------------------------------------------------------------------------
+
+template <typename V>
+void optimizeVertexFetch (std::vector<V> &vertices, std::vector<u32> &indices) {
+    std::vector<u32> remap;
+    const u32 used = vertexFetchRemap(indices, static_cast<u32>(vertices.size()), remap);
+    if (used == 0) {
+        vertices.clear();
+        return;
+    }
+
+    std::vector<V> ordered(used, vertices[0]);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        if (remap[i] != kUnusedVertex) {
+            ordered[remap[i]] = vertices[i];
+        }
+    }
+    vertices.swap(ordered);
+
+    for (u32 &index : indices) {
+        index = remap[index];
+    }
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_MESHOPTIMIZER_H */
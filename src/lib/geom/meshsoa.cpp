@@ -0,0 +1,37 @@
+//
+// MeshSoA Implementation.
+//
+#include "../lib.h"
+
+namespace sge {
+
+MeshSoA::MeshSoA (const Mesh &mesh) : indices{mesh.indices} {
+    const size_t n = mesh.vertices.size();
+    positions.reserve(n);
+    normals.reserve(n);
+    texCoords.reserve(n);
+    colors.reserve(n);
+    for (const Vertex &v : mesh.vertices) {
+        addVertex(v);
+    }
+}
+
+Mesh MeshSoA::toMesh () const {
+    Mesh m;
+    m.vertices.reserve(positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+        m.addVertex(vertex(i));
+    }
+    m.indices = indices;
+    return m;
+}
+
+Aabb MeshSoA::bounds () const {
+    Aabb box;
+    for (const Vec3f &p : positions) {
+        box.addPoint(p);
+    }
+    return box;
+}
+
+} /* namespace sge */
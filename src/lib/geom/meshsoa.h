@@ -0,0 +1,122 @@
+/*---  MeshSoA.h - Mesh Attribute Streams  --------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Defines MeshSoA, a Mesh stored as one array per vertex attribute.
+ *
+ * Passes which only need positions (bounds, depth and shadow passes,
+ * picking) read 12 bytes per vertex rather than the 36 of an interleaved
+ * Vertex. Each array can be uploaded as its own vertex buffer, laid out
+ * by the matching *Layout() function.
+ */
+#ifndef __SGE_MESHSOA_H
+#define __SGE_MESHSOA_H
+
+#include <vector>
+
+namespace sge {
+
+class MeshSoA {
+public:
+    /** Empty mesh. */
+    MeshSoA () = default;
+
+    /**
+     * Split every vertex of mesh into its attributes.
+     */
+    explicit MeshSoA (const Mesh &mesh);
+
+    /**
+     * Interleave the attributes back into a Mesh.
+     */
+    Mesh toMesh () const;
+
+    void addVertex (const Vertex &v);
+
+    void addFace (u32 a, u32 b, u32 c);
+
+    /**
+     * Get vertex i, interleaved.
+     */
+    Vertex vertex (const size_t i) const;
+
+    u32 vertCount () const;
+
+    u32 indexCount () const;
+
+    u32 faceCount () const;
+
+    /**
+     * Bounds of every position. Reads only the positions.
+     */
+    Aabb bounds () const;
+
+    /** Layouts of each attribute array in its own vertex buffer. */
+    static VertexLayout positionLayout ();
+    static VertexLayout normalLayout ();
+    static VertexLayout texCoordLayout ();
+    static VertexLayout colorLayout ();
+
+public:
+    std::vector<Vec3f> positions;
+    std::vector<Vec3f> normals;
+    std::vector<Vec2f> texCoords;
+    std::vector<Color> colors;
+    std::vector<u32> indices;
+};
+
+// --------------------------------------------------------------------------
+
+inline void MeshSoA::addVertex (const Vertex &v) {
+    positions.push_back(v.position);
+    normals.push_back(v.normal);
+    texCoords.push_back(v.texCoord);
+    colors.push_back(v.color);
+}
+
+inline void MeshSoA::addFace (const u32 a, const u32 b, const u32 c) {
+    indices.push_back(a);
+    indices.push_back(b);
+    indices.push_back(c);
+}
+
+inline Vertex MeshSoA::vertex (const size_t i) const {
+    return Vertex(positions[i], normals[i], texCoords[i], colors[i]);
+}
+
+inline u32 MeshSoA::vertCount () const {
+    return static_cast<u32>(positions.size());
+}
+
+inline u32 MeshSoA::indexCount () const {
+    return static_cast<u32>(indices.size());
+}
+
+inline u32 MeshSoA::faceCount () const {
+    return static_cast<u32>(indices.size()) / 3;
+}
+
+inline VertexLayout MeshSoA::positionLayout () {
+    return VertexLayout(sizeof(Vec3f)).add(kAttribPosition, 3, kFloat32, 0);
+}
+
+inline VertexLayout MeshSoA::normalLayout () {
+    return VertexLayout(sizeof(Vec3f)).add(kAttribNormal, 3, kFloat32, 0);
+}
+
+inline VertexLayout MeshSoA::texCoordLayout () {
+    return VertexLayout(sizeof(Vec2f)).add(kAttribTexCoord, 2, kFloat32, 0);
+}
+
+inline VertexLayout MeshSoA::colorLayout () {
+    return VertexLayout(sizeof(Color)).add(kAttribColor, 4, kUnorm8, 0);
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_MESHSOA_H */
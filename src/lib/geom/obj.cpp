@@ -0,0 +1,689 @@
+//
+// Wavefront .obj Importer
+//
+#include "../lib.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+namespace sge {
+
+// Log a formatted message with logError().
+static void logErrorf (const char *format, ...) {
+    char message[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    logError(message);
+}
+
+static inline
+void logParseError (const std::string &file, const u32 line, const std::string &el) {
+    logErrorf("Malformed %s in %s at line: %u.",
+              el.c_str(),
+              file.c_str(), line);
+}
+
+static inline
+bool isKeyword (const char *word, const size_t len, const char *keyword) {
+    return len == strlen(keyword) && memcmp(word, keyword, len) == 0;
+}
+
+// Convert a 1-based .obj index, or a negative index counting back from the
+// last element read, to a 0-based index into count elements.
+static inline
+bool resolveIndex (const s32 index, const size_t count, u32 &out) {
+    const s64 i = (index < 0) ? static_cast<s64>(count) + index : static_cast<s64>(index) - 1;
+    if (i < 0 || i >= static_cast<s64>(count)) {
+        return false;
+    }
+    out = static_cast<u32>(i);
+    return true;
+}
+
+// Element counts of a range of lines.
+struct ObjCounts {
+    u32 lines = 0;
+    size_t positions = 0;
+    size_t normals = 0;
+    size_t texCoords = 0;
+};
+
+struct ObjChunk {
+    const char *begin;
+    const char *end;
+
+    ObjCounts first; // Lines and elements before the chunk.
+    ObjCounts next;  // Next line and elements while parsing.
+    ObjCounts count; // Lines and elements in the chunk.
+
+    // groups[0] holds faces before the chunk's first 'g', which belong
+    // to whichever group is open at the start of the chunk.
+    std::vector<ObjGroup> groups;
+    std::string name;
+    bool hasName = false;
+
+    u32 errorLine = 0;
+    const char *errorElement = nullptr;
+};
+
+// Count lines and vertex elements in a chunk with the same tests as
+// readChunk(), so that both agree where each element goes.
+static void countChunk (ObjChunk &chunk) {
+    Scanner input(chunk.begin, chunk.end);
+    ObjCounts &n = chunk.count;
+
+    for (; !input.atEnd(); input.skipLine(), ++n.lines) {
+        const char *word;
+        const size_t len = input.readWord(word);
+
+        if (len == 1 && word[0] == 'v') {
+            ++n.positions;
+        } else if (len == 2 && word[0] == 'v') {
+            n.normals += (word[1] == 'n') ? 1 : 0;
+            n.texCoords += (word[1] == 't') ? 1 : 0;
+        }
+    }
+}
+
+// Resolve a texture or normal index. Some exporters write them for files
+// without any such elements; like positions they must be in range once
+// any have been read, but until then they are ignored.
+static bool resolveOptionalIndex (const s32 index, const size_t count, u32 &out) {
+    out = 0;
+    return count == 0 || resolveIndex(index, count, out);
+}
+
+// Read one face vertex, position[/[texture][/normal]], as 0-based
+// indices with missing indices as 0. Only the elements read so far, given
+// by counts, may be referenced.
+static bool readFaceVertex (Scanner &line, const ObjCounts &counts, u32 (&vertex)[3]) {
+    s32 index;
+
+    vertex[1] = 0;
+    vertex[2] = 0;
+    if (!line.readInt(index) || !resolveIndex(index, counts.positions, vertex[0])) {
+        return false;
+    }
+    if (line.match('/')) {
+        if (line.peek() != '/' &&
+            (!line.readInt(index) || !resolveOptionalIndex(index, counts.texCoords, vertex[1]))) {
+            return false;
+        }
+        if (line.match('/') &&
+            (!line.readInt(index) || !resolveOptionalIndex(index, counts.normals, vertex[2]))) {
+            return false;
+        }
+    }
+
+    const char next = line.peek();
+    return next == '\0' || next == ' ' || next == '\t' || next == '\r' || next == '\n';
+}
+
+// Read the vertices of a face, passing the corners of each triangle to
+// corner in order. n-sided faces are converted to tris as we go, as a fan
+// around the first vertex.
+template <typename Fn>
+static bool parseFaceCorners (Scanner &line, const ObjCounts &counts, const Fn &corner) {
+    u32 first[3] = {};
+    u32 prev[3] = {};
+    u32 cur[3];
+    u32 count = 0;
+
+    for (line.skipSpace(); !line.atEndOfLine(); line.skipSpace(), ++count) {
+        if (!readFaceVertex(line, counts, cur)) {
+            return false;
+        }
+
+        if (count >= 2) {
+            corner(first);
+            corner(prev);
+            corner(cur);
+        } else if (count == 0) {
+            memcpy(first, cur, sizeof(cur));
+        }
+        memcpy(prev, cur, sizeof(cur));
+    }
+
+    return count >= 3;
+}
+
+// Split text at line boundaries into count chunks of about equal size.
+// A chunk is empty if a line spans the whole of its share.
+static std::vector<ObjChunk> splitChunks (const char *begin, const char *end, size_t count) {
+    const size_t size = static_cast<size_t>(end - begin);
+    count = (count > 1) ? count : 1;
+
+    std::vector<ObjChunk> chunks(count);
+    const char *p = begin;
+    for (size_t k = 0; k < count; ++k) {
+        chunks[k].begin = p;
+        if (k + 1 < count) {
+            const char *split = begin + size / count * (k + 1);
+            p = (split > p) ? split : p;
+            const void *newline = memchr(p, '\n', static_cast<size_t>(end - p));
+            p = newline ? static_cast<const char *>(newline) + 1 : end;
+        } else {
+            p = end;
+        }
+        chunks[k].end = p;
+    }
+    return chunks;
+}
+
+bool ObjDocument::readFromFile (const char * const filename, const bool threaded) {
+    const MappedFile file(filename);
+    if (!file.isOpen()) {
+        logErrorf("File not found -- %s.", filename);
+        return false;
+    }
+
+    // Chunks of at least kObjChunkSize bytes, one per worker at most.
+    size_t chunks = threaded ? file.size() / kObjChunkSize : 1;
+    chunks = (chunks < workerCount()) ? chunks : workerCount();
+    return parse(file.data(), file.data() + file.size(), chunks, filename);
+}
+
+bool ObjDocument::parse (const char *begin, const char *end, const size_t chunkCount,
+                         const char * const source) {
+    std::vector<ObjChunk> chunks = splitChunks(begin, end, chunkCount);
+    auto eachChunk = [&](const std::function<void (ObjChunk &)> &fn) {
+        parallelFor(chunks.size(), 1, [&](const size_t begin, const size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                fn(chunks[k]);
+            }
+        });
+    };
+
+    // Count, then place each chunk after those before it.
+    eachChunk(countChunk);
+
+    ObjCounts total;
+    for (ObjChunk &chunk : chunks) {
+        chunk.first = total;
+        chunk.next = total;
+        total.lines += chunk.count.lines;
+        total.positions += chunk.count.positions;
+        total.normals += chunk.count.normals;
+        total.texCoords += chunk.count.texCoords;
+    }
+    mPositions.resize(total.positions);
+    mNormals.resize(total.normals);
+    mTexCoords.resize(total.texCoords);
+    mHasNormals = (total.normals > 0);
+    mHasTexture = (total.texCoords > 0);
+
+    eachChunk([this](ObjChunk &chunk) { readChunk(chunk); });
+
+    // Join the chunks in order, stopping at the first error as a serial
+    // parse would.
+    for (ObjChunk &chunk : chunks) {
+        if (chunk.hasName) {
+            name = std::move(chunk.name);
+        }
+
+        ObjGroup &open = chunk.groups[0];
+        if (!open.positionIndex.empty()) {
+            if (groups.empty()) {
+                groups.emplace_back(ObjGroup("default"));
+            }
+            ObjGroup &last = groups.back();
+            last.positionIndex.insert(last.positionIndex.end(), open.positionIndex.begin(), open.positionIndex.end());
+            last.normalIndex.insert(last.normalIndex.end(), open.normalIndex.begin(), open.normalIndex.end());
+            last.textureIndex.insert(last.textureIndex.end(), open.textureIndex.begin(), open.textureIndex.end());
+        }
+        for (size_t k = 1; k < chunk.groups.size(); ++k) {
+            groups.emplace_back(std::move(chunk.groups[k]));
+        }
+
+        if (chunk.errorElement) {
+            logParseError(source, chunk.errorLine, chunk.errorElement);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ObjDocument::readChunk (ObjChunk &chunk) {
+    Scanner input(chunk.begin, chunk.end);
+    chunk.groups.emplace_back(ObjGroup());
+
+    for (; !input.atEnd(); input.skipLine(), ++chunk.next.lines) {
+        const char *word;
+        const size_t len = input.readWord(word);
+
+        // Skip comments, blank lines and unsupported statements.
+        if (len == 0 || word[0] == '#') {
+            continue;
+        }
+
+        const char *element = nullptr;
+        if (isKeyword(word, len, "v")) {
+            element = parsePosition(input, chunk) ? nullptr : "vertex position";
+        } else if (isKeyword(word, len, "f")) {
+            element = parseFace(input, chunk) ? nullptr : "face";
+        } else if (isKeyword(word, len, "vn")) {
+            element = parseNormal(input, chunk) ? nullptr : "normal";
+        } else if (isKeyword(word, len, "vt")) {
+            element = parseTexCoord(input, chunk) ? nullptr : "texture coordinate";
+        } else if (isKeyword(word, len, "g")) {
+            element = parseGroup(input, chunk) ? nullptr : "group name";
+        } else if (isKeyword(word, len, "o")) {
+            element = parseName(input, chunk) ? nullptr : "object name";
+        }
+
+        if (element) {
+            chunk.errorLine = chunk.next.lines + 1;
+            chunk.errorElement = element;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ObjDocument::parseName (Scanner &line, ObjChunk &chunk) {
+    const char *text;
+    const size_t len = line.readRest(text);
+
+    if (len > 0) {
+        chunk.name.assign(text, len);
+        chunk.hasName = true;
+        return true;
+    }
+
+    return false;
+}
+
+bool ObjDocument::parseGroup (Scanner &line, ObjChunk &chunk) {
+    const char *text;
+    const size_t len = line.readWord(text);
+
+    if (len > 0) {
+        chunk.groups.emplace_back(ObjGroup(std::string(text, len)));
+        return true;
+    } else {
+        chunk.groups.emplace_back(ObjGroup("name."));
+        return false;
+    }
+}
+
+bool ObjDocument::parsePosition (Scanner &line, ObjChunk &chunk) {
+    float x, y, z;
+    Vec3f &p = mPositions[chunk.next.positions++];
+
+    if (line.readFloat(x) && line.readFloat(y) && line.readFloat(z)) {
+        p = Vec3f(x, y, z);
+        return true;
+    } else {
+        p = Vec3f(0.0f, 0.0f, 0.0f);
+        return false;
+    }
+}
+
+bool ObjDocument::parseNormal (Scanner &line, ObjChunk &chunk) {
+    float x, y, z;
+    Vec3f &n = mNormals[chunk.next.normals++];
+
+    if (line.readFloat(x) && line.readFloat(y) && line.readFloat(z)) {
+        n = Vec3f(x, y, z);
+        return true;
+    } else {
+        n = Vec3f(0.0f, 0.0f, 0.0f);
+        return false;
+    }
+}
+
+bool ObjDocument::parseTexCoord (Scanner &line, ObjChunk &chunk) {
+    float x, y;
+    Vec2f &t = mTexCoords[chunk.next.texCoords++];
+
+    if (line.readFloat(x) && line.readFloat(y)) {
+        t = Vec2f(x, y);
+        return true;
+    } else {
+        t = Vec2f(0.0f, 0.0f);
+        return false;
+    }
+}
+
+bool ObjDocument::parseFace (Scanner &line, ObjChunk &chunk) {
+
+    // Add new faces to the most recent group.
+    ObjGroup *curGroup = &chunk.groups.back();
+
+    return parseFaceCorners(line, chunk.next, [curGroup](const u32 (&v)[3]) {
+        curGroup->positionIndex.push_back(v[0]);
+        curGroup->textureIndex.push_back(v[1]);
+        curGroup->normalIndex.push_back(v[2]);
+    });
+}
+
+// --------------------------------------------------------------------------
+
+namespace {
+
+// Mesh vertex of each distinct (position, texture, normal) index triple,
+// by open addressing.
+class ObjVertexMap {
+public:
+    explicit ObjVertexMap (const size_t expected) : mCount{0} {
+        size_t capacity = 64;
+        while (capacity < expected * 2) {
+            capacity *= 2;
+        }
+        mKeys.resize(capacity);
+        mValues.assign(capacity, kEmpty);
+    }
+
+    // Find the vertex of a triple, or add vertex as its vertex.
+    // @return The vertex of the triple, and whether it was added.
+    u32 insert (const u32 p, const u32 t, const u32 n, const u32 vertex, bool &added) {
+        if ((mCount + 1) * 2 > mKeys.size()) {
+            grow();
+        }
+
+        const Key key = {{p, t, n}};
+        size_t slot = find(key);
+        added = (mValues[slot] == kEmpty);
+        if (added) {
+            mKeys[slot] = key;
+            mValues[slot] = vertex;
+            ++mCount;
+        }
+        return mValues[slot];
+    }
+
+private:
+    static constexpr u32 kEmpty = 0xFFFFFFFF;
+
+    struct Key {
+        u32 index[3];
+    };
+
+    std::vector<Key> mKeys;
+    std::vector<u32> mValues;
+    size_t mCount;
+
+    size_t find (const Key &key) const {
+        const size_t mask = mKeys.size() - 1;
+        const u64 h = ((static_cast<u64>(key.index[0]) * 0x9E3779B97F4A7C15ull) ^
+                       (static_cast<u64>(key.index[1]) * 0xC2B2AE3D27D4EB4Full) ^
+                       (static_cast<u64>(key.index[2]) * 0x165667B19E3779F9ull));
+        size_t slot = static_cast<size_t>(h >> 32) & mask;
+        while (mValues[slot] != kEmpty && memcmp(&mKeys[slot], &key, sizeof(Key)) != 0) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void grow () {
+        std::vector<Key> keys(mKeys.size() * 2);
+        std::vector<u32> values(mKeys.size() * 2, kEmpty);
+        mKeys.swap(keys);
+        mValues.swap(values);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (values[i] != kEmpty) {
+                const size_t slot = find(keys[i]);
+                mKeys[slot] = keys[i];
+                mValues[slot] = values[i];
+            }
+        }
+    }
+};
+
+constexpr u32 ObjVertexMap::kEmpty;
+
+} /* namespace */
+
+Mesh meshFromObjDocument (const ObjDocument &doc) {
+    Mesh m;
+
+    if (doc.isValid()) {
+        size_t cornerCount = 0;
+        for (const auto &g : doc.groups) {
+            cornerCount += g.vertexCount();
+        }
+
+        // Most corners share their position's vertex, so expect about one
+        // vertex per position, and let the map grow past that if needed.
+        ObjVertexMap vertexMap(doc.vertexCount());
+        m.vertices.reserve(doc.vertexCount());
+        m.indices.reserve(cornerCount);
+
+        const Color col = Color(255, 255, 255, 255);
+        for (const auto &g : doc.groups) {
+
+            for (size_t k = 0, kMax = g.vertexCount(); k < kMax; ++k) {
+                const u32 p = g.positionIndex[k];
+                const u32 t = doc.hasTexture() ? g.textureIndex[k] : 0;
+                const u32 n = doc.hasNormals() ? g.normalIndex[k] : 0;
+
+                bool added;
+                const u32 vertex = vertexMap.insert(p, t, n, m.vertCount(), added);
+                if (added) {
+                    m.addVertex(Vertex(doc.position(p),
+                                       doc.hasNormals() ? doc.normal(n) : Vec3f(),
+                                       doc.hasTexture() ? doc.texCoord(t) : Vec2f(),
+                                       col));
+                }
+                m.indices.push_back(vertex);
+            }
+        }
+
+        if (!doc.hasNormals()) {
+            m.generateNormals();
+        }
+
+    } else {
+        logErrorf("ObjDocument is invalid -- %s", doc.name.c_str());
+    }
+
+    return m;
+}
+
+Mesh meshFromObjDocument (const char * const filename, const bool threaded) {
+    ObjDocument doc = ObjDocument(filename, threaded);
+    return meshFromObjDocument(doc);
+}
+
+// --------------------------------------------------------------------------
+
+namespace {
+
+// Builds the Mesh of each group of a streamed .obj file.
+class ObjStream {
+public:
+    ObjStream (const char * const filename, const ObjGroupCallback &callback, const size_t maxFaces)
+          : mFilename{filename}, mCallback(callback), mMaxFaces{maxFaces},
+            mVertexMap(0), mLineNumber{1} {
+        mGroup.object = "untitled_obj";
+        mGroup.name = "default";
+        mGroup.part = 0;
+    }
+
+    // Parse the whole lines in [begin, end).
+    bool parse (const char *begin, const char *end);
+
+    // Pass on the last group.
+    void finish () {
+        flush();
+    }
+
+private:
+    const char *mFilename;
+    const ObjGroupCallback &mCallback;
+    const size_t mMaxFaces;
+
+    std::vector<Vec3f> mPositions;
+    std::vector<Vec3f> mNormals;
+    std::vector<Vec2f> mTexCoords;
+    ObjCounts mCounts;
+
+    ObjMeshGroup mGroup;
+    ObjVertexMap mVertexMap;
+    u32 mLineNumber;
+
+    bool parseFace (Scanner &line);
+
+    // Pass the group's faces so far to the callback, and start a new part.
+    void flush () {
+        if (mGroup.mesh.indices.empty()) {
+            return;
+        }
+        if (mNormals.empty()) {
+            mGroup.mesh.generateNormals();
+        }
+        mCallback(mGroup);
+        mGroup.mesh = Mesh();
+        mVertexMap = ObjVertexMap(0);
+        ++mGroup.part;
+    }
+
+    void startGroup () {
+        flush();
+        mGroup.part = 0;
+    }
+};
+
+bool ObjStream::parse (const char *begin, const char *end) {
+    Scanner input(begin, end);
+
+    for (; !input.atEnd(); input.skipLine(), ++mLineNumber) {
+        const char *word;
+        const size_t len = input.readWord(word);
+
+        // Skip comments, blank lines and unsupported statements.
+        if (len == 0 || word[0] == '#') {
+            continue;
+        }
+
+        const char *element = nullptr;
+        if (isKeyword(word, len, "v")) {
+            float x = 0.0f, y = 0.0f, z = 0.0f;
+            element = (input.readFloat(x) && input.readFloat(y) && input.readFloat(z)) ? nullptr : "vertex position";
+            mPositions.emplace_back(x, y, z);
+        } else if (isKeyword(word, len, "f")) {
+            element = parseFace(input) ? nullptr : "face";
+        } else if (isKeyword(word, len, "vn")) {
+            float x = 0.0f, y = 0.0f, z = 0.0f;
+            element = (input.readFloat(x) && input.readFloat(y) && input.readFloat(z)) ? nullptr : "normal";
+            mNormals.emplace_back(x, y, z);
+        } else if (isKeyword(word, len, "vt")) {
+            float x = 0.0f, y = 0.0f;
+            element = (input.readFloat(x) && input.readFloat(y)) ? nullptr : "texture coordinate";
+            mTexCoords.emplace_back(x, y);
+        } else if (isKeyword(word, len, "g")) {
+            const char *text;
+            const size_t textLen = input.readWord(text);
+            startGroup();
+            mGroup.name.assign(text, textLen);
+            element = (textLen > 0) ? nullptr : "group name";
+        } else if (isKeyword(word, len, "o")) {
+            const char *text;
+            const size_t textLen = input.readRest(text);
+            startGroup();
+            mGroup.object.assign(text, textLen);
+            mGroup.name = "default";
+            element = (textLen > 0) ? nullptr : "object name";
+        }
+
+        if (element) {
+            logParseError(mFilename, mLineNumber, element);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ObjStream::parseFace (Scanner &line) {
+    mCounts.positions = mPositions.size();
+    mCounts.normals = mNormals.size();
+    mCounts.texCoords = mTexCoords.size();
+
+    Mesh &m = mGroup.mesh;
+    const Color col = Color(255, 255, 255, 255);
+    const bool ok = parseFaceCorners(line, mCounts, [&](const u32 (&v)[3]) {
+        const u32 t = mTexCoords.empty() ? 0 : v[1];
+        const u32 n = mNormals.empty() ? 0 : v[2];
+
+        bool added;
+        const u32 vertex = mVertexMap.insert(v[0], t, n, m.vertCount(), added);
+        if (added) {
+            m.addVertex(Vertex(mPositions[v[0]],
+                               mNormals.empty() ? Vec3f() : mNormals[n],
+                               mTexCoords.empty() ? Vec2f() : mTexCoords[t],
+                               col));
+        }
+        m.indices.push_back(vertex);
+    });
+
+    if (ok && mMaxFaces > 0 && m.faceCount() >= mMaxFaces) {
+        flush();
+    }
+    return ok;
+}
+
+} /* namespace */
+
+bool readObjStream (const char * const filename, const ObjGroupCallback &callback,
+                    const size_t maxFaces, const size_t blockSize) {
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        logErrorf("File not found -- %s.", filename);
+        return false;
+    }
+
+    ObjStream stream(filename, callback, maxFaces);
+    std::vector<char> block((blockSize > 0) ? blockSize : 1);
+    size_t kept = 0; // Bytes of an unfinished line carried over.
+    bool ok = true;
+
+    while (ok) {
+        const size_t read = fread(block.data() + kept, 1, block.size() - kept, file);
+        const bool last = (read < block.size() - kept);
+        const char *begin = block.data();
+        const char *end = begin + kept + read;
+
+        // Parse up to the end of the last whole line, or everything at the
+        // end of the file.
+        const char *stop = end;
+        if (!last) {
+            while (stop > begin && stop[-1] != '\n') {
+                --stop;
+            }
+            if (stop == begin) {
+                // One line longer than the block.
+                kept += read;
+                block.resize(block.size() * 2);
+                continue;
+            }
+        }
+
+        ok = stream.parse(begin, stop);
+        kept = static_cast<size_t>(end - stop);
+        memmove(block.data(), stop, kept);
+        if (last) {
+            break;
+        }
+    }
+
+    if (ferror(file)) {
+        logErrorf("Failed to read -- %s.", filename);
+        ok = false;
+    }
+    fclose(file);
+
+    if (ok) {
+        stream.finish();
+    }
+    return ok;
+}
+
+} /* namespace sge */
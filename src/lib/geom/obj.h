@@ -0,0 +1,215 @@
+/*---  Obj.h - Importer for Wavefront Obj Header  ------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Defines functions for converting .obj documents to
+ *   internal mesh format.
+ */
+#ifndef __SGE_OBJ_H
+#define __SGE_OBJ_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#define DEFAULT_MESH_SIZE 128
+#define DEFAULT_GROUP_SIZE 8
+
+namespace sge {
+
+/** Smallest part of a .obj file worth parsing on another thread, in bytes. */
+static constexpr size_t kObjChunkSize = 1 << 20;
+
+/** Lines of a .obj file parsed together, defined in obj.cpp. */
+struct ObjChunk;
+
+/**
+ * The Object document stores lists of Vec2f and Vec3f for the position,
+ * normal and texture data. Faces are represented by storing indexes into
+ * the global lists.
+ */
+class ObjGroup {
+public:
+    std::string name;
+    std::vector<u32> positionIndex;
+    std::vector<u32> normalIndex;
+    std::vector<u32> textureIndex;
+
+public:
+    ObjGroup (const std::string &p_name = "") : name(p_name) { }
+
+    /** @return The number of vertices in this group. */
+    size_t vertexCount () const { return positionIndex.size(); }
+
+    /** @return The number of faces in the group. */
+    size_t faceCount () const { return positionIndex.size() / 3; }
+};
+
+/**
+ * Data from parsed .obj document.
+ *
+ * A threaded document splits the file at line boundaries into chunks
+ * which are parsed concurrently. A first pass counts the lines and
+ * vertex elements in each chunk, and prefix sums of those counts give
+ * every chunk the global position of its first element, so that each
+ * chunk writes its elements straight into place and resolves face
+ * indices, including relative ones, exactly as a serial parse would.
+ * The groups of each chunk are then joined in file order, faces at the
+ * start of a chunk continuing the group left open by the chunk before.
+ */
+class ObjDocument {
+public:
+    std::string name;
+    std::vector<ObjGroup> groups;
+
+public:
+    explicit ObjDocument (const char * const filename, const bool threaded = false);
+
+    /**
+     * Parse .obj text in [begin, end), split into at most chunks chunks.
+     * source names the text in error messages.
+     */
+    ObjDocument (const char *begin, const char *end, const size_t chunks,
+                 const char * const source = "<memory>");
+
+    /** @return True if this .obj document uses normals. */
+    bool hasNormals () const { return mHasNormals; }
+
+    /** @return True is this .obj document uses textures. */
+    bool hasTexture () const { return mHasTexture; }
+
+    /** @return The number of vertices in this .obj document. */
+    size_t vertexCount () const;
+
+    /**
+     * Count the faces in this .obj document as the sum of the facecounts of
+     * each object group.
+     *
+     * @return The number of faces in this .obj document.
+     */
+    size_t faceCount () const;
+
+    /** @return True is this .obj document was parsed successfully. */
+    bool isValid () const { return mIsValid; }
+
+    Vec3f position (const s32 index) const { return mPositions[index]; }
+    Vec3f normal (const s32 index) const { return mNormals[index]; }
+    Vec2f texCoord (const s32 index) const { return mTexCoords[index]; }
+
+private:
+    std::vector<Vec3f> mPositions;
+    std::vector<Vec3f> mNormals;
+    std::vector<Vec2f> mTexCoords;
+
+    bool mHasNormals;
+    bool mHasTexture;
+    bool mIsValid;
+
+    void init ();
+    bool readFromFile (const char * const filename, const bool threaded);
+    bool parse (const char *begin, const char *end, const size_t chunkCount, const char * const source);
+    bool readChunk (ObjChunk &chunk);
+    bool parseName (Scanner &line, ObjChunk &chunk);
+    bool parseGroup (Scanner &line, ObjChunk &chunk);
+    bool parsePosition (Scanner &line, ObjChunk &chunk);
+    bool parseNormal (Scanner &line, ObjChunk &chunk);
+    bool parseTexCoord (Scanner &line, ObjChunk &chunk);
+    bool parseFace (Scanner &line, ObjChunk &chunk);
+};
+
+// --------------------------------------------------------------------------
+
+inline ObjDocument::ObjDocument (const char * const filename, const bool threaded) {
+    init();
+    mIsValid = readFromFile(filename, threaded);
+}
+
+inline ObjDocument::ObjDocument (const char *begin, const char *end, const size_t chunks,
+                                 const char * const source) {
+    init();
+    mIsValid = parse(begin, end, chunks, source);
+}
+
+inline void ObjDocument::init () {
+    name = "untitled_obj";
+
+    groups.reserve(DEFAULT_GROUP_SIZE);
+    mPositions.reserve(DEFAULT_MESH_SIZE);
+    mNormals.reserve(DEFAULT_MESH_SIZE);
+    mTexCoords.reserve(DEFAULT_MESH_SIZE);
+
+    mHasNormals = false;
+    mHasTexture = false;
+    mIsValid = false;
+}
+
+inline size_t ObjDocument::vertexCount () const {
+    return mPositions.size();
+}
+
+inline size_t ObjDocument::faceCount () const {
+    size_t result = 0;
+
+    for (const auto &group : groups) {
+        result += group.faceCount();
+    }
+
+    return result;
+}
+
+// --------------------------------------------------------------------------
+
+/**
+ * Convert a parsed ObjDocument to a Mesh.
+ */
+Mesh meshFromObjDocument (const ObjDocument &doc);
+
+/**
+ * Convert an ObjDocument stored in a file resource
+ * to a Mesh, parsing the file on several threads if threaded.
+ */
+Mesh meshFromObjDocument (const char * const filename, const bool threaded = false);
+
+// --------------------------------------------------------------------------
+
+/** Bytes of an .obj file read at a time by readObjStream(), by default. */
+static constexpr size_t kObjStreamBlockSize = 1 << 20;
+
+/**
+ * A group of faces from an .obj file read by readObjStream().
+ */
+struct ObjMeshGroup {
+    std::string object; /**< Name from the last 'o', or "untitled_obj". */
+    std::string name;   /**< Name from the last 'g' of the object, or "default". */
+    u32 part;           /**< Parts of a group split by maxFaces count from 0. */
+    Mesh mesh;
+};
+
+typedef std::function<void (ObjMeshGroup &group)> ObjGroupCallback;
+
+/**
+ * Read an .obj file blockSize bytes at a time, passing each group of
+ * faces to callback as an indexed Mesh as soon as the group ends: at the
+ * next 'g' or 'o', or the end of the file. If maxFaces isn't 0, a group is
+ * also passed on in parts of at most maxFaces faces. The callback may move
+ * the mesh out of the group.
+ *
+ * Faces may use any earlier vertex element, so positions, normals and
+ * texture coordinates are kept until the end of the file, but only one
+ * group's faces and mesh are held at a time. Groups get generated normals
+ * if no normals have been read by the time they end.
+ *
+ * @return True if the whole file was read. Groups before a parse error
+ *   have already been passed to callback.
+ */
+bool readObjStream (const char * const filename, const ObjGroupCallback &callback,
+                    const size_t maxFaces = 0, const size_t blockSize = kObjStreamBlockSize);
+
+} /* namespace sge */
+
+#endif /* __SGE_OBJ_H */
@@ -0,0 +1,76 @@
+//
+// PackedMesh Implementation.
+//
+#include "../lib.h"
+
+namespace sge {
+
+PackedMesh::PackedMesh (const Mesh &mesh)
+      : center{Vec3f_Zero}, scale{1.0f}, indices{mesh.indices} {
+    Aabb bounds;
+    for (const Vertex &v : mesh.vertices) {
+        bounds.addPoint(v.position);
+    }
+
+    if (!mesh.vertices.empty()) {
+        const Vec3f size = bounds.max - bounds.min;
+        center = bounds.center();
+        scale = math::max(size.x, math::max(size.y, size.z)) * 0.5f;
+        if (scale == 0.0f) {
+            scale = 1.0f; // Every vertex at the centre.
+        }
+    }
+
+    const float invScale = 1.0f / scale;
+    vertices.reserve(mesh.vertices.size());
+    for (const Vertex &v : mesh.vertices) {
+        const Vec3f p = (v.position - center) * invScale;
+        const Vec2f n = math::octEncode(v.normal);
+
+        PackedVertex pv;
+        pv.position[0] = math::packSnorm16(p.x);
+        pv.position[1] = math::packSnorm16(p.y);
+        pv.position[2] = math::packSnorm16(p.z);
+        pv.normal[0] = math::packSnorm16(n.x);
+        pv.normal[1] = math::packSnorm16(n.y);
+        pv.texCoord = Vec2h(v.texCoord);
+        pv.color = v.color;
+        vertices.push_back(pv);
+    }
+}
+
+Vertex PackedMesh::vertex (const size_t i) const {
+    const PackedVertex &pv = vertices[i];
+    const Vec3f p(math::unpackSnorm16(pv.position[0]), math::unpackSnorm16(pv.position[1]),
+                  math::unpackSnorm16(pv.position[2]));
+    const Vec2f n(math::unpackSnorm16(pv.normal[0]), math::unpackSnorm16(pv.normal[1]));
+
+    return Vertex(center + p * scale, math::octDecode(n), pv.texCoord.toVec2f(), pv.color);
+}
+
+void PackedMesh::optimize () {
+    // Overdraw sorting only compares directions, so the positions don't
+    // need decodeMatrix().
+    std::vector<Vec3f> positions;
+    positions.reserve(vertices.size());
+    for (const PackedVertex &pv : vertices) {
+        positions.emplace_back(math::unpackSnorm16(pv.position[0]), math::unpackSnorm16(pv.position[1]),
+                               math::unpackSnorm16(pv.position[2]));
+    }
+
+    optimizeVertexCache(indices, vertCount());
+    optimizeOverdraw(indices, positions);
+    optimizeVertexFetch(vertices, indices);
+}
+
+Mesh PackedMesh::unpack () const {
+    Mesh m;
+    m.vertices.reserve(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        m.addVertex(vertex(i));
+    }
+    m.indices = indices;
+    return m;
+}
+
+} /* namespace sge */
@@ -0,0 +1,128 @@
+/*---  PackedMesh.h - Compact Mesh Storage  -------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Defines PackedVertex, a 20 byte vertex, and PackedMesh, a Mesh
+ *   stored with it for upload to the GPU.
+ *
+ * Positions are snorm16 relative to the mesh bounds: the bounds are
+ * centred on the origin and scaled uniformly so the longest side spans
+ * -1..1. decodeMatrix() undoes this and should be applied before the
+ * model matrix. Being a uniform scale it does not disturb normals.
+ *
+ * Normals have two components, which a vertex shader unfolds as
+ * math::octDecode() does:
+ *
+ * <pre>
+ *   vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+ *   vec2 s = mix(vec2(-1.0), vec2(1.0), greaterThanEqual(e, vec2(0.0)));
+ *   if (n.z < 0.0) n.xy = (1.0 - abs(e.yx)) * s;
+ *   n = normalize(n);
+ * </pre>
+ *
+ * For a mesh a few metres across, positions are accurate to well under a
+ * millimetre, normals to 0.005 degrees and texture coordinates in 0..1 to
+ * 1/2048.
+ */
+#ifndef __SGE_PACKEDMESH_H
+#define __SGE_PACKEDMESH_H
+
+#include <cstddef> // offsetof
+#include <vector>
+
+#include "vertexlayout.h"
+
+namespace sge {
+
+/**
+ * Compact Drawable Vertex.
+ */
+class PackedVertex {
+public:
+    s16 position[4] = {0, 0, 0, 0}; /**< snorm16 x, y, z; w is padding. */
+    s16 normal[2] = {0, 0};         /**< snorm16 octahedral encoding. */
+    Vec2h texCoord;
+    Color color{255, 255, 255};
+
+public:
+    /**
+     * Layout of a PackedVertex in a vertex buffer.
+     */
+    static VertexLayout layout ();
+};
+
+static_assert(sizeof(PackedVertex) == 20, "PackedVertex must be tightly packed");
+
+class PackedMesh {
+public:
+    /** Empty mesh. */
+    PackedMesh () : center{Vec3f_Zero}, scale{1.0f} { }
+
+    /**
+     * Pack every vertex of mesh.
+     */
+    explicit PackedMesh (const Mesh &mesh);
+
+    u32 vertCount () const;
+
+    u32 indexCount () const;
+
+    /**
+     * Get vertex i, unpacked.
+     */
+    Vertex vertex (const size_t i) const;
+
+    /**
+     * Unpack every vertex into a Mesh.
+     */
+    Mesh unpack () const;
+
+    /**
+     * Transform from packed positions to mesh space, i.e. a uniform scale
+     * by scale followed by a translation to center.
+     */
+    Mat4f decodeMatrix () const;
+
+    /**
+     * Reorder triangles and vertices as Mesh::optimize() does.
+     */
+    void optimize ();
+
+public:
+    Vec3f center; /**< Centre of the mesh bounds. */
+    float scale;  /**< Half the longest side of the mesh bounds. */
+    std::vector<PackedVertex> vertices;
+    std::vector<u32> indices;
+};
+
+// --------------------------------------------------------------------------
+
+inline VertexLayout PackedVertex::layout () {
+    return VertexLayout(sizeof(PackedVertex))
+          .add(kAttribPosition, 3, kSnorm16, offsetof(PackedVertex, position))
+          .add(kAttribNormal, 2, kSnorm16, offsetof(PackedVertex, normal))
+          .add(kAttribTexCoord, 2, kFloat16, offsetof(PackedVertex, texCoord))
+          .add(kAttribColor, 4, kUnorm8, offsetof(PackedVertex, color));
+}
+
+inline u32 PackedMesh::vertCount () const {
+    return static_cast<u32>(vertices.size());
+}
+
+inline u32 PackedMesh::indexCount () const {
+    return static_cast<u32>(indices.size());
+}
+
+inline Mat4f PackedMesh::decodeMatrix () const {
+    return Mat4f(Vec4f(scale, 0.0f, 0.0f, 0.0f), Vec4f(0.0f, scale, 0.0f, 0.0f),
+                 Vec4f(0.0f, 0.0f, scale, 0.0f), Vec4f(center, 1.0f));
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_PACKEDMESH_H */
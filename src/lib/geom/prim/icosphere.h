@@ -14,23 +14,36 @@
 
 namespace sge {
 
+/** Most subdivisions an ICOSphere can have, giving 20 * 4^10 faces. */
+static constexpr u32 kMaxIcoSubdivisions = 10;
+
 class ICOSphere {
 public:
-    ICOSphere (const Vec3f &pCenter, const float pSize)
-        : mCenter(pCenter) {
+    /**
+     * A sphere of diameter pSize made by splitting each face of an
+     * icosahedron into four, pSubdivisions times. Level 0 is the
+     * icosahedron itself, with 20 faces; each level has 4 times as many.
+     */
+    ICOSphere (const Vec3f &pCenter, const float pSize, const u32 pSubdivisions = 0)
+        : mCenter(pCenter), mSubdivisions(pSubdivisions) {
         mHalfSize = Vec3f(pSize * 0.5f);
     }
 
-    ICOSphere (const Vec3f &pCenter, const Vec3f &pSize)
-        : mCenter(pCenter) {
+    ICOSphere (const Vec3f &pCenter, const Vec3f &pSize, const u32 pSubdivisions = 0)
+        : mCenter(pCenter), mSubdivisions(pSubdivisions) {
         mHalfSize = pSize * 0.5f;
     }
 
+    /**
+     * Build the indexed sphere. Every vertex is shared by all of the
+     * faces around it.
+     */
     Mesh toMesh () const;
 
 private:
     Vec3f mCenter;
     Vec3f mHalfSize;
+    u32 mSubdivisions;
 };
 
 } /* namespace sge */
@@ -3,9 +3,43 @@
 //
 #include "../../lib.h"
 
+#include <algorithm>
+
 namespace sge {
 
-static const Color kDefaultColor = Color::fromHex("#FFFFFF");
+static constexpr Color kDefaultColor = Color::fromHex("#FFFFFF");
+
+//    8    7
+//  5    6
+//
+//    4    3
+//  1    2
+//
+// Corners of a cube with half size 1 about the origin.
+static constexpr Vec3f kCubeCorners[8] = {
+    // Bottom
+    Vec3f(-1.0f, -1.0f,  1.0f), Vec3f( 1.0f, -1.0f,  1.0f),
+    Vec3f( 1.0f, -1.0f, -1.0f), Vec3f(-1.0f, -1.0f, -1.0f),
+
+    // Top
+    Vec3f(-1.0f,  1.0f,  1.0f), Vec3f( 1.0f,  1.0f,  1.0f),
+    Vec3f( 1.0f,  1.0f, -1.0f), Vec3f(-1.0f,  1.0f, -1.0f)
+};
+
+// The golden ratio, (1 + sqrt(5)) / 2.
+static constexpr float kIcoT = (1.0f + 2.2360680f) * 0.5f;
+
+// Vertices of an icosahedron: three orthogonal golden rectangles.
+static constexpr Vec3f kIcoPoints[12] = {
+    Vec3f(-1.0f, kIcoT, 0.0f), Vec3f(1.0f, kIcoT, 0.0f),
+    Vec3f(-1.0f, -kIcoT, 0.0f), Vec3f(1.0f, -kIcoT, 0.0f),
+
+    Vec3f(0.0f, -1.0f, kIcoT), Vec3f(0.0f, 1.0f, kIcoT),
+    Vec3f(0.0f, -1.0f, -kIcoT), Vec3f(0.0f, 1.0f, -kIcoT),
+
+    Vec3f(kIcoT, 0.0f, -1.0f), Vec3f(kIcoT, 0.0f, 1.0f),
+    Vec3f(-kIcoT, 0.0f, -1.0f), Vec3f(-kIcoT, 0.0f, 1.0f)
+};
 
 // Plane -> Mesh
 Mesh Plane::toMesh () const {
@@ -29,24 +63,17 @@ Mesh Plane::toMesh () const {
 Mesh Cube::toMesh () const {
     Mesh m;
 
-    //    8    7
-    //  5    6
-    //
-    //    4    3
-    //  1    2
-    //
-
     // Bottom Vecs
-    Vec3f v1 = Vec3f(mCenter.x - mHalfSize.x, mCenter.y - mHalfSize.y, mCenter.z + mHalfSize.z);
-    Vec3f v2 = Vec3f(mCenter.x + mHalfSize.x, mCenter.y - mHalfSize.y, mCenter.z + mHalfSize.z);
-    Vec3f v3 = Vec3f(mCenter.x + mHalfSize.x, mCenter.y - mHalfSize.y, mCenter.z - mHalfSize.z);
-    Vec3f v4 = Vec3f(mCenter.x - mHalfSize.x, mCenter.y - mHalfSize.y, mCenter.z - mHalfSize.z);
+    Vec3f v1 = mCenter + kCubeCorners[0] * mHalfSize;
+    Vec3f v2 = mCenter + kCubeCorners[1] * mHalfSize;
+    Vec3f v3 = mCenter + kCubeCorners[2] * mHalfSize;
+    Vec3f v4 = mCenter + kCubeCorners[3] * mHalfSize;
 
     // Top Vecs
-    Vec3f v5 = Vec3f(mCenter.x - mHalfSize.x, mCenter.y + mHalfSize.y, mCenter.z + mHalfSize.z);
-    Vec3f v6 = Vec3f(mCenter.x + mHalfSize.x, mCenter.y + mHalfSize.y, mCenter.z + mHalfSize.z);
-    Vec3f v7 = Vec3f(mCenter.x + mHalfSize.x, mCenter.y + mHalfSize.y, mCenter.z - mHalfSize.z);
-    Vec3f v8 = Vec3f(mCenter.x - mHalfSize.x, mCenter.y + mHalfSize.y, mCenter.z - mHalfSize.z);
+    Vec3f v5 = mCenter + kCubeCorners[4] * mHalfSize;
+    Vec3f v6 = mCenter + kCubeCorners[5] * mHalfSize;
+    Vec3f v7 = mCenter + kCubeCorners[6] * mHalfSize;
+    Vec3f v8 = mCenter + kCubeCorners[7] * mHalfSize;
 
     // Top
     m.autoQuad(
@@ -93,60 +120,122 @@ Mesh Cube::toMesh () const {
     return m;
 }
 
+// Faces of the icosahedron, wound counter-clockwise from outside.
+static constexpr u32 kIcoFaces[20][3] = {
+    {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+    {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+    {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+    {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}
+};
+
+namespace {
+
+// The vertex made at the midpoint of each edge, keyed by the edge's end
+// points, in an open addressing table sized for the most edges of any
+// level.
+class EdgeMidpoints {
+public:
+    explicit EdgeMidpoints (const u32 maxEdges) {
+        u32 capacity = 64;
+        while (capacity < maxEdges * 2) {
+            capacity *= 2;
+        }
+        mKeys.resize(capacity);
+        mValues.resize(capacity);
+        clear();
+    }
+
+    void clear () {
+        std::fill(mKeys.begin(), mKeys.end(), kEmpty);
+    }
+
+    // Index of the midpoint of edge (a, b), added to positions if it is
+    // new.
+    u32 midpoint (const u32 a, const u32 b, std::vector<Vec3f> &positions) {
+        const u64 key = (a < b) ? ((static_cast<u64>(a) << 32) | b) : ((static_cast<u64>(b) << 32) | a);
+        const size_t mask = mKeys.size() - 1;
+
+        size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        while (mKeys[slot] != kEmpty) {
+            if (mKeys[slot] == key) {
+                return mValues[slot];
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        const u32 index = static_cast<u32>(positions.size());
+        positions.push_back((positions[a] + positions[b]).normalize());
+        mKeys[slot] = key;
+        mValues[slot] = index;
+        return index;
+    }
+
+private:
+    static constexpr u64 kEmpty = ~0ull;
+
+    std::vector<u64> mKeys;
+    std::vector<u32> mValues;
+};
+
+constexpr u64 EdgeMidpoints::kEmpty;
+
+} /* namespace */
+
 // ICOSphere -> Mesh
 Mesh ICOSphere::toMesh () const {
-    Mesh m;
-
-    Vec3f points[12];
+    verify(mSubdivisions <= kMaxIcoSubdivisions);
 
-    float t = (1.0f + sqrtf(5.0f)) * 0.5f;
+    // Each level splits every face in four, and a closed triangle
+    // mesh has E = 3F / 2 and V = E - F + 2.
+    const u32 faceCount = 20u << (2 * mSubdivisions);
+    const u32 vertexCount = faceCount / 2 + 2;
 
-    points[0] = Vec3f(-1.0f, t, 0);
-    points[1] = Vec3f(1.0f, t, 0);
-    points[2] = Vec3f(-1.0f, -t, 0);
-    points[3] = Vec3f(1.0f, -t, 0);
+    std::vector<Vec3f> positions;
+    positions.reserve(vertexCount);
+    for (const Vec3f &p : kIcoPoints) {
+        positions.push_back(p.normalize());
+    }
 
-    points[4] = Vec3f(0, -1, t);
-    points[5] = Vec3f(0, 1, t);
-    points[6] = Vec3f(0, -1, -t);
-    points[7] = Vec3f(0, 1, -t);
+    std::vector<u32> indices;
+    indices.reserve(faceCount * 3);
+    for (const auto &f : kIcoFaces) {
+        indices.insert(indices.end(), f, f + 3);
+    }
 
-    points[8] = Vec3f(t, 0, -1);
-    points[9] = Vec3f(t, 0, 1);
-    points[10] = Vec3f(-t, 0, -1);
-    points[11] = Vec3f(-t, 0, 1);
+    std::vector<u32> next;
+    next.reserve(faceCount * 3);
+    EdgeMidpoints midpoints(faceCount * 3 / 8);
+
+    // Each face (a, b, c) becomes the three corner faces (a, ab, ca),
+    // (ab, b, bc), (ca, bc, c) and the middle face (ab, bc, ca), all wound
+    // the same way, where ab is the midpoint of a and b pushed out onto
+    // the sphere.
+    for (u32 level = 0; level < mSubdivisions; ++level) {
+        midpoints.clear();
+        next.clear();
+        for (size_t t = 0; t < indices.size(); t += 3) {
+            const u32 a = indices[t];
+            const u32 b = indices[t + 1];
+            const u32 c = indices[t + 2];
+            const u32 ab = midpoints.midpoint(a, b, positions);
+            const u32 bc = midpoints.midpoint(b, c, positions);
+            const u32 ca = midpoints.midpoint(c, a, positions);
+            const u32 split[12] = {a, ab, ca, ab, b, bc, ca, bc, c, ab, bc, ca};
+            next.insert(next.end(), split, split + 12);
+        }
+        indices.swap(next);
+    }
 
+    Mesh m;
+    m.vertices.reserve(vertexCount);
     // TODO Figure out how to project a texture properly, for now: Planar.
-    for (auto &p : points) {
-        m.addVertex(Vertex(p * mHalfSize + mCenter, p.normalize(),
+    for (const Vec3f &p : positions) {
+        m.addVertex(Vertex(p * mHalfSize + mCenter, p,
                            Vec2f(math::toRatio(p.x, -1.0f, 1.0f),
                                  math::toRatio(p.y, -1.0f, 1.0f)),
                            kDefaultColor));
     }
-
-    m.addFace(0, 11, 5);
-    m.addFace(0, 5, 1);
-    m.addFace(0, 1, 7);
-    m.addFace(0, 7, 10);
-    m.addFace(0, 10, 11);
-
-    m.addFace(1, 5, 9);
-    m.addFace(5, 11, 4);
-    m.addFace(11, 10, 2);
-    m.addFace(10, 7, 6);
-    m.addFace(7, 1, 8);
-
-    m.addFace(3, 9, 4);
-    m.addFace(3, 4, 2);
-    m.addFace(3, 2, 6);
-    m.addFace(3, 6, 8);
-    m.addFace(3, 8, 9);
-
-    m.addFace(4, 9, 5);
-    m.addFace(2, 4, 11);
-    m.addFace(6, 2, 10);
-    m.addFace(8, 6, 7);
-    m.addFace(9, 8, 1);
+    m.indices = std::move(indices);
 
     return m;
 }
@@ -12,6 +12,10 @@
 #ifndef __SGE_VERTEX_H
 #define __SGE_VERTEX_H
 
+#include <cstddef> // offsetof
+
+#include "vertexlayout.h"
+
 namespace sge {
 
 /**
@@ -59,6 +63,12 @@ public:
      * Test if this Vertex is not equivalent to another Vertex.
      */
     bool operator!= (const Vertex &other) const;
+
+    /**
+     * Layout of a Vertex in a vertex buffer: 36 bytes of float position,
+     * normal and texture coordinates, and 8 bit color.
+     */
+    static VertexLayout layout ();
 };
 
 // --------------------------------------------------------------------------
@@ -78,6 +88,14 @@ inline bool Vertex::operator!= (const Vertex &other) const {
     return !compare(other);
 }
 
+inline VertexLayout Vertex::layout () {
+    return VertexLayout(sizeof(Vertex))
+          .add(kAttribPosition, 3, kFloat32, offsetof(Vertex, position))
+          .add(kAttribNormal, 3, kFloat32, offsetof(Vertex, normal))
+          .add(kAttribTexCoord, 2, kFloat32, offsetof(Vertex, texCoord))
+          .add(kAttribColor, 4, kUnorm8, offsetof(Vertex, color));
+}
+
 } /* namespace sge */
 
 #endif /* __SGE_VERTEX_H */
@@ -0,0 +1,110 @@
+/*---  VertexLayout.h - Vertex Attribute Layout  --------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Describes where each attribute of a vertex lives in a vertex
+ *   buffer and how it is stored, so a renderer can bind any vertex format.
+ */
+#ifndef __SGE_VERTEXLAYOUT_H
+#define __SGE_VERTEXLAYOUT_H
+
+#include <vector>
+
+namespace sge {
+
+/** Storage type of each component of a vertex attribute. */
+enum AttribType {
+    kFloat32,
+    kFloat16,
+    kSnorm16, /**< Normalized to -1..1. */
+    kUnorm16, /**< Normalized to 0..1. */
+    kSnorm8,  /**< Normalized to -1..1. */
+    kUnorm8   /**< Normalized to 0..1. */
+};
+
+/** Shader attribute locations used by the engine's shaders. */
+enum AttribLocation : u32 {
+    kAttribPosition = 0,
+    kAttribNormal   = 1,
+    kAttribTexCoord = 2,
+    kAttribColor    = 3
+};
+
+/**
+ * One attribute of a vertex.
+ */
+struct VertexAttrib {
+    u32 location;    /**< Shader attribute location. */
+    u32 components;  /**< Number of components, 1 to 4. */
+    AttribType type;
+    u32 offset;      /**< Byte offset from the start of the vertex. */
+};
+
+/**
+ * Attributes of a vertex type, and the size in bytes of one vertex.
+ */
+class VertexLayout {
+public:
+    /** Empty layout. */
+    VertexLayout () : mStride{0} { }
+
+    explicit VertexLayout (const u32 pStride) : mStride{pStride} { }
+
+    /**
+     * Add an attribute.
+     * @return This layout, so attributes can be chained.
+     */
+    VertexLayout &add (const u32 location, const u32 components,
+                       const AttribType type, const u32 offset);
+
+    u32 stride () const { return mStride; }
+
+    const std::vector<VertexAttrib> &attributes () const { return mAttribs; }
+
+    /** Size in bytes of one component of type. */
+    static u32 typeSize (const AttribType type);
+
+    /** True if type is read by shaders as a normalized float. */
+    static bool isNormalized (const AttribType type);
+
+private:
+    u32 mStride;
+    std::vector<VertexAttrib> mAttribs;
+};
+
+// --------------------------------------------------------------------------
+
+inline VertexLayout &VertexLayout::add (const u32 location, const u32 components,
+                                        const AttribType type, const u32 offset) {
+    verify(components >= 1 && components <= 4);
+    verify(offset + components * typeSize(type) <= mStride);
+
+    mAttribs.push_back(VertexAttrib{location, components, type, offset});
+    return *this;
+}
+
+inline u32 VertexLayout::typeSize (const AttribType type) {
+    switch (type) {
+    case kFloat32:
+        return 4;
+    case kFloat16:
+    case kSnorm16:
+    case kUnorm16:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+inline bool VertexLayout::isNormalized (const AttribType type) {
+    return type != kFloat32 && type != kFloat16;
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_VERTEXLAYOUT_H */
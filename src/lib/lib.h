@@ -23,14 +23,26 @@
 #include "sys/assert.h"
 #include "sys/types.h"
 #include "sys/util.h"
+#include "sys/simd.h"
 
 #include "math/math.h"
+#include "math/floatwide.h"
+#include "math/fastmath.h"
+#include "math/vector3wide.h"
 #include "math/color.h"
+#include "math/colorbatch.h"
+#include "math/packed.h"
+#include "math/quaternionbatch.h"
 #include "math/transform.h"
+#include "math/transformbatch.h"
+#include "math/transformhierarchy.h"
 
 #include "util/random.h"
 #include "util/stringutil.h"
 #include "util/clock.h"
+#include "util/parallel.h"
+#include "util/mappedfile.h"
+#include "util/scanner.h"
 
 #include "bounds/line2d.h"
 #include "bounds/rect.h"
@@ -39,13 +51,25 @@
 #include "bounds/aabb.h"
 #include "bounds/sphere.h"
 #include "bounds/intersection.h"
+#include "bounds/frustum.h"
 
 #include "noise/noise.h"
 
 #include "container/grid.h"
+#include "container/stridedspan.h"
 
+#include "geom/vertexlayout.h"
 #include "geom/vertex.h"
+#include "geom/meshoptimizer.h"
 #include "geom/mesh.h"
+#include "geom/meshnormals.h"
+#include "geom/meshsoa.h"
+#include "geom/indexbuffer.h"
+#include "geom/decimate.h"
+#include "geom/meshlet.h"
+#include "geom/packedmesh.h"
+#include "geom/meshcache.h"
+#include "geom/obj.h"
 #include "geom/prim/plane.h"
 #include "geom/prim/cube.h"
 #include "geom/prim/icosphere.h"
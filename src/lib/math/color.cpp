@@ -3,20 +3,20 @@
 //
 #include "../lib.h"
 
-#include <cstdlib> // strtoul
-#include <cstring> // strncpy, strchr
-
 static constexpr float HUE_MAX = 360.0f;
 static constexpr float HUE_STEP = HUE_MAX / 6.0f;
+static constexpr float INV_255 = 1.0f / 255.0f;
 
 Vec4f Color::toVec4f (const bool normalize) const {
-    float f = normalize ? (1.0f / 255.0f) : 1.0f;
+    float f = normalize ? INV_255 : 1.0f;
 
     return Vec4f((float)r * f, (float)g * f, (float)b * f, (float)a * f);
 }
 
-Color Color::fromHSL (const float pHue, const float pSat, const float pVal) {
-    const float chroma = (1.0f - fabsf(2.0f * pVal - 1.0f)) * pSat;
+// Build a Color from the chroma (largest minus smallest component) and
+// the hue, which picks the sector of the color wheel and so the second
+// largest component, then lift each component by m.
+static Color fromChroma (const float pHue, const float chroma, const float m) {
     const float nHue = pHue / HUE_STEP; // Normalize Hue
     const float x = chroma * (1.0f - fabsf(fmodf(nHue, 2.0f) - 1.0f));
     float r = 0.0f, g = 0.0f, b = 0.0f;
@@ -47,41 +47,104 @@ Color Color::fromHSL (const float pHue, const float pSat, const float pVal) {
         b = x;
     }
 
-    float m = pVal - 0.5f * chroma;
-
     return Color(static_cast<u8>(math::lerp(r + m, 0, 255)),
                  static_cast<u8>(math::lerp(g + m, 0, 255)),
                  static_cast<u8>(math::lerp(b + m, 0, 255)));
 }
 
-// Parse a color code given as Hex string
-// Discard first character if '#'.
-// Valid string lengths are 3 (RGB), 4 (RGBA), 6 (RRGGBB) or 8 (RRGGBBAA)
-// Expand each of the first 3 options to match an 8 byte string and then
-// parse as Hex
-Color Color::fromHex (const char *const hex) {
-    // Initialize result.
-    char result[9]{0};
-    strncpy(result, "000000FF", 8);
-
-    if (nullptr != hex) {
-        const char *text = (nullptr != strchr(hex, '#')) ? hex + sizeof(char) : hex;
-        const size_t len = strlen(text);
-
-        if (len == 3 || len == 4) {
-            result[0] = result[1] = text[0];
-            result[2] = result[3] = text[1];
-            result[4] = result[5] = text[2];
-
-            if (len == 4) {
-                result[6] = result[7] = text[3];
-            }
-        } else if (len == 6 || len == 8) {
-            strncpy(result, text, len);
+Color Color::fromHSL (const float pHue, const float pSat, const float pVal) {
+    const float chroma = (1.0f - fabsf(2.0f * pVal - 1.0f)) * pSat;
+
+    return fromChroma(pHue, chroma, pVal - 0.5f * chroma);
+}
+
+Color Color::fromHSV (const float pHue, const float pSat, const float pVal) {
+    const float chroma = pVal * pSat;
+
+    return fromChroma(pHue, chroma, pVal - chroma);
+}
+
+// Hue in degrees of normalized r, g, b, given the largest component and
+// the chroma. Greys have no hue; report 0.
+static float hue (const float r, const float g, const float b,
+                  const float hi, const float chroma) {
+    if (chroma == 0.0f) {
+        return 0.0f;
+    }
+
+    float h;
+    if (hi == r) {
+        h = (g - b) / chroma;
+        if (h < 0.0f) {
+            h += 6.0f;
         }
+    } else if (hi == g) {
+        h = (b - r) / chroma + 2.0f;
+    } else {
+        h = (r - g) / chroma + 4.0f;
     }
 
-    u32 val = static_cast<u32>(strtoul(result, nullptr, 16));
+    return h * HUE_STEP;
+}
+
+Vec3f Color::toHSL () const {
+    const float rf = static_cast<float>(r) * INV_255;
+    const float gf = static_cast<float>(g) * INV_255;
+    const float bf = static_cast<float>(b) * INV_255;
+    const float hi = math::max(rf, math::max(gf, bf));
+    const float lo = math::min(rf, math::min(gf, bf));
+    const float chroma = hi - lo;
+    const float l = (hi + lo) * 0.5f;
+    const float s = (chroma == 0.0f) ? 0.0f : chroma / (1.0f - fabsf(hi + lo - 1.0f));
+
+    return Vec3f(hue(rf, gf, bf, hi, chroma), s, l);
+}
+
+Vec3f Color::toHSV () const {
+    const float rf = static_cast<float>(r) * INV_255;
+    const float gf = static_cast<float>(g) * INV_255;
+    const float bf = static_cast<float>(b) * INV_255;
+    const float hi = math::max(rf, math::max(gf, bf));
+    const float lo = math::min(rf, math::min(gf, bf));
+    const float chroma = hi - lo;
+    const float s = (hi == 0.0f) ? 0.0f : chroma / hi;
+
+    return Vec3f(hue(rf, gf, bf, hi, chroma), s, hi);
+}
+
+// Round to the nearest channel value, saturating.
+static u8 toChannel (const float f) {
+    return static_cast<u8>(math::clamp(f, 0.0f, 255.0f) + 0.5f);
+}
+
+Color Color::fromVec4f (const Vec4f &v, const bool normalized) {
+    const Vec4f c = normalized ? v * 255.0f : v;
+
+    return Color(toChannel(c.x), toChannel(c.y), toChannel(c.z), toChannel(c.w));
+}
+
+Vec4f Color::toLinear () const {
+    return Vec4f(srgbToLinear(static_cast<float>(r) * INV_255),
+                 srgbToLinear(static_cast<float>(g) * INV_255),
+                 srgbToLinear(static_cast<float>(b) * INV_255),
+                 static_cast<float>(a) * INV_255);
+}
+
+Color Color::fromLinear (const Vec4f &v) {
+    return Color(toChannel(linearToSrgb(v.x) * 255.0f),
+                 toChannel(linearToSrgb(v.y) * 255.0f),
+                 toChannel(linearToSrgb(v.z) * 255.0f),
+                 toChannel(v.w * 255.0f));
+}
+
+//==================================
+// sRGB Transfer Function
+//==================================
+
+float srgbToLinear (const float c) {
+    return (c <= 0.04045f) ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+}
 
-    return Color(val);
+float linearToSrgb (const float c) {
+    return (c <= 0.0031308f) ? c * 12.92f : 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
 }
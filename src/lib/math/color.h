@@ -19,11 +19,11 @@ public:
 
 public:
     /** Construct a color with R, G, B, A values. */
-    explicit Color (const u8 rr, const u8 gg, const u8 bb, const u8 aa = 255)
+    explicit constexpr Color (const u8 rr, const u8 gg, const u8 bb, const u8 aa = 255)
             : r(rr), g(gg), b(bb), a(aa) { }
 
     /** Construct a color from a single 32 bit unsigned int. */
-    explicit Color (const u32 val);
+    explicit constexpr Color (const u32 val);
 
     /**
      * Create a new RGBA Color value by converting from
@@ -40,6 +40,34 @@ public:
                           const float pSat = 1.0f,
                           const float pVal = 0.5f);
 
+    /**
+     * Create a new RGBA Color value by converting from
+     * Hue, Saturation, Value color space.
+     *
+     * @param pHue Hue value in the range 0.0f..360.0f, as fromHSL().
+     * @param pSat Saturation value in range 0.0f..1.0f
+     * @param pVal Value in range 0.0f..1.0f such that 0 is black and 1
+     *          is full color.
+     * @return Converted RGB Color value.
+     */
+    static Color fromHSV (const float pHue,
+                          const float pSat = 1.0f,
+                          const float pVal = 1.0f);
+
+    /**
+     * Create a new RGBA Color value from <Vec4f R, G, B, A>, rounding
+     * each component to the nearest value in 0..255.
+     *
+     * @param normalized If true, components are in the 0..1 range.
+     */
+    static Color fromVec4f (const Vec4f &v, const bool normalized = false);
+
+    /**
+     * Create a new RGBA Color value from linear intensities in the 0..1
+     * range. R, G and B are sRGB encoded; alpha is stored as is.
+     */
+    static Color fromLinear (const Vec4f &v);
+
     /**
      * Create a new RGBA Color value by parsing a Hexadecimal
      * color string.
@@ -50,19 +78,19 @@ public:
      *
      * @param hex A color value encoded as a hexadecimal string.
      */
-    static Color fromHex (const char *const hex);
+    static constexpr Color fromHex (const char *const hex);
 
     /**
      * Test if this color is fully opaque.
      * @return true if opaque, otherwise false;
      */
-    bool isOpaque () const { return a == 255; }
+    constexpr bool isOpaque () const { return a == 255; }
 
     /**
      * Test if this color is fully transparent.
      * @return true if transparent, otherwise false;
      */
-    bool isHidden () const { return a == 0; }
+    constexpr bool isHidden () const { return a == 0; }
 
     /**
      * Write Color to <Vec4f R, G, B, A>.
@@ -71,27 +99,112 @@ public:
      */
     Vec4f toVec4f (const bool normalize = false) const;
 
-    bool compare (const Color &other) const;
+    /**
+     * Decode the sRGB encoded R, G and B of this Color to linear
+     * intensities in the 0..1 range. Alpha is normalized.
+     */
+    Vec4f toLinear () const;
+
+    /**
+     * Convert to <Vec3f Hue, Saturation, Lightness>. Hue is in the range
+     * 0.0f..360.0f and is 0 for greys.
+     */
+    Vec3f toHSL () const;
+
+    /**
+     * Convert to <Vec3f Hue, Saturation, Value>. Hue is in the range
+     * 0.0f..360.0f and is 0 for greys.
+     */
+    Vec3f toHSV () const;
+
+    /**
+     * Write Color to a single 32 bit unsigned int, the inverse of
+     * Color(u32).
+     */
+    constexpr u32 toU32 () const;
+
+    constexpr bool compare (const Color &other) const;
 };
 
+/**
+ * Decode an sRGB encoded channel value in the 0..1 range to linear
+ * intensity.
+ */
+float srgbToLinear (const float c);
+
+/**
+ * Encode a linear intensity in the 0..1 range as an sRGB channel value.
+ */
+float linearToSrgb (const float c);
+
 // --------------------------------------------------------------------------
 
-inline Color::Color (const u32 val) {
-    r = static_cast<u8>((val & 0xFF000000) >> 24);
-    g = static_cast<u8>((val & 0x00FF0000) >> 16);
-    b = static_cast<u8>((val & 0x0000FF00) >> 8);
-    a = static_cast<u8>((val & 0x000000FF));
+inline constexpr Color::Color (const u32 val)
+        : r(static_cast<u8>((val & 0xFF000000) >> 24)),
+          g(static_cast<u8>((val & 0x00FF0000) >> 16)),
+          b(static_cast<u8>((val & 0x0000FF00) >> 8)),
+          a(static_cast<u8>((val & 0x000000FF))) { }
+
+inline constexpr u32 Color::toU32 () const {
+    return (static_cast<u32>(r) << 24) | (static_cast<u32>(g) << 16) |
+           (static_cast<u32>(b) << 8) | static_cast<u32>(a);
+}
+
+// Parse a color code given as Hex string
+// Discard first character if '#'.
+// Valid string lengths are 3 (RGB), 4 (RGBA), 6 (RRGGBB) or 8 (RRGGBBAA)
+// Expand each of the first 3 options to match an 8 digit string and then
+// parse as Hex, stopping at the first invalid digit like strtoul.
+inline constexpr Color Color::fromHex (const char *const hex) {
+    char digits[8] {'0', '0', '0', '0', '0', '0', 'F', 'F'};
+
+    if (nullptr != hex) {
+        const char *text = ('#' == hex[0]) ? hex + 1 : hex;
+        size_t len = 0;
+        while ('\0' != text[len]) {
+            ++len;
+        }
+
+        if (len == 3 || len == 4) {
+            for (size_t i = 0; i < len; ++i) {
+                digits[2 * i] = digits[2 * i + 1] = text[i];
+            }
+        } else if (len == 6 || len == 8) {
+            for (size_t i = 0; i < len; ++i) {
+                digits[i] = text[i];
+            }
+        }
+    }
+
+    u32 val = 0;
+    for (const char c : digits) {
+        u32 digit = 16;
+        if (c >= '0' && c <= '9') {
+            digit = static_cast<u32>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            digit = static_cast<u32>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            digit = static_cast<u32>(c - 'A' + 10);
+        }
+
+        if (digit > 15) {
+            break;
+        }
+        val = (val << 4) | digit;
+    }
+
+    return Color(val);
 }
 
-inline bool Color::compare (const Color &other) const {
+inline constexpr bool Color::compare (const Color &other) const {
     return r == other.r && g == other.g && b == other.b && a == other.a;
 }
 
-inline bool operator== (const Color &a, const Color &b) {
+inline constexpr bool operator== (const Color &a, const Color &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Color &a, const Color &b) {
+inline constexpr bool operator!= (const Color &a, const Color &b) {
     return !a.compare(b);
 }
 
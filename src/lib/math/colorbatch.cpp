@@ -0,0 +1,464 @@
+//
+// Batch Color Implementation.
+//
+#include "../lib.h"
+
+#include <algorithm>
+#include <cstring> // std::memcpy
+
+static_assert(sizeof(Color) == sizeof(u32), "Color must be 4 bytes, R to A");
+
+using math::fast::kLow;
+using math::fast::kHigh;
+
+static constexpr size_t kBlock = Floatx8::kWidth;
+static constexpr float kInv255 = 1.0f / 255.0f;
+
+//==================================
+// Packed Pixel Kernels
+//==================================
+
+// A packed pixel holds R in its top byte, so on a little endian target
+// the bytes of a packed pixel are those of the Color reversed, and packing
+// and unpacking are the same byte swap.
+
+static inline u32 swapPixel (const u32 p) {
+    return (p >> 24) | ((p >> 8) & 0x0000FF00u) | ((p << 8) & 0x00FF0000u) | (p << 24);
+}
+
+// Byte swap count pixels from in to out. Returns the number swapped; the
+// caller finishes the tail.
+#if SGE_SIMD_AVX2
+
+static size_t swapPixelBlock (const void *in, void *out, const size_t count) {
+    const __m256i order = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256i *src = static_cast<const __m256i *>(in);
+    __m256i *dst = static_cast<__m256i *>(out);
+
+    const size_t n = count / 8;
+    for (size_t i = 0; i < n; ++i) {
+        _mm256_storeu_si256(dst + i, _mm256_shuffle_epi8(_mm256_loadu_si256(src + i), order));
+    }
+    return n * 8;
+}
+
+#elif SGE_SIMD_SSE
+
+static size_t swapPixelBlock (const void *in, void *out, const size_t count) {
+    const __m128i mid = _mm_set1_epi32(0x00FF00FF);
+    const __m128i *src = static_cast<const __m128i *>(in);
+    __m128i *dst = static_cast<__m128i *>(out);
+
+    const size_t n = count / 4;
+    for (size_t i = 0; i < n; ++i) {
+        // Swap the bytes of each 16 bit half, then the halves.
+        const __m128i p = _mm_loadu_si128(src + i);
+        const __m128i s = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(p, 8), mid),
+                                       _mm_slli_epi16(p, 8));
+        _mm_storeu_si128(dst + i, _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xB1), 0xB1));
+    }
+    return n * 4;
+}
+
+#elif SGE_SIMD_NEON
+
+static size_t swapPixelBlock (const void *in, void *out, const size_t count) {
+    const u8 *src = static_cast<const u8 *>(in);
+    u8 *dst = static_cast<u8 *>(out);
+
+    const size_t n = count / 4;
+    for (size_t i = 0; i < n; ++i) {
+        vst1q_u8(dst + i * 16, vrev32q_u8(vld1q_u8(src + i * 16)));
+    }
+    return n * 4;
+}
+
+#else
+
+static size_t swapPixelBlock (const void *, void *, const size_t) {
+    return 0;
+}
+
+#endif /* SGE_SIMD_AVX2 */
+
+static void swapPixels (const void *in, void *out, const size_t count) {
+    const u8 *src = static_cast<const u8 *>(in);
+    u8 *dst = static_cast<u8 *>(out);
+
+    for (size_t i = swapPixelBlock(in, out, count); i < count; ++i) {
+        u32 p;
+        std::memcpy(&p, src + i * 4, 4);
+        p = swapPixel(p);
+        std::memcpy(dst + i * 4, &p, 4);
+    }
+}
+
+// Color to and from normalized Vec4f, 4 at a time. Return the number
+// converted.
+#if SGE_SIMD_SSE
+
+static size_t toVec4fBlock (const Color *in, Vec4f *out, const size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(kInv255);
+
+    const size_t n = count & ~static_cast<size_t>(3);
+    for (size_t i = 0; i < n; i += 4) {
+        const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        const __m128i lo = _mm_unpacklo_epi8(p, zero);
+        const __m128i hi = _mm_unpackhi_epi8(p, zero);
+        _mm_storeu_ps(&out[i].x, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+        _mm_storeu_ps(&out[i + 1].x, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+        _mm_storeu_ps(&out[i + 2].x, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+        _mm_storeu_ps(&out[i + 3].x, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    }
+    return n;
+}
+
+static inline __m128i toChannels (const Vec4f &v) {
+    const __m128 c = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&v.x), _mm_set1_ps(255.0f)),
+                                           _mm_setzero_ps()),
+                                _mm_set1_ps(255.0f));
+    return _mm_cvttps_epi32(_mm_add_ps(c, _mm_set1_ps(0.5f)));
+}
+
+static size_t fromVec4fBlock (const Vec4f *in, Color *out, const size_t count) {
+    const size_t n = count & ~static_cast<size_t>(3);
+    for (size_t i = 0; i < n; i += 4) {
+        const __m128i lo = _mm_packs_epi32(toChannels(in[i]), toChannels(in[i + 1]));
+        const __m128i hi = _mm_packs_epi32(toChannels(in[i + 2]), toChannels(in[i + 3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(lo, hi));
+    }
+    return n;
+}
+
+#elif SGE_SIMD_NEON
+
+static size_t toVec4fBlock (const Color *in, Vec4f *out, const size_t count) {
+    const size_t n = count & ~static_cast<size_t>(3);
+    for (size_t i = 0; i < n; i += 4) {
+        const uint8x16_t p = vld1q_u8(&in[i].r);
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(p));
+        const uint16x8_t hi = vmovl_u8(vget_high_u8(p));
+        vst1q_f32(&out[i].x, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), kInv255));
+        vst1q_f32(&out[i + 1].x, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), kInv255));
+        vst1q_f32(&out[i + 2].x, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), kInv255));
+        vst1q_f32(&out[i + 3].x, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), kInv255));
+    }
+    return n;
+}
+
+static inline uint16x4_t toChannels (const Vec4f &v) {
+    const float32x4_t c = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(&v.x), 255.0f),
+                                              vdupq_n_f32(0.0f)),
+                                    vdupq_n_f32(255.0f));
+    return vmovn_u32(vcvtq_u32_f32(vaddq_f32(c, vdupq_n_f32(0.5f))));
+}
+
+static size_t fromVec4fBlock (const Vec4f *in, Color *out, const size_t count) {
+    const size_t n = count & ~static_cast<size_t>(3);
+    for (size_t i = 0; i < n; i += 4) {
+        const uint16x8_t lo = vcombine_u16(toChannels(in[i]), toChannels(in[i + 1]));
+        const uint16x8_t hi = vcombine_u16(toChannels(in[i + 2]), toChannels(in[i + 3]));
+        vst1q_u8(&out[i].r, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    }
+    return n;
+}
+
+#else
+
+static size_t toVec4fBlock (const Color *, Vec4f *, const size_t) {
+    return 0;
+}
+
+static size_t fromVec4fBlock (const Vec4f *, Color *, const size_t) {
+    return 0;
+}
+
+#endif /* SGE_SIMD_SSE */
+
+//==================================
+// Float Kernels
+//==================================
+
+namespace {
+
+// 8 colors, one channel per Floatx8.
+struct RGBAx8 {
+    Floatx8 r, g, b, a;
+};
+
+inline Floatx8 abs (const Floatx8 &a) {
+    return max(a, -a);
+}
+
+// Load in.size() (<= 8) Colors, normalized. Missing lanes are 0.
+inline RGBAx8 loadColors (StridedSpan<const Color> in) {
+    float tmp[4][kBlock] = {};
+    for (size_t n = 0; n < in.size(); ++n) {
+        const Color &c = in[n];
+        tmp[0][n] = static_cast<float>(c.r);
+        tmp[1][n] = static_cast<float>(c.g);
+        tmp[2][n] = static_cast<float>(c.b);
+        tmp[3][n] = static_cast<float>(c.a);
+    }
+
+    const Floatx8 scale(kInv255);
+    return RGBAx8{Floatx8::load(tmp[0]) * scale, Floatx8::load(tmp[1]) * scale,
+                  Floatx8::load(tmp[2]) * scale, Floatx8::load(tmp[3]) * scale};
+}
+
+// Store channels in the range 0..255, truncated, to out.size() (<= 8)
+// Colors.
+inline void storeColors (const RGBAx8 &c, StridedSpan<Color> out) {
+    float tmp[4][kBlock];
+    c.r.store(tmp[0]);
+    c.g.store(tmp[1]);
+    c.b.store(tmp[2]);
+    c.a.store(tmp[3]);
+
+    for (size_t n = 0; n < out.size(); ++n) {
+        out[n] = Color(static_cast<u8>(tmp[0][n]), static_cast<u8>(tmp[1][n]),
+                       static_cast<u8>(tmp[2][n]), static_cast<u8>(tmp[3][n]));
+    }
+}
+
+inline RGBAx8 loadVec4 (StridedSpan<const Vec4f> in) {
+    float tmp[4][kBlock] = {};
+    for (size_t n = 0; n < in.size(); ++n) {
+        const Vec4f &v = in[n];
+        tmp[0][n] = v.x;
+        tmp[1][n] = v.y;
+        tmp[2][n] = v.z;
+        tmp[3][n] = v.w;
+    }
+    return RGBAx8{Floatx8::load(tmp[0]), Floatx8::load(tmp[1]),
+                  Floatx8::load(tmp[2]), Floatx8::load(tmp[3])};
+}
+
+// Run kernel over in and out kBlock elements at a time.
+template <typename In, typename Out, typename Kernel>
+void forEachBlock (const StridedSpan<In> in, const StridedSpan<Out> out,
+                   const Kernel &kernel) {
+    verify(in.size() == out.size());
+
+    for (size_t first = 0; first < in.size(); first += kBlock) {
+        const size_t count = std::min(kBlock, in.size() - first);
+        kernel(in.subspan(first, count), out.subspan(first, count));
+    }
+}
+
+// out[i] = f(in[i]), 8 at a time.
+template <typename F>
+void mapFloats (const StridedSpan<const float> in, const StridedSpan<float> out, const F &f) {
+    forEachBlock(in, out, [&f](StridedSpan<const float> i, StridedSpan<float> o) {
+        float tmp[kBlock] = {};
+        for (size_t n = 0; n < i.size(); ++n) {
+            tmp[n] = i[n];
+        }
+        f(Floatx8::load(tmp)).store(tmp);
+        for (size_t n = 0; n < o.size(); ++n) {
+            o[n] = tmp[n];
+        }
+    });
+}
+
+// fromChroma() in color.cpp, 8 at a time. Rather than branch on the
+// sector of the hue, pick each channel by its distance in sectors from
+// the two where it is largest: chroma within 1, x within 2, else 0.
+inline RGBAx8 fromChroma (const Floatx8 &hue, const Floatx8 &pChroma, const Floatx8 &m) {
+    const Floatx8 zero(0.0f);
+    const Floatx8 one(1.0f);
+    const Floatx8 two(2.0f);
+
+    const Floatx8 nHue = hue / Floatx8(60.0f);
+    const Floatx8 chroma = select(cmpGe(nHue, zero),
+                                  select(cmpLt(nHue, Floatx8(6.0f)), pChroma, zero), zero);
+    const Floatx8 mod2 = nHue - two * floor(nHue * Floatx8(0.5f));
+    const Floatx8 x = chroma * (one - abs(mod2 - one));
+
+    const Floatx8 sector = floor(nHue);
+    const Floatx8 dr = abs(sector - Floatx8(2.5f)); // Furthest from 2 and 3
+    const Floatx8 dg = abs(sector - Floatx8(1.5f));
+    const Floatx8 db = abs(sector - Floatx8(3.5f));
+    const Floatx8 r = select(cmpGt(dr, two), chroma, select(cmpGt(dr, one), x, zero));
+    const Floatx8 g = select(cmpLt(dg, one), chroma, select(cmpLt(dg, two), x, zero));
+    const Floatx8 b = select(cmpLt(db, one), chroma, select(cmpLt(db, two), x, zero));
+
+    const Floatx8 scale(255.0f);
+    return RGBAx8{min(max(r + m, zero), one) * scale, min(max(g + m, zero), one) * scale,
+                  min(max(b + m, zero), one) * scale, scale};
+}
+
+// hue() in color.cpp, 8 at a time.
+inline Floatx8 hue (const RGBAx8 &c, const Floatx8 &hi, const Floatx8 &chroma) {
+    const Floatx8 zero(0.0f);
+    const Floatx8 grey = cmpEq(chroma, zero);
+    const Floatx8 safe = select(grey, Floatx8(1.0f), chroma);
+
+    const Floatx8 hr = (c.g - c.b) / safe;
+    const Floatx8 hg = (c.b - c.r) / safe + Floatx8(2.0f);
+    const Floatx8 hb = (c.r - c.g) / safe + Floatx8(4.0f);
+    const Floatx8 h = select(cmpEq(hi, c.r), select(cmpLt(hr, zero), hr + Floatx8(6.0f), hr),
+                             select(cmpEq(hi, c.g), hg, hb));
+
+    return select(grey, zero, h * Floatx8(60.0f));
+}
+
+// Nearest channel value, saturating, before truncation.
+inline Floatx8 toChannel (const Floatx8 &f) {
+    return min(max(f, Floatx8(0.0f)), Floatx8(255.0f)) + Floatx8(0.5f);
+}
+
+inline Floatx8 decodeSrgb (const Floatx8 &c) {
+    const Floatx8 lo(0.04045f);
+    const Floatx8 p = math::fast::pow((max(c, lo) + Floatx8(0.055f)) / Floatx8(1.055f),
+                                      Floatx8(2.4f));
+    return select(cmpLe(c, lo), c / Floatx8(12.92f), p);
+}
+
+// kLow is plenty for 8 bit channels: its error is under 0.15 of a step.
+template <math::fast::Accuracy A>
+inline Floatx8 encodeSrgb (const Floatx8 &v) {
+    const Floatx8 lo(0.0031308f);
+    const Floatx8 p = math::fast::pow<A>(max(v, lo), Floatx8(1.0f / 2.4f));
+    return select(cmpLe(v, lo), v * Floatx8(12.92f), madd(Floatx8(1.055f), p, Floatx8(-0.055f)));
+}
+
+// srgbToLinear() of every channel value.
+struct SrgbTable {
+    float v[256];
+
+    SrgbTable () {
+        for (int i = 0; i < 256; ++i) {
+            v[i] = srgbToLinear(static_cast<float>(i) * kInv255);
+        }
+    }
+};
+
+} /* namespace */
+
+//==================================
+// Public Interface
+//==================================
+
+void unpackColors (StridedSpan<const u32> in, StridedSpan<Color> out) {
+    verify(in.size() == out.size());
+
+    if (in.isContiguous() && out.isContiguous()) {
+        swapPixels(in.data(), out.data(), in.size());
+        return;
+    }
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        out[i] = Color(in[i]);
+    }
+}
+
+void packColors (StridedSpan<const Color> in, StridedSpan<u32> out) {
+    verify(in.size() == out.size());
+
+    if (in.isContiguous() && out.isContiguous()) {
+        swapPixels(in.data(), out.data(), in.size());
+        return;
+    }
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        out[i] = in[i].toU32();
+    }
+}
+
+void colorsToVec4f (StridedSpan<const Color> in, StridedSpan<Vec4f> out) {
+    verify(in.size() == out.size());
+
+    size_t i = 0;
+    if (in.isContiguous() && out.isContiguous()) {
+        i = toVec4fBlock(in.data(), out.data(), in.size());
+    }
+    for (; i < in.size(); ++i) {
+        out[i] = in[i].toVec4f(true);
+    }
+}
+
+void colorsFromVec4f (StridedSpan<const Vec4f> in, StridedSpan<Color> out) {
+    verify(in.size() == out.size());
+
+    size_t i = 0;
+    if (in.isContiguous() && out.isContiguous()) {
+        i = fromVec4fBlock(in.data(), out.data(), in.size());
+    }
+    for (; i < in.size(); ++i) {
+        out[i] = Color::fromVec4f(in[i], true);
+    }
+}
+
+void colorsToLinear (StridedSpan<const Color> in, StridedSpan<Vec4f> out) {
+    verify(in.size() == out.size());
+
+    static const SrgbTable table;
+    for (size_t i = 0; i < in.size(); ++i) {
+        const Color c = in[i];
+        out[i] = Vec4f(table.v[c.r], table.v[c.g], table.v[c.b],
+                       static_cast<float>(c.a) * kInv255);
+    }
+}
+
+void colorsFromLinear (StridedSpan<const Vec4f> in, StridedSpan<Color> out) {
+    forEachBlock(in, out, [](StridedSpan<const Vec4f> i, StridedSpan<Color> o) {
+        const RGBAx8 v = loadVec4(i);
+        const Floatx8 scale(255.0f);
+        storeColors(RGBAx8{toChannel(encodeSrgb<kLow>(v.r) * scale),
+                           toChannel(encodeSrgb<kLow>(v.g) * scale),
+                           toChannel(encodeSrgb<kLow>(v.b) * scale), toChannel(v.a * scale)}, o);
+    });
+}
+
+void colorsFromHSL (StridedSpan<const Vec3f> in, StridedSpan<Color> out) {
+    forEachBlock(in, out, [](StridedSpan<const Vec3f> i, StridedSpan<Color> o) {
+        const Vec3x8 hsl = Vec3x8::gather(i, 0);
+        const Floatx8 chroma = (Floatx8(1.0f) - abs(Floatx8(2.0f) * hsl.z - Floatx8(1.0f))) * hsl.y;
+        storeColors(fromChroma(hsl.x, chroma, hsl.z - Floatx8(0.5f) * chroma), o);
+    });
+}
+
+void colorsFromHSV (StridedSpan<const Vec3f> in, StridedSpan<Color> out) {
+    forEachBlock(in, out, [](StridedSpan<const Vec3f> i, StridedSpan<Color> o) {
+        const Vec3x8 hsv = Vec3x8::gather(i, 0);
+        const Floatx8 chroma = hsv.z * hsv.y;
+        storeColors(fromChroma(hsv.x, chroma, hsv.z - chroma), o);
+    });
+}
+
+void colorsToHSL (StridedSpan<const Color> in, StridedSpan<Vec3f> out) {
+    forEachBlock(in, out, [](StridedSpan<const Color> i, StridedSpan<Vec3f> o) {
+        const RGBAx8 c = loadColors(i);
+        const Floatx8 hi = max(c.r, max(c.g, c.b));
+        const Floatx8 lo = min(c.r, min(c.g, c.b));
+        const Floatx8 chroma = hi - lo;
+        const Floatx8 one(1.0f);
+        const Floatx8 s = chroma / (one - abs(hi + lo - one));
+
+        Vec3x8(hue(c, hi, chroma), select(cmpEq(chroma, Floatx8(0.0f)), Floatx8(0.0f), s),
+               (hi + lo) * Floatx8(0.5f)).scatter(o, 0);
+    });
+}
+
+void colorsToHSV (StridedSpan<const Color> in, StridedSpan<Vec3f> out) {
+    forEachBlock(in, out, [](StridedSpan<const Color> i, StridedSpan<Vec3f> o) {
+        const RGBAx8 c = loadColors(i);
+        const Floatx8 hi = max(c.r, max(c.g, c.b));
+        const Floatx8 chroma = hi - min(c.r, min(c.g, c.b));
+        const Floatx8 s = chroma / hi;
+
+        Vec3x8(hue(c, hi, chroma), select(cmpEq(hi, Floatx8(0.0f)), Floatx8(0.0f), s),
+               hi).scatter(o, 0);
+    });
+}
+
+void srgbToLinear (StridedSpan<const float> in, StridedSpan<float> out) {
+    mapFloats(in, out, [](const Floatx8 &c) { return decodeSrgb(c); });
+}
+
+void linearToSrgb (StridedSpan<const float> in, StridedSpan<float> out) {
+    mapFloats(in, out, [](const Floatx8 &v) { return encodeSrgb<kHigh>(v); });
+}
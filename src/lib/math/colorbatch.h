@@ -0,0 +1,89 @@
+/*---  ColorBatch.h - Batch Color Conversions  ----------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Convert whole arrays of Colors between packed 32 bit pixels,
+ *   float RGBA, linear RGBA and the HSL/HSV color spaces, e.g. when
+ *   generating or post-processing an image.
+ *
+ * Each function gives the same result per element as the scalar Color
+ * member it is named after. Packed-pixel and Vec4f conversions are exact;
+ * HSL/HSV and linear to sRGB may differ in the last unit of a channel, as
+ * the batch forms use math::fast::pow and fused multiply-adds.
+ *
+ * Color space conversions work on 8 elements at a time. The packed-pixel
+ * and Vec4f conversions have SIMD kernels for contiguous spans and
+ * convert strided spans (e.g. Vertex::color) one element at a time.
+ * in and out must be the same size and must not overlap.
+ */
+#ifndef __SGE_COLORBATCH_H
+#define __SGE_COLORBATCH_H
+
+#include "../container/stridedspan.h"
+
+/**
+ * out[i] = Color(in[i]). Pixels are packed as 0xRRGGBBAA.
+ */
+void unpackColors (StridedSpan<const u32> in, StridedSpan<Color> out);
+
+/**
+ * out[i] = in[i].toU32().
+ */
+void packColors (StridedSpan<const Color> in, StridedSpan<u32> out);
+
+/**
+ * out[i] = in[i].toVec4f(true).
+ */
+void colorsToVec4f (StridedSpan<const Color> in, StridedSpan<Vec4f> out);
+
+/**
+ * out[i] = Color::fromVec4f(in[i], true).
+ */
+void colorsFromVec4f (StridedSpan<const Vec4f> in, StridedSpan<Color> out);
+
+/**
+ * out[i] = in[i].toLinear(). Channels are decoded through a table.
+ */
+void colorsToLinear (StridedSpan<const Color> in, StridedSpan<Vec4f> out);
+
+/**
+ * out[i] = Color::fromLinear(in[i]).
+ */
+void colorsFromLinear (StridedSpan<const Vec4f> in, StridedSpan<Color> out);
+
+/**
+ * out[i] = Color::fromHSL(in[i].x, in[i].y, in[i].z).
+ */
+void colorsFromHSL (StridedSpan<const Vec3f> in, StridedSpan<Color> out);
+
+/**
+ * out[i] = in[i].toHSL().
+ */
+void colorsToHSL (StridedSpan<const Color> in, StridedSpan<Vec3f> out);
+
+/**
+ * out[i] = Color::fromHSV(in[i].x, in[i].y, in[i].z).
+ */
+void colorsFromHSV (StridedSpan<const Vec3f> in, StridedSpan<Color> out);
+
+/**
+ * out[i] = in[i].toHSV().
+ */
+void colorsToHSV (StridedSpan<const Color> in, StridedSpan<Vec3f> out);
+
+/**
+ * out[i] = srgbToLinear(in[i]), to within 1e-6 for 0..1.
+ */
+void srgbToLinear (StridedSpan<const float> in, StridedSpan<float> out);
+
+/**
+ * out[i] = linearToSrgb(in[i]), to within 1e-6 for 0..1.
+ */
+void linearToSrgb (StridedSpan<const float> in, StridedSpan<float> out);
+
+#endif /* __SGE_COLORBATCH_H */
@@ -0,0 +1,386 @@
+/*---  FastMath.h - Approximate Float Functions  --------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Polynomial approximations of rsqrt, sin, cos, atan2, exp2, log2
+ *   and pow, for code which calls them often enough for <cmath> to show.
+ *
+ * Every function is a template which works on float, and on Floatx4 and
+ * Floatx8 to evaluate 4 or 8 values at once with no branches. Each takes
+ * an Accuracy: kHigh is within a few ulp of <cmath> over the documented
+ * domain, kLow trades a few more bits for fewer operations. The error
+ * bounds below are checked by fastmath_test.cpp.
+ *
+ *   math::fast::sin(x);                     // kHigh
+ *   math::fast::sin<math::fast::kLow>(x);
+ *
+ * The float forms give the same results as each lane of the wide forms
+ * (FMA aside). One float at a time, kHigh is no faster than a good libm;
+ * the gains are in kLow and in evaluating 8 values at once.
+ *
+ * Inputs outside the documented domains (including NaN and infinity) give
+ * unspecified results.
+ */
+#ifndef __SGE_FASTMATH_H
+#define __SGE_FASTMATH_H
+
+#include <cstring> // std::memcpy
+
+namespace math {
+namespace fast {
+
+enum Accuracy { kLow, kHigh };
+
+/**
+ * 1 / sqrt(x), for positive normal x. One Newton-Raphson step on the
+ * hardware estimate for kLow, two for kHigh.
+ *
+ * Relative error: kLow 5e-5 (3e-7 with SSE's more precise estimate),
+ * kHigh 3e-7.
+ */
+template <Accuracy A = kHigh, typename T>
+T rsqrt (const T &x);
+
+/**
+ * sin(x), for |x| <= 8192.
+ *
+ * Absolute error: kLow 2e-5, kHigh 2e-7.
+ */
+template <Accuracy A = kHigh, typename T>
+T sin (const T &x);
+
+/**
+ * cos(x), for |x| <= 8192.
+ *
+ * Absolute error: kLow 2e-5, kHigh 2e-7.
+ */
+template <Accuracy A = kHigh, typename T>
+T cos (const T &x);
+
+/**
+ * sin(x) and cos(x) together, for about the cost of one.
+ */
+template <Accuracy A = kHigh, typename T>
+void sincos (const T &x, T &s, T &c);
+
+/**
+ * atan2(y, x), in [-pi, pi]. The signs of zeros are ignored, so
+ * atan2(0, 0) is 0 and atan2(-0, -1) is pi.
+ *
+ * Absolute error: kLow 1e-4, kHigh 5e-7.
+ */
+template <Accuracy A = kHigh, typename T>
+T atan2 (const T &y, const T &x);
+
+/**
+ * 2^x. x is clamped to [-126, 127.49].
+ *
+ * Relative error: kLow 2e-4, kHigh 3e-7.
+ */
+template <Accuracy A = kHigh, typename T>
+T exp2 (const T &x);
+
+/**
+ * log2(x), for positive normal x.
+ *
+ * Absolute error: kLow 1.5e-4, kHigh 3e-7 plus one ulp of the result.
+ */
+template <Accuracy A = kHigh, typename T>
+T log2 (const T &x);
+
+/**
+ * x^y = exp2(y * log2(x)), for positive normal x. The relative error
+ * grows with |y * log2(x)|, as the absolute error of that product
+ * becomes the relative error of the result.
+ *
+ * Relative error for x in [0.01, 10] and |y| <= 4: kLow 5e-4, kHigh 2e-6.
+ */
+template <Accuracy A = kHigh, typename T>
+T pow (const T &x, const T &y);
+
+// --------------------------------------------------------------------------
+
+//==========================
+// Lane operations on float
+//==========================
+
+// The same operations as Floatx4 and Floatx8, so the functions below can
+// be written once for all three.
+
+inline float madd (const float a, const float b, const float c) { return a * b + c; }
+
+inline bool cmpEq (const float a, const float b) { return a == b; }
+inline bool cmpLt (const float a, const float b) { return a < b; }
+inline bool cmpGt (const float a, const float b) { return a > b; }
+
+// Branch free: the masks depend on the data, e.g. the quadrant in sin().
+inline float select (const bool mask, const float a, const float b) {
+    u32 ua, ub;
+    std::memcpy(&ua, &a, sizeof(ua));
+    std::memcpy(&ub, &b, sizeof(ub));
+    const u32 m = 0u - static_cast<u32>(mask);
+    const u32 bits = (ua & m) | (ub & ~m);
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+inline float floor (const float a) {
+    const float t = static_cast<float>(static_cast<s32>(a));
+    return t - static_cast<float>(t > a);
+}
+
+inline float rsqrtEstimate (const float a) {
+#if SGE_SIMD_SSE
+    return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+#else
+    return 1.0f / sqrtf(a);
+#endif
+}
+
+inline float exp2i (const float n) {
+    const u32 bits = static_cast<u32>(static_cast<s32>(n) + 127) << 23;
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+inline float exponent (const float a) {
+    u32 bits;
+    std::memcpy(&bits, &a, sizeof(bits));
+    return static_cast<float>(static_cast<s32>(bits >> 23) - 127);
+}
+
+inline float mantissa (const float a) {
+    u32 bits;
+    std::memcpy(&bits, &a, sizeof(bits));
+    bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+template <typename T>
+inline T absolute (const T &x) { return max(x, -x); }
+
+//==========================
+// Functions
+//==========================
+
+template <Accuracy A, typename T>
+inline T rsqrt (const T &x) {
+    const T half = x * T(0.5f);
+
+    T r = rsqrtEstimate(x);
+    r = r * madd(-half * r, r, T(1.5f));
+    if (A == kHigh) {
+        r = r * madd(-half * r, r, T(1.5f));
+    }
+    return r;
+}
+
+// x = r + q * pi/2, with r in [-pi/4, pi/4]. pi/2 is split into parts
+// with few enough bits that q times the leading parts is exact (Cody and
+// Waite).
+template <Accuracy A, typename T>
+inline T reduceHalfPi (const T &x, T &r) {
+    const T q = floor(madd(x, T(2.0f / kPi), T(0.5f)));
+
+    r = madd(q, T(-1.5703125f), x);
+    if (A == kLow) {
+        r = madd(q, T(-4.83826794897e-4f), r);
+    } else {
+        r = madd(q, T(-4.837512969970703125e-4f), r);
+        r = madd(q, T(-7.54978995489188216e-8f), r);
+    }
+    return q;
+}
+
+// sin(r) and cos(r) for r in [-pi/4, pi/4], z = r * r. kHigh uses the
+// Cephes coefficients, kLow minimax fits of lower degree.
+template <Accuracy A, typename T>
+inline T sinPoly (const T &r, const T &z) {
+    const T p = (A == kLow) ? madd(z, T(8.152992e-3f), T(-1.6662834e-1f))
+                            : madd(z, madd(z, T(-1.9515295891e-4f), T(8.3321608736e-3f)),
+                                   T(-1.6666654611e-1f));
+    return madd(p * z, r, r);
+}
+
+template <Accuracy A, typename T>
+inline T cosPoly (const T &z) {
+    if (A == kLow) {
+        return madd(z, madd(z, T(4.0488936e-2f), T(-4.9977631e-1f)), T(1.0f));
+    }
+
+    const T p = madd(z, madd(z, T(2.443315711809948e-5f), T(-1.388731625493765e-3f)),
+                     T(4.166664568298827e-2f));
+    return madd(p * z, z, madd(z, T(-0.5f), T(1.0f)));
+}
+
+// Choose and negate the polynomials by quadrant, q mod 4: sin is sin,
+// cos, -sin, -cos and cos is cos, -sin, -cos, sin.
+template <Accuracy A, typename T>
+inline void sincosQuadrant (const T &x, T *s, T *c) {
+    T r;
+    const T q = reduceHalfPi<A>(x, r);
+    const T z = r * r;
+    const T ps = sinPoly<A>(r, z);
+    const T pc = cosPoly<A>(z);
+
+    const T q4 = q - T(4.0f) * floor(q * T(0.25f));
+    const auto odd = cmpEq(q4 - T(2.0f) * floor(q4 * T(0.5f)), T(1.0f));
+
+    if (s) {
+        const T v = select(odd, pc, ps);
+        *s = select(cmpGt(q4, T(1.5f)), -v, v);
+    }
+    if (c) {
+        const T v = select(odd, ps, pc);
+        *c = select(cmpLt(absolute(q4 - T(1.5f)), T(1.0f)), -v, v);
+    }
+}
+
+// The same for a single float, where integer operations on the quadrant
+// are cheaper than the masks above.
+template <Accuracy A>
+inline void sincosQuadrant (const float &x, float *s, float *c) {
+    float r;
+    const s32 q = static_cast<s32>(reduceHalfPi<A>(x, r));
+    const float z = r * r;
+    const float ps = sinPoly<A>(r, z);
+    const float pc = cosPoly<A>(z);
+
+    const bool odd = (q & 1) != 0;
+    u32 bits;
+    if (s) {
+        const float v = select(odd, pc, ps);
+        std::memcpy(&bits, &v, sizeof(bits));
+        bits ^= static_cast<u32>(q & 2) << 30;
+        std::memcpy(s, &bits, sizeof(bits));
+    }
+    if (c) {
+        const float v = select(odd, ps, pc);
+        std::memcpy(&bits, &v, sizeof(bits));
+        bits ^= static_cast<u32>((q + 1) & 2) << 30;
+        std::memcpy(c, &bits, sizeof(bits));
+    }
+}
+
+template <Accuracy A, typename T>
+inline T sin (const T &x) {
+    T s;
+    sincosQuadrant<A>(x, &s, static_cast<T*>(nullptr));
+    return s;
+}
+
+template <Accuracy A, typename T>
+inline T cos (const T &x) {
+    T c;
+    sincosQuadrant<A>(x, static_cast<T*>(nullptr), &c);
+    return c;
+}
+
+template <Accuracy A, typename T>
+inline void sincos (const T &x, T &s, T &c) {
+    sincosQuadrant<A>(x, &s, &c);
+}
+
+// atan(t) of t = min(|x|, |y|) / max(|x|, |y|) in [0, 1], then reflected
+// into the right octant.
+template <Accuracy A, typename T>
+inline T atan2 (const T &y, const T &x) {
+    const T ax = absolute(x);
+    const T ay = absolute(y);
+    const T hi = max(ax, ay);
+    const T lo = min(ax, ay);
+    const T t = select(cmpGt(hi, T(0.0f)), lo / hi, T(0.0f));
+
+    T a;
+    if (A == kLow) {
+        const T z = t * t;
+        a = t * madd(z, madd(z, madd(z, T(-3.8986512e-2f), T(1.4626446e-1f)),
+                             T(-3.2117497e-1f)), T(9.9921381e-1f));
+    } else {
+        // Cephes atanf, after reducing t > tan(pi/8) with
+        // atan(t) = pi/4 + atan((t - 1) / (t + 1)).
+        const auto big = cmpGt(t, T(0.4142135623730950f));
+        const T u = select(big, (t - T(1.0f)) / (t + T(1.0f)), t);
+        const T z = u * u;
+        const T p = madd(z, madd(z, madd(z, T(8.05374449538e-2f), T(-1.38776856032e-1f)),
+                                 T(1.99777106478e-1f)), T(-3.33329491539e-1f));
+        a = select(big, T(kPi * 0.25f), T(0.0f)) + madd(p * z, u, u);
+    }
+
+    a = select(cmpGt(ay, ax), T(kHalfPi) - a, a);
+    a = select(cmpLt(x, T(0.0f)), T(kPi) - a, a);
+    return select(cmpLt(y, T(0.0f)), -a, a);
+}
+
+// 2^x = 2^n * 2^f, with n = round(x) and f in [-0.5, 0.5].
+template <Accuracy A, typename T>
+inline T exp2 (const T &x) {
+    const T xc = min(max(x, T(-126.0f)), T(127.49f));
+    const T n = floor(xc + T(0.5f));
+    const T f = xc - n;
+
+    T p;
+    if (A == kLow) {
+        p = madd(f, madd(f, madd(f, T(5.5977148e-2f), T(2.4222550e-1f)), T(6.9311249e-1f)), T(1.0f));
+    } else {
+        // Cephes exp2f.
+        p = madd(f, T(1.535336188319500e-4f), T(1.339887440266574e-3f));
+        p = madd(f, p, T(9.618437357674640e-3f));
+        p = madd(f, p, T(5.550332471162809e-2f));
+        p = madd(f, p, T(2.402264791363012e-1f));
+        p = madd(f, p, T(6.931472028550421e-1f));
+        p = madd(f, p, T(1.0f));
+    }
+    return p * exp2i(n);
+}
+
+// log2(x) = e + log2(1 + f), with 1 + f the mantissa scaled into
+// [sqrt(2) / 2, sqrt(2)].
+template <Accuracy A, typename T>
+inline T log2 (const T &x) {
+    T m = mantissa(x);
+    T e = exponent(x);
+    const auto big = cmpGt(m, T(1.41421356f));
+    m = select(big, m * T(0.5f), m);
+    e = select(big, e + T(1.0f), e);
+    const T f = m - T(1.0f);
+
+    if (A == kLow) {
+        const T p = madd(f, madd(f, madd(f, T(-3.2962972e-1f), T(5.1750939e-1f)),
+                                 T(-7.2490416e-1f)), T(1.4417606f));
+        return madd(f, p, e);
+    }
+
+    // Cephes logf, scaled by log2(e).
+    T p = madd(f, T(7.0376836292e-2f), T(-1.1514610310e-1f));
+    p = madd(f, p, T(1.1676998740e-1f));
+    p = madd(f, p, T(-1.2420140846e-1f));
+    p = madd(f, p, T(1.4249322787e-1f));
+    p = madd(f, p, T(-1.6668057665e-1f));
+    p = madd(f, p, T(2.0000714765e-1f));
+    p = madd(f, p, T(-2.4999993993e-1f));
+    p = madd(f, p, T(3.3333331174e-1f));
+
+    const T z = f * f;
+    const T y = madd(p * f, z, z * T(-0.5f));
+    return madd(f + y, T(1.44269504089f), e);
+}
+
+template <Accuracy A, typename T>
+inline T pow (const T &x, const T &y) {
+    return exp2<A>(y * log2<A>(x));
+}
+
+} /* namespace fast */
+} /* namespace math */
+
+#endif /* __SGE_FASTMATH_H */
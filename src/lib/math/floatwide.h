@@ -0,0 +1,564 @@
+/*---  FloatWide.h - Wide Float Headers  ---------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Defines Floatx4 and Floatx8, 4 and 8 float lanes operated on
+ * together.
+ *
+ * Floatx4 is one SSE/NEON register and Floatx8 is one AVX register, or a
+ * pair of Floatx4 when AVX isn't available. Without a SIMD backend both
+ * fall back to plain arrays. They are the lane type for the SoA wide
+ * vector types in vector3wide.h.
+ *
+ * Comparisons return a mask with every bit of a lane set where the
+ * comparison holds. Masks are consumed by select() and movemask().
+ *
+ * floor(), exp2i(), exponent() and mantissa() work on the bits of the
+ * IEEE representation, as building blocks for the approximations in
+ * fastmath.h.
+ */
+#ifndef __SGE_FLOATWIDE_H
+#define __SGE_FLOATWIDE_H
+
+#include <cstring> // std::memcpy
+
+/**
+ * 4 float lanes.
+ */
+class Floatx4 {
+public:
+    static constexpr int kWidth = 4;
+
+#if SGE_SIMD_SSE
+    __m128 v;
+#elif SGE_SIMD_NEON
+    float32x4_t v;
+#else
+    float v[4];
+#endif
+
+public:
+    /** Default Constructor. All lanes 0. */
+    Floatx4 ();
+
+    /** Fill Constructor. */
+    explicit Floatx4 (const float f);
+
+    /** Construct from lane values. */
+    explicit Floatx4 (const float a, const float b, const float c, const float d);
+
+#if SGE_SIMD_SSE
+    /** Wrap a native register. */
+    Floatx4 (const __m128 r) : v(r) { }
+#elif SGE_SIMD_NEON
+    /** Wrap a native register. */
+    Floatx4 (const float32x4_t r) : v(r) { }
+#endif
+
+    /** Load 4 floats from p. p need not be aligned. */
+    static Floatx4 load (const float *p);
+
+    /** Store 4 floats to p. p need not be aligned. */
+    void store (float *p) const;
+
+    /** Value of lane i. Slow; for tests and debugging. */
+    float operator[] (const std::size_t i) const;
+
+    /**
+     * Gather the sign bit of each lane into the low 4 bits of an int,
+     * lane 0 in bit 0. For a mask this gives one bit per passing lane.
+     */
+    int movemask () const;
+};
+
+/**
+ * 8 float lanes.
+ */
+class Floatx8 {
+public:
+    static constexpr int kWidth = 8;
+
+#if SGE_SIMD_AVX
+    __m256 v;
+#else
+    Floatx4 lo; /**< Lanes 0-3. */
+    Floatx4 hi; /**< Lanes 4-7. */
+#endif
+
+public:
+    /** Default Constructor. All lanes 0. */
+    Floatx8 ();
+
+    /** Fill Constructor. */
+    explicit Floatx8 (const float f);
+
+    /** Construct from two halves. */
+    explicit Floatx8 (const Floatx4 &pLo, const Floatx4 &pHi);
+
+#if SGE_SIMD_AVX
+    /** Wrap a native register. */
+    Floatx8 (const __m256 r) : v(r) { }
+#endif
+
+    /** Load 8 floats from p. p need not be aligned. */
+    static Floatx8 load (const float *p);
+
+    /** Store 8 floats to p. p need not be aligned. */
+    void store (float *p) const;
+
+    /** Value of lane i. Slow; for tests and debugging. */
+    float operator[] (const std::size_t i) const;
+
+    /**
+     * Gather the sign bit of each lane into the low 8 bits of an int,
+     * lane 0 in bit 0. For a mask this gives one bit per passing lane.
+     */
+    int movemask () const;
+};
+
+// --------------------------------------------------------------------------
+
+//==========================
+// Floatx4
+//==========================
+
+#if SGE_SIMD_SSE
+
+inline Floatx4::Floatx4 () : v(_mm_setzero_ps()) { }
+
+inline Floatx4::Floatx4 (const float f) : v(_mm_set1_ps(f)) { }
+
+inline Floatx4::Floatx4 (const float a, const float b, const float c, const float d)
+      : v(_mm_setr_ps(a, b, c, d)) { }
+
+inline Floatx4 Floatx4::load (const float *p) { return _mm_loadu_ps(p); }
+
+inline void Floatx4::store (float *p) const { _mm_storeu_ps(p, v); }
+
+inline int Floatx4::movemask () const { return _mm_movemask_ps(v); }
+
+inline Floatx4 operator- (const Floatx4 &a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+inline Floatx4 operator+ (const Floatx4 &a, const Floatx4 &b) { return _mm_add_ps(a.v, b.v); }
+inline Floatx4 operator- (const Floatx4 &a, const Floatx4 &b) { return _mm_sub_ps(a.v, b.v); }
+inline Floatx4 operator* (const Floatx4 &a, const Floatx4 &b) { return _mm_mul_ps(a.v, b.v); }
+inline Floatx4 operator/ (const Floatx4 &a, const Floatx4 &b) { return _mm_div_ps(a.v, b.v); }
+
+/** a * b + c, fused when the target has FMA. */
+inline Floatx4 madd (const Floatx4 &a, const Floatx4 &b, const Floatx4 &c) {
+    return simd::madd(a.v, b.v, c.v);
+}
+
+inline Floatx4 min (const Floatx4 &a, const Floatx4 &b) { return _mm_min_ps(a.v, b.v); }
+inline Floatx4 max (const Floatx4 &a, const Floatx4 &b) { return _mm_max_ps(a.v, b.v); }
+inline Floatx4 sqrt (const Floatx4 &a) { return _mm_sqrt_ps(a.v); }
+
+inline Floatx4 cmpEq (const Floatx4 &a, const Floatx4 &b) { return _mm_cmpeq_ps(a.v, b.v); }
+inline Floatx4 cmpLt (const Floatx4 &a, const Floatx4 &b) { return _mm_cmplt_ps(a.v, b.v); }
+inline Floatx4 cmpLe (const Floatx4 &a, const Floatx4 &b) { return _mm_cmple_ps(a.v, b.v); }
+inline Floatx4 cmpGt (const Floatx4 &a, const Floatx4 &b) { return _mm_cmpgt_ps(a.v, b.v); }
+inline Floatx4 cmpGe (const Floatx4 &a, const Floatx4 &b) { return _mm_cmpge_ps(a.v, b.v); }
+
+/** Lanes of a where mask is set, otherwise lanes of b. */
+inline Floatx4 select (const Floatx4 &mask, const Floatx4 &a, const Floatx4 &b) {
+#if SGE_SIMD_SSE41
+    return _mm_blendv_ps(b.v, a.v, mask.v);
+#else
+    return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+#endif
+}
+
+/** Largest integer <= a, for |a| < 2^31. */
+inline Floatx4 floor (const Floatx4 &a) {
+#if SGE_SIMD_SSE41
+    return _mm_floor_ps(a.v);
+#else
+    const __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+    return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a.v), _mm_set1_ps(1.0f)));
+#endif
+}
+
+/** Estimate of 1 / sqrt(a), to about 12 bits. */
+inline Floatx4 rsqrtEstimate (const Floatx4 &a) { return _mm_rsqrt_ps(a.v); }
+
+/** 2^n, for integer valued n in [-126, 127]. */
+inline Floatx4 exp2i (const Floatx4 &n) {
+    const __m128i e = _mm_add_epi32(_mm_cvttps_epi32(n.v), _mm_set1_epi32(127));
+    return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+}
+
+/** floor(log2(a)), for positive normal a. */
+inline Floatx4 exponent (const Floatx4 &a) {
+    const __m128i e = _mm_srli_epi32(_mm_castps_si128(a.v), 23);
+    return _mm_cvtepi32_ps(_mm_sub_epi32(e, _mm_set1_epi32(127)));
+}
+
+/** a / 2^exponent(a), in [1, 2), for positive normal a. */
+inline Floatx4 mantissa (const Floatx4 &a) {
+    const __m128i m = _mm_and_si128(_mm_castps_si128(a.v), _mm_set1_epi32(0x007FFFFF));
+    return _mm_castsi128_ps(_mm_or_si128(m, _mm_set1_epi32(0x3F800000)));
+}
+
+#elif SGE_SIMD_NEON
+
+inline Floatx4::Floatx4 () : v(vdupq_n_f32(0.0f)) { }
+
+inline Floatx4::Floatx4 (const float f) : v(vdupq_n_f32(f)) { }
+
+inline Floatx4::Floatx4 (const float a, const float b, const float c, const float d) {
+    const float t[4] = {a, b, c, d};
+    v = vld1q_f32(t);
+}
+
+inline Floatx4 Floatx4::load (const float *p) { return vld1q_f32(p); }
+
+inline void Floatx4::store (float *p) const { vst1q_f32(p, v); }
+
+inline int Floatx4::movemask () const {
+    const uint32x4_t s = vshrq_n_u32(vreinterpretq_u32_f32(v), 31);
+    return static_cast<int>(vgetq_lane_u32(s, 0) | (vgetq_lane_u32(s, 1) << 1) |
+                            (vgetq_lane_u32(s, 2) << 2) | (vgetq_lane_u32(s, 3) << 3));
+}
+
+inline Floatx4 operator- (const Floatx4 &a) { return vnegq_f32(a.v); }
+inline Floatx4 operator+ (const Floatx4 &a, const Floatx4 &b) { return vaddq_f32(a.v, b.v); }
+inline Floatx4 operator- (const Floatx4 &a, const Floatx4 &b) { return vsubq_f32(a.v, b.v); }
+inline Floatx4 operator* (const Floatx4 &a, const Floatx4 &b) { return vmulq_f32(a.v, b.v); }
+
+inline Floatx4 operator/ (const Floatx4 &a, const Floatx4 &b) {
+#if defined(__aarch64__)
+    return vdivq_f32(a.v, b.v);
+#else
+    // Reciprocal estimate refined by two Newton-Raphson steps.
+    float32x4_t r = vrecpeq_f32(b.v);
+    r = vmulq_f32(vrecpsq_f32(b.v, r), r);
+    r = vmulq_f32(vrecpsq_f32(b.v, r), r);
+    return vmulq_f32(a.v, r);
+#endif
+}
+
+/** a * b + c. */
+inline Floatx4 madd (const Floatx4 &a, const Floatx4 &b, const Floatx4 &c) {
+    return vmlaq_f32(c.v, a.v, b.v);
+}
+
+inline Floatx4 min (const Floatx4 &a, const Floatx4 &b) { return vminq_f32(a.v, b.v); }
+inline Floatx4 max (const Floatx4 &a, const Floatx4 &b) { return vmaxq_f32(a.v, b.v); }
+
+inline Floatx4 sqrt (const Floatx4 &a) {
+#if defined(__aarch64__)
+    return vsqrtq_f32(a.v);
+#else
+    return Floatx4(sqrtf(vgetq_lane_f32(a.v, 0)), sqrtf(vgetq_lane_f32(a.v, 1)),
+                   sqrtf(vgetq_lane_f32(a.v, 2)), sqrtf(vgetq_lane_f32(a.v, 3)));
+#endif
+}
+
+inline Floatx4 cmpEq (const Floatx4 &a, const Floatx4 &b) { return vreinterpretq_f32_u32(vceqq_f32(a.v, b.v)); }
+inline Floatx4 cmpLt (const Floatx4 &a, const Floatx4 &b) { return vreinterpretq_f32_u32(vcltq_f32(a.v, b.v)); }
+inline Floatx4 cmpLe (const Floatx4 &a, const Floatx4 &b) { return vreinterpretq_f32_u32(vcleq_f32(a.v, b.v)); }
+inline Floatx4 cmpGt (const Floatx4 &a, const Floatx4 &b) { return vreinterpretq_f32_u32(vcgtq_f32(a.v, b.v)); }
+inline Floatx4 cmpGe (const Floatx4 &a, const Floatx4 &b) { return vreinterpretq_f32_u32(vcgeq_f32(a.v, b.v)); }
+
+/** Lanes of a where mask is set, otherwise lanes of b. */
+inline Floatx4 select (const Floatx4 &mask, const Floatx4 &a, const Floatx4 &b) {
+    return vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v);
+}
+
+/** Largest integer <= a, for |a| < 2^31. */
+inline Floatx4 floor (const Floatx4 &a) {
+#if defined(__aarch64__)
+    return vrndmq_f32(a.v);
+#else
+    const float32x4_t t = vcvtq_f32_s32(vcvtq_s32_f32(a.v));
+    const uint32x4_t one = vreinterpretq_u32_f32(vdupq_n_f32(1.0f));
+    return vsubq_f32(t, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(t, a.v), one)));
+#endif
+}
+
+/** Estimate of 1 / sqrt(a), to about 8 bits. */
+inline Floatx4 rsqrtEstimate (const Floatx4 &a) { return vrsqrteq_f32(a.v); }
+
+/** 2^n, for integer valued n in [-126, 127]. */
+inline Floatx4 exp2i (const Floatx4 &n) {
+    const int32x4_t e = vaddq_s32(vcvtq_s32_f32(n.v), vdupq_n_s32(127));
+    return vreinterpretq_f32_s32(vshlq_n_s32(e, 23));
+}
+
+/** floor(log2(a)), for positive normal a. */
+inline Floatx4 exponent (const Floatx4 &a) {
+    const int32x4_t e = vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_f32(a.v), 23));
+    return vcvtq_f32_s32(vsubq_s32(e, vdupq_n_s32(127)));
+}
+
+/** a / 2^exponent(a), in [1, 2), for positive normal a. */
+inline Floatx4 mantissa (const Floatx4 &a) {
+    const uint32x4_t m = vandq_u32(vreinterpretq_u32_f32(a.v), vdupq_n_u32(0x007FFFFF));
+    return vreinterpretq_f32_u32(vorrq_u32(m, vdupq_n_u32(0x3F800000)));
+}
+
+#else
+
+inline Floatx4::Floatx4 () : v{0.0f, 0.0f, 0.0f, 0.0f} { }
+
+inline Floatx4::Floatx4 (const float f) : v{f, f, f, f} { }
+
+inline Floatx4::Floatx4 (const float a, const float b, const float c, const float d)
+      : v{a, b, c, d} { }
+
+inline Floatx4 Floatx4::load (const float *p) { return Floatx4(p[0], p[1], p[2], p[3]); }
+
+inline void Floatx4::store (float *p) const { std::memcpy(p, v, sizeof(v)); }
+
+// Reinterpret the bits of a float as a u32 and back.
+inline u32 floatx4Bits (const float f) {
+    u32 bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+inline float floatx4FromBits (const u32 bits) {
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+inline int Floatx4::movemask () const {
+    int bits = 0;
+    for (int i = 0; i < 4; ++i) {
+        bits |= static_cast<int>(floatx4Bits(v[i]) >> 31) << i;
+    }
+    return bits;
+}
+
+// Apply expr to each lane, with a and b the lane values of the operands.
+#define SGE_FLOATX4_LANEWISE(expr)                                   \
+    Floatx4 r;                                                       \
+    for (int i = 0; i < 4; ++i) {                                    \
+        r.v[i] = (expr);                                             \
+    }                                                                \
+    return r
+
+// All bits set in lanes where cond holds. A set lane is a NaN pattern, so
+// masks are only ever inspected and combined as integer bits, like the SIMD
+// backends do; testing them with float operations such as std::signbit
+// trips up GCC's vectorizer.
+inline float floatx4LaneMask (const bool cond) {
+    return floatx4FromBits(cond ? 0xFFFFFFFFu : 0u);
+}
+
+inline Floatx4 operator- (const Floatx4 &a) { SGE_FLOATX4_LANEWISE(-a.v[i]); }
+inline Floatx4 operator+ (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(a.v[i] + b.v[i]); }
+inline Floatx4 operator- (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(a.v[i] - b.v[i]); }
+inline Floatx4 operator* (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(a.v[i] * b.v[i]); }
+inline Floatx4 operator/ (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(a.v[i] / b.v[i]); }
+
+/** a * b + c. */
+inline Floatx4 madd (const Floatx4 &a, const Floatx4 &b, const Floatx4 &c) {
+    SGE_FLOATX4_LANEWISE(a.v[i] * b.v[i] + c.v[i]);
+}
+
+inline Floatx4 min (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(a.v[i] < b.v[i] ? a.v[i] : b.v[i]); }
+inline Floatx4 max (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(a.v[i] > b.v[i] ? a.v[i] : b.v[i]); }
+inline Floatx4 sqrt (const Floatx4 &a) { SGE_FLOATX4_LANEWISE(sqrtf(a.v[i])); }
+
+inline Floatx4 cmpEq (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(floatx4LaneMask(a.v[i] == b.v[i])); }
+inline Floatx4 cmpLt (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(floatx4LaneMask(a.v[i] < b.v[i])); }
+inline Floatx4 cmpLe (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(floatx4LaneMask(a.v[i] <= b.v[i])); }
+inline Floatx4 cmpGt (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(floatx4LaneMask(a.v[i] > b.v[i])); }
+inline Floatx4 cmpGe (const Floatx4 &a, const Floatx4 &b) { SGE_FLOATX4_LANEWISE(floatx4LaneMask(a.v[i] >= b.v[i])); }
+
+/** Lanes of a where mask is set, otherwise lanes of b. */
+inline Floatx4 select (const Floatx4 &mask, const Floatx4 &a, const Floatx4 &b) {
+    SGE_FLOATX4_LANEWISE(floatx4FromBits((floatx4Bits(mask.v[i]) & floatx4Bits(a.v[i])) |
+                                         (~floatx4Bits(mask.v[i]) & floatx4Bits(b.v[i]))));
+}
+
+/** Largest integer <= a. */
+inline Floatx4 floor (const Floatx4 &a) { SGE_FLOATX4_LANEWISE(floorf(a.v[i])); }
+
+/** 1 / sqrt(a). Exact without a SIMD backend. */
+inline Floatx4 rsqrtEstimate (const Floatx4 &a) { SGE_FLOATX4_LANEWISE(1.0f / sqrtf(a.v[i])); }
+
+/** 2^n, for integer valued n in [-126, 127]. */
+inline Floatx4 exp2i (const Floatx4 &n) {
+    SGE_FLOATX4_LANEWISE(floatx4FromBits(static_cast<u32>(static_cast<s32>(n.v[i]) + 127) << 23));
+}
+
+/** floor(log2(a)), for positive normal a. */
+inline Floatx4 exponent (const Floatx4 &a) {
+    SGE_FLOATX4_LANEWISE(static_cast<float>(static_cast<s32>(floatx4Bits(a.v[i]) >> 23) - 127));
+}
+
+/** a / 2^exponent(a), in [1, 2), for positive normal a. */
+inline Floatx4 mantissa (const Floatx4 &a) {
+    SGE_FLOATX4_LANEWISE(floatx4FromBits((floatx4Bits(a.v[i]) & 0x007FFFFFu) | 0x3F800000u));
+}
+
+#undef SGE_FLOATX4_LANEWISE
+
+#endif /* SGE_SIMD_SSE */
+
+inline float Floatx4::operator[] (const std::size_t i) const {
+    float t[4];
+    store(t);
+    return t[i];
+}
+
+inline Floatx4 &operator+= (Floatx4 &a, const Floatx4 &b) { return a = a + b; }
+inline Floatx4 &operator-= (Floatx4 &a, const Floatx4 &b) { return a = a - b; }
+inline Floatx4 &operator*= (Floatx4 &a, const Floatx4 &b) { return a = a * b; }
+inline Floatx4 &operator/= (Floatx4 &a, const Floatx4 &b) { return a = a / b; }
+
+//==========================
+// Floatx8
+//==========================
+
+#if SGE_SIMD_AVX
+
+inline Floatx8::Floatx8 () : v(_mm256_setzero_ps()) { }
+
+inline Floatx8::Floatx8 (const float f) : v(_mm256_set1_ps(f)) { }
+
+inline Floatx8::Floatx8 (const Floatx4 &pLo, const Floatx4 &pHi)
+      : v(_mm256_insertf128_ps(_mm256_castps128_ps256(pLo.v), pHi.v, 1)) { }
+
+inline Floatx8 Floatx8::load (const float *p) { return _mm256_loadu_ps(p); }
+
+inline void Floatx8::store (float *p) const { _mm256_storeu_ps(p, v); }
+
+inline int Floatx8::movemask () const { return _mm256_movemask_ps(v); }
+
+inline Floatx8 operator- (const Floatx8 &a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+inline Floatx8 operator+ (const Floatx8 &a, const Floatx8 &b) { return _mm256_add_ps(a.v, b.v); }
+inline Floatx8 operator- (const Floatx8 &a, const Floatx8 &b) { return _mm256_sub_ps(a.v, b.v); }
+inline Floatx8 operator* (const Floatx8 &a, const Floatx8 &b) { return _mm256_mul_ps(a.v, b.v); }
+inline Floatx8 operator/ (const Floatx8 &a, const Floatx8 &b) { return _mm256_div_ps(a.v, b.v); }
+
+/** a * b + c, fused when the target has FMA. */
+inline Floatx8 madd (const Floatx8 &a, const Floatx8 &b, const Floatx8 &c) {
+    return simd::madd(a.v, b.v, c.v);
+}
+
+inline Floatx8 min (const Floatx8 &a, const Floatx8 &b) { return _mm256_min_ps(a.v, b.v); }
+inline Floatx8 max (const Floatx8 &a, const Floatx8 &b) { return _mm256_max_ps(a.v, b.v); }
+inline Floatx8 sqrt (const Floatx8 &a) { return _mm256_sqrt_ps(a.v); }
+
+inline Floatx8 cmpEq (const Floatx8 &a, const Floatx8 &b) { return _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ); }
+inline Floatx8 cmpLt (const Floatx8 &a, const Floatx8 &b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+inline Floatx8 cmpLe (const Floatx8 &a, const Floatx8 &b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+inline Floatx8 cmpGt (const Floatx8 &a, const Floatx8 &b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+inline Floatx8 cmpGe (const Floatx8 &a, const Floatx8 &b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+
+/** Lanes of a where mask is set, otherwise lanes of b. */
+inline Floatx8 select (const Floatx8 &mask, const Floatx8 &a, const Floatx8 &b) {
+    return _mm256_blendv_ps(b.v, a.v, mask.v);
+}
+
+/** Largest integer <= a. */
+inline Floatx8 floor (const Floatx8 &a) { return _mm256_floor_ps(a.v); }
+
+/** Estimate of 1 / sqrt(a), to about 12 bits. */
+inline Floatx8 rsqrtEstimate (const Floatx8 &a) { return _mm256_rsqrt_ps(a.v); }
+
+#if SGE_SIMD_AVX2
+
+/** 2^n, for integer valued n in [-126, 127]. */
+inline Floatx8 exp2i (const Floatx8 &n) {
+    const __m256i e = _mm256_add_epi32(_mm256_cvttps_epi32(n.v), _mm256_set1_epi32(127));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+}
+
+/** floor(log2(a)), for positive normal a. */
+inline Floatx8 exponent (const Floatx8 &a) {
+    const __m256i e = _mm256_srli_epi32(_mm256_castps_si256(a.v), 23);
+    return _mm256_cvtepi32_ps(_mm256_sub_epi32(e, _mm256_set1_epi32(127)));
+}
+
+/** a / 2^exponent(a), in [1, 2), for positive normal a. */
+inline Floatx8 mantissa (const Floatx8 &a) {
+    const __m256i m = _mm256_and_si256(_mm256_castps_si256(a.v), _mm256_set1_epi32(0x007FFFFF));
+    return _mm256_castsi256_ps(_mm256_or_si256(m, _mm256_set1_epi32(0x3F800000)));
+}
+
+#else
+
+// AVX has no 256 bit integer operations, so work on each half.
+inline Floatx4 lowHalf (const Floatx8 &a) { return _mm256_castps256_ps128(a.v); }
+inline Floatx4 highHalf (const Floatx8 &a) { return _mm256_extractf128_ps(a.v, 1); }
+
+inline Floatx8 exp2i (const Floatx8 &n) { return Floatx8(exp2i(lowHalf(n)), exp2i(highHalf(n))); }
+inline Floatx8 exponent (const Floatx8 &a) { return Floatx8(exponent(lowHalf(a)), exponent(highHalf(a))); }
+inline Floatx8 mantissa (const Floatx8 &a) { return Floatx8(mantissa(lowHalf(a)), mantissa(highHalf(a))); }
+
+#endif /* SGE_SIMD_AVX2 */
+
+#else
+
+inline Floatx8::Floatx8 () { }
+
+inline Floatx8::Floatx8 (const float f) : lo(f), hi(f) { }
+
+inline Floatx8::Floatx8 (const Floatx4 &pLo, const Floatx4 &pHi) : lo(pLo), hi(pHi) { }
+
+inline Floatx8 Floatx8::load (const float *p) {
+    return Floatx8(Floatx4::load(p), Floatx4::load(p + 4));
+}
+
+inline void Floatx8::store (float *p) const {
+    lo.store(p);
+    hi.store(p + 4);
+}
+
+inline int Floatx8::movemask () const { return lo.movemask() | (hi.movemask() << 4); }
+
+inline Floatx8 operator- (const Floatx8 &a) { return Floatx8(-a.lo, -a.hi); }
+inline Floatx8 operator+ (const Floatx8 &a, const Floatx8 &b) { return Floatx8(a.lo + b.lo, a.hi + b.hi); }
+inline Floatx8 operator- (const Floatx8 &a, const Floatx8 &b) { return Floatx8(a.lo - b.lo, a.hi - b.hi); }
+inline Floatx8 operator* (const Floatx8 &a, const Floatx8 &b) { return Floatx8(a.lo * b.lo, a.hi * b.hi); }
+inline Floatx8 operator/ (const Floatx8 &a, const Floatx8 &b) { return Floatx8(a.lo / b.lo, a.hi / b.hi); }
+
+/** a * b + c. */
+inline Floatx8 madd (const Floatx8 &a, const Floatx8 &b, const Floatx8 &c) {
+    return Floatx8(madd(a.lo, b.lo, c.lo), madd(a.hi, b.hi, c.hi));
+}
+
+inline Floatx8 min (const Floatx8 &a, const Floatx8 &b) { return Floatx8(min(a.lo, b.lo), min(a.hi, b.hi)); }
+inline Floatx8 max (const Floatx8 &a, const Floatx8 &b) { return Floatx8(max(a.lo, b.lo), max(a.hi, b.hi)); }
+inline Floatx8 sqrt (const Floatx8 &a) { return Floatx8(sqrt(a.lo), sqrt(a.hi)); }
+
+inline Floatx8 cmpEq (const Floatx8 &a, const Floatx8 &b) { return Floatx8(cmpEq(a.lo, b.lo), cmpEq(a.hi, b.hi)); }
+inline Floatx8 cmpLt (const Floatx8 &a, const Floatx8 &b) { return Floatx8(cmpLt(a.lo, b.lo), cmpLt(a.hi, b.hi)); }
+inline Floatx8 cmpLe (const Floatx8 &a, const Floatx8 &b) { return Floatx8(cmpLe(a.lo, b.lo), cmpLe(a.hi, b.hi)); }
+inline Floatx8 cmpGt (const Floatx8 &a, const Floatx8 &b) { return Floatx8(cmpGt(a.lo, b.lo), cmpGt(a.hi, b.hi)); }
+inline Floatx8 cmpGe (const Floatx8 &a, const Floatx8 &b) { return Floatx8(cmpGe(a.lo, b.lo), cmpGe(a.hi, b.hi)); }
+
+/** Lanes of a where mask is set, otherwise lanes of b. */
+inline Floatx8 select (const Floatx8 &mask, const Floatx8 &a, const Floatx8 &b) {
+    return Floatx8(select(mask.lo, a.lo, b.lo), select(mask.hi, a.hi, b.hi));
+}
+
+inline Floatx8 floor (const Floatx8 &a) { return Floatx8(floor(a.lo), floor(a.hi)); }
+inline Floatx8 rsqrtEstimate (const Floatx8 &a) { return Floatx8(rsqrtEstimate(a.lo), rsqrtEstimate(a.hi)); }
+inline Floatx8 exp2i (const Floatx8 &n) { return Floatx8(exp2i(n.lo), exp2i(n.hi)); }
+inline Floatx8 exponent (const Floatx8 &a) { return Floatx8(exponent(a.lo), exponent(a.hi)); }
+inline Floatx8 mantissa (const Floatx8 &a) { return Floatx8(mantissa(a.lo), mantissa(a.hi)); }
+
+#endif /* SGE_SIMD_AVX */
+
+inline float Floatx8::operator[] (const std::size_t i) const {
+    float t[8];
+    store(t);
+    return t[i];
+}
+
+inline Floatx8 &operator+= (Floatx8 &a, const Floatx8 &b) { return a = a + b; }
+inline Floatx8 &operator-= (Floatx8 &a, const Floatx8 &b) { return a = a - b; }
+inline Floatx8 &operator*= (Floatx8 &a, const Floatx8 &b) { return a = a * b; }
+inline Floatx8 &operator/= (Floatx8 &a, const Floatx8 &b) { return a = a / b; }
+
+#endif /* __SGE_FLOATWIDE_H */
@@ -5,129 +5,484 @@
 
 #include <iostream>
 
+#if SGE_SIMD_SSE
+
+//==================================
+// SIMD Helpers
+//==================================
+
+// Load the columns of a Mat3f as two full registers plus one lane, as
+// in the Mat3f product. Lane w of each column is unspecified.
+static inline void loadColumns (const Mat3f &m, __m128 &c0, __m128 &c1, __m128 &c2) {
+    const float *p = &m[0].x;
+    const __m128 l0 = _mm_loadu_ps(p);
+    const __m128 l1 = _mm_loadu_ps(p + 4);
+    const __m128 t = _mm_shuffle_ps(l0, l1, _MM_SHUFFLE(1, 0, 3, 3));
+
+    c0 = l0;
+    c1 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 2, 0));
+    c2 = _mm_shuffle_ps(l1, _mm_load_ss(p + 8), _MM_SHUFFLE(0, 0, 3, 2));
+}
+
+static inline void storeColumns (Mat3f &m, const __m128 c0, const __m128 c1, const __m128 c2) {
+    float *p = &m[0].x;
+    const __m128 u = _mm_shuffle_ps(c0, c1, _MM_SHUFFLE(0, 0, 2, 2));
+    _mm_storeu_ps(p, _mm_shuffle_ps(c0, u, _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(p + 4, _mm_shuffle_ps(c1, c2, _MM_SHUFFLE(1, 0, 2, 1)));
+    _mm_store_ss(p + 8, _mm_movehl_ps(c2, c2));
+}
+
+// Cross product of lanes x, y, z, in three shuffles rather than four.
+static inline __m128 cross3 (const __m128 a, const __m128 b) {
+    const __m128 ayzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 byzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 c = _mm_sub_ps(_mm_mul_ps(a, byzx), _mm_mul_ps(ayzx, b));
+    return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+// Dot product of lanes x, y, z, broadcast to all lanes.
+static inline __m128 dot3 (const __m128 a, const __m128 b) {
+    const __m128 p = _mm_mul_ps(a, b);
+    return _mm_add_ps(_mm_add_ps(SGE_SPLAT(p, 0), SGE_SPLAT(p, 1)), SGE_SPLAT(p, 2));
+}
+
+// Transpose the 3x3 held in lanes x, y, z of r0, r1, r2. Lane w of the
+// results is zero.
+static inline void transpose3 (const __m128 r0, const __m128 r1, const __m128 r2,
+                               __m128 &c0, __m128 &c1, __m128 &c2) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 t0 = _mm_unpacklo_ps(r0, r1);          // r0x r1x r0y r1y
+    const __m128 t1 = _mm_unpackhi_ps(r0, r1);          // r0z r1z r0w r1w
+    const __m128 t2 = _mm_unpacklo_ps(r2, zero);        // r2x 0   r2y 0
+    const __m128 t3 = _mm_unpackhi_ps(r2, zero);        // r2z 0   r2w 0
+
+    c0 = _mm_movelh_ps(t0, t2);
+    c1 = _mm_movehl_ps(t2, t0);
+    c2 = _mm_movelh_ps(t1, t3);
+}
+
+// Rows of the inverse of the 3x3 with columns c0, c1, c2, i.e. the
+// cross products of its columns over its determinant. These are also
+// the columns of its inverse transpose.
+static inline bool inverseRows (const __m128 c0, const __m128 c1, const __m128 c2,
+                                __m128 &r0, __m128 &r1, __m128 &r2) {
+    r0 = cross3(c1, c2);
+    r1 = cross3(c2, c0);
+    r2 = cross3(c0, c1);
+
+    const __m128 det = dot3(c0, r0);
+    if (0.0f == _mm_cvtss_f32(det)) {
+        return false;
+    }
+
+    const __m128 invd = _mm_div_ps(_mm_set1_ps(1.0f), det);
+    r0 = _mm_mul_ps(r0, invd);
+    r1 = _mm_mul_ps(r1, invd);
+    r2 = _mm_mul_ps(r2, invd);
+
+    return true;
+}
+
+// Given the transpose i0, i1, i2 of a 3x3 with orthogonal columns c0, c1,
+// c2, scale lane k of each by 1 / |ck|^2 to make it the inverse. Lane w
+// of the inputs must be zero.
+static inline void unscaleColumns (__m128 &i0, __m128 &i1, __m128 &i2) {
+    __m128 sq = _mm_mul_ps(i0, i0);
+    sq = simd::madd(i1, i1, sq);
+    sq = simd::madd(i2, i2, sq);
+    const __m128 inv = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(sq, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)));
+
+    i0 = _mm_mul_ps(i0, inv);
+    i1 = _mm_mul_ps(i1, inv);
+    i2 = _mm_mul_ps(i2, inv);
+}
+
+// Translation column of an affine inverse with upper 3x3 columns i0, i1,
+// i2 (lane w zero) and original translation t: (-(i * t), 1).
+static inline __m128 inverseTranslation (const __m128 i0, const __m128 i1,
+                                         const __m128 i2, const __m128 t) {
+    __m128 r = _mm_mul_ps(i0, SGE_SPLAT(t, 0));
+    r = simd::madd(i1, SGE_SPLAT(t, 1), r);
+    r = simd::madd(i2, SGE_SPLAT(t, 2), r);
+    return _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), r);
+}
+
+static inline void storeAffine (Mat4f &m, const __m128 i0, const __m128 i1,
+                                const __m128 i2, const __m128 t) {
+    _mm_storeu_ps(&m[0].x, i0);
+    _mm_storeu_ps(&m[1].x, i1);
+    _mm_storeu_ps(&m[2].x, i2);
+    _mm_storeu_ps(&m[3].x, inverseTranslation(i0, i1, i2, t));
+}
+
+// 2x2 block products for the 4x4 inverse. Each register holds a row
+// major 2x2 block (m00 m01 m10 m11); A# is the adjugate of A.
+
+// A * B
+static inline __m128 mul2 (const __m128 a, const __m128 b) {
+    return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                                 _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+// A# * B
+static inline __m128 adjMul2 (const __m128 a, const __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)),
+                                 _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+// A * B#
+static inline __m128 mulAdj2 (const __m128 a, const __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                                 _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+#endif /* SGE_SIMD_SSE */
+
 //==================================
 // MATRIX 2x2
 //==================================
 
-const Mat2f Mat2f_Zero     {0.0f};
-const Mat2f Mat2f_One      {1.0f};
-const Mat2f Mat2f_Identity {1.0f, 0.0f,
+constexpr Mat2f Mat2f_Zero     {0.0f};
+constexpr Mat2f Mat2f_One      {1.0f};
+constexpr Mat2f Mat2f_Identity {1.0f, 0.0f,
                             0.0f, 1.0f};
 
 //==================================
 // MATRIX 3x3
 //==================================
 
-const Mat3f Mat3f_Zero     {0.0f};
-const Mat3f Mat3f_One      {1.0f};
-const Mat3f Mat3f_Identity {1.0f, 0.0f, 0.0f,
+constexpr Mat3f Mat3f_Zero     {0.0f};
+constexpr Mat3f Mat3f_One      {1.0f};
+constexpr Mat3f Mat3f_Identity {1.0f, 0.0f, 0.0f,
                             0.0f, 1.0f, 0.0f,
                             0.0f, 0.0f, 1.0f};
 
-Mat3f Mat3f::inverse () const {
-    Mat3f inv = *this;
-    verify(inv.inverseSelf());
-
-    return inv;
-}
-
-bool Mat3f::inverseSelf () {
+static bool cofactorInverse (const Mat3f &m, Mat3f &out) {
     float a[9];
 
-    float det = determinant();
+    float det = m.determinant();
     if (0 == det) {
         return false;
     }
 
     // Calculate sub-determinants
-    a[0] = Mat2f(mat[1].y, mat[1].z, mat[2].y, mat[2].z).determinant();
-    a[1] = Mat2f(mat[1].x, mat[1].z, mat[2].x, mat[2].z).determinant();
-    a[2] = Mat2f(mat[1].x, mat[1].y, mat[2].x, mat[2].y).determinant();
+    a[0] = Mat2f(m[1].y, m[1].z, m[2].y, m[2].z).determinant();
+    a[1] = Mat2f(m[1].x, m[1].z, m[2].x, m[2].z).determinant();
+    a[2] = Mat2f(m[1].x, m[1].y, m[2].x, m[2].y).determinant();
 
-    a[3] = Mat2f(mat[0].y, mat[0].z, mat[2].y, mat[2].z).determinant();
-    a[4] = Mat2f(mat[0].x, mat[0].z, mat[2].x, mat[2].z).determinant();
-    a[5] = Mat2f(mat[0].x, mat[0].y, mat[2].x, mat[2].y).determinant();
+    a[3] = Mat2f(m[0].y, m[0].z, m[2].y, m[2].z).determinant();
+    a[4] = Mat2f(m[0].x, m[0].z, m[2].x, m[2].z).determinant();
+    a[5] = Mat2f(m[0].x, m[0].y, m[2].x, m[2].y).determinant();
 
-    a[6] = Mat2f(mat[0].y, mat[0].z, mat[1].y, mat[1].z).determinant();
-    a[7] = Mat2f(mat[0].x, mat[0].z, mat[1].x, mat[1].z).determinant();
-    a[8] = Mat2f(mat[0].x, mat[0].y, mat[1].x, mat[1].y).determinant();
+    a[6] = Mat2f(m[0].y, m[0].z, m[1].y, m[1].z).determinant();
+    a[7] = Mat2f(m[0].x, m[0].z, m[1].x, m[1].z).determinant();
+    a[8] = Mat2f(m[0].x, m[0].y, m[1].x, m[1].y).determinant();
 
     float invd = 1.0f / det;
-    set(a[0] * invd, -a[3] * invd, a[6] * invd,
-        -a[1] * invd, a[4] * invd, -a[7] * invd,
-        a[2] * invd, -a[5] * invd, a[8] * invd);
+    out.set(a[0] * invd, -a[3] * invd, a[6] * invd,
+            -a[1] * invd, a[4] * invd, -a[7] * invd,
+            a[2] * invd, -a[5] * invd, a[8] * invd);
+
+    return true;
+}
+
+Mat3f inverseScalar (const Mat3f &m) {
+    Mat3f inv;
+    verify(cofactorInverse(m, inv));
+
+    return inv;
+}
+
+// The rows of the inverse are the cross products of pairs of columns
+// over the determinant, which is far cheaper than nine 2x2 cofactors.
+// A SIMD version of this measured no faster: the 12 byte columns cost
+// as much to pack and unpack as the arithmetic saves. out is only
+// written on success.
+static bool fastInverse (const Mat3f &m, Mat3f &out) {
+    const Vec3f r0 = m[1].cross(m[2]);
+    const float det = m[0].dot(r0);
+    if (0 == det) {
+        return false;
+    }
+
+    const float invd = 1.0f / det;
+    const Vec3f i0 = r0 * invd;
+    const Vec3f i1 = m[2].cross(m[0]) * invd;
+    const Vec3f i2 = m[0].cross(m[1]) * invd;
+    out.set(i0.x, i1.x, i2.x,
+            i0.y, i1.y, i2.y,
+            i0.z, i1.z, i2.z);
 
     return true;
 }
 
+Mat3f Mat3f::inverse () const {
+    Mat3f inv;
+    verify(fastInverse(*this, inv));
+
+    return inv;
+}
+
+bool Mat3f::inverseSelf () {
+    return fastInverse(*this, *this);
+}
+
+Mat3f Mat3f::inverseOrthogonal () const {
+    Mat3f inv;
+#if SGE_SIMD_SSE
+    __m128 c0, c1, c2, i0, i1, i2;
+    loadColumns(*this, c0, c1, c2);
+    transpose3(c0, c1, c2, i0, i1, i2);
+    unscaleColumns(i0, i1, i2);
+    storeColumns(inv, i0, i1, i2);
+#else
+    const Vec3f s(1.0f / mat[0].magSq(), 1.0f / mat[1].magSq(), 1.0f / mat[2].magSq());
+    inv = transpose();
+    inv[0] *= s;
+    inv[1] *= s;
+    inv[2] *= s;
+#endif
+
+    return inv;
+}
+
+Mat3f Mat3f::normalMatrix () const {
+    const Vec3f r0 = mat[1].cross(mat[2]);
+    const float det = mat[0].dot(r0);
+    verify(0 != det);
+
+    const float invd = 1.0f / det;
+    return Mat3f(r0 * invd, mat[2].cross(mat[0]) * invd, mat[0].cross(mat[1]) * invd);
+}
+
 //==================================
 // MATRIX 4x4
 //==================================
 
-const Mat4f Mat4f_Zero     {0.0f};
-const Mat4f Mat4f_One      {1.0f};
-const Mat4f Mat4f_Identity {1.0f, 0.0f, 0.0f, 0.0f,
+constexpr Mat4f Mat4f_Zero     {0.0f};
+constexpr Mat4f Mat4f_One      {1.0f};
+constexpr Mat4f Mat4f_Identity {1.0f, 0.0f, 0.0f, 0.0f,
                             0.0f, 1.0f, 0.0f, 0.0f,
                             0.0f, 0.0f, 1.0f, 0.0f,
                             0.0f, 0.0f, 0.0f, 1.0f};
 
-Mat4f Mat4f::inverse () const {
-    Mat4f inv = *this;
-    verify(inv.inverseSelf());
-
-    return inv;
-}
-
-bool Mat4f::inverseSelf () {
+static bool cofactorInverse (const Mat4f &m, Mat4f &out) {
     float a[16];
 
-    float det = determinant();
+    float det = m.determinant();
     if (0.0f == det) {
         return false;
     }
 
     // Calculate sub-determinants
-    a[0]  = Mat3f(mat[1].y, mat[1].z, mat[1].w, mat[2].y, mat[2].z, mat[2].w,
-                  mat[3].y, mat[3].z, mat[3].w).determinant();
-    a[1]  = Mat3f(mat[1].x, mat[1].z, mat[1].w, mat[2].x, mat[2].z, mat[2].w,
-                  mat[3].x, mat[3].z, mat[3].w).determinant();
-    a[2]  = Mat3f(mat[1].x, mat[1].y, mat[1].w, mat[2].x, mat[2].y, mat[2].w,
-                  mat[3].x, mat[3].y, mat[3].w).determinant();
-    a[3]  = Mat3f(mat[1].x, mat[1].y, mat[1].z, mat[2].x, mat[2].y, mat[2].z,
-                  mat[3].x, mat[3].y, mat[3].z).determinant();
-
-    a[4]  = Mat3f(mat[0].y, mat[0].z, mat[0].w, mat[2].y, mat[2].z, mat[2].w,
-                  mat[3].y, mat[3].z, mat[3].w).determinant();
-    a[5]  = Mat3f(mat[0].x, mat[0].z, mat[0].w, mat[2].x, mat[2].z, mat[2].w,
-                  mat[3].x, mat[3].z, mat[3].w).determinant();
-    a[6]  = Mat3f(mat[0].x, mat[0].y, mat[0].w, mat[2].x, mat[2].y, mat[2].w,
-                  mat[3].x, mat[3].y, mat[3].w).determinant();
-    a[7]  = Mat3f(mat[0].x, mat[0].y, mat[0].z, mat[2].x, mat[2].y, mat[2].z,
-                  mat[3].x, mat[3].y, mat[3].z).determinant();
-
-    a[8]  = Mat3f(mat[0].y, mat[0].z, mat[0].w, mat[1].y, mat[1].z, mat[1].w,
-                  mat[3].y, mat[3].z, mat[3].w).determinant();
-    a[9]  = Mat3f(mat[0].x, mat[0].z, mat[0].w, mat[1].x, mat[1].z, mat[1].w,
-                  mat[3].x, mat[3].z, mat[3].w).determinant();
-    a[10] = Mat3f(mat[0].x, mat[0].y, mat[0].w, mat[1].x, mat[1].y, mat[1].w,
-                  mat[3].x, mat[3].y, mat[3].w).determinant();
-    a[11] = Mat3f(mat[0].x, mat[0].y, mat[0].z, mat[1].x, mat[1].y, mat[1].z,
-                  mat[3].x, mat[3].y, mat[3].z).determinant();
-
-    a[12] = Mat3f(mat[0].y, mat[0].z, mat[0].w, mat[1].y, mat[1].z, mat[1].w,
-                  mat[2].y, mat[2].z, mat[2].w).determinant();
-    a[13] = Mat3f(mat[0].x, mat[0].z, mat[0].w, mat[1].x, mat[1].z, mat[1].w,
-                  mat[2].x, mat[2].z, mat[2].w).determinant();
-    a[14] = Mat3f(mat[0].x, mat[0].y, mat[0].w, mat[1].x, mat[1].y, mat[1].w,
-                  mat[2].x, mat[2].y, mat[2].w).determinant();
-    a[15] = Mat3f(mat[0].x, mat[0].y, mat[0].z, mat[1].x, mat[1].y, mat[1].z,
-                  mat[2].x, mat[2].y, mat[2].z).determinant();
+    a[0]  = Mat3f(m[1].y, m[1].z, m[1].w, m[2].y, m[2].z, m[2].w,
+                  m[3].y, m[3].z, m[3].w).determinant();
+    a[1]  = Mat3f(m[1].x, m[1].z, m[1].w, m[2].x, m[2].z, m[2].w,
+                  m[3].x, m[3].z, m[3].w).determinant();
+    a[2]  = Mat3f(m[1].x, m[1].y, m[1].w, m[2].x, m[2].y, m[2].w,
+                  m[3].x, m[3].y, m[3].w).determinant();
+    a[3]  = Mat3f(m[1].x, m[1].y, m[1].z, m[2].x, m[2].y, m[2].z,
+                  m[3].x, m[3].y, m[3].z).determinant();
+
+    a[4]  = Mat3f(m[0].y, m[0].z, m[0].w, m[2].y, m[2].z, m[2].w,
+                  m[3].y, m[3].z, m[3].w).determinant();
+    a[5]  = Mat3f(m[0].x, m[0].z, m[0].w, m[2].x, m[2].z, m[2].w,
+                  m[3].x, m[3].z, m[3].w).determinant();
+    a[6]  = Mat3f(m[0].x, m[0].y, m[0].w, m[2].x, m[2].y, m[2].w,
+                  m[3].x, m[3].y, m[3].w).determinant();
+    a[7]  = Mat3f(m[0].x, m[0].y, m[0].z, m[2].x, m[2].y, m[2].z,
+                  m[3].x, m[3].y, m[3].z).determinant();
+
+    a[8]  = Mat3f(m[0].y, m[0].z, m[0].w, m[1].y, m[1].z, m[1].w,
+                  m[3].y, m[3].z, m[3].w).determinant();
+    a[9]  = Mat3f(m[0].x, m[0].z, m[0].w, m[1].x, m[1].z, m[1].w,
+                  m[3].x, m[3].z, m[3].w).determinant();
+    a[10] = Mat3f(m[0].x, m[0].y, m[0].w, m[1].x, m[1].y, m[1].w,
+                  m[3].x, m[3].y, m[3].w).determinant();
+    a[11] = Mat3f(m[0].x, m[0].y, m[0].z, m[1].x, m[1].y, m[1].z,
+                  m[3].x, m[3].y, m[3].z).determinant();
+
+    a[12] = Mat3f(m[0].y, m[0].z, m[0].w, m[1].y, m[1].z, m[1].w,
+                  m[2].y, m[2].z, m[2].w).determinant();
+    a[13] = Mat3f(m[0].x, m[0].z, m[0].w, m[1].x, m[1].z, m[1].w,
+                  m[2].x, m[2].z, m[2].w).determinant();
+    a[14] = Mat3f(m[0].x, m[0].y, m[0].w, m[1].x, m[1].y, m[1].w,
+                  m[2].x, m[2].y, m[2].w).determinant();
+    a[15] = Mat3f(m[0].x, m[0].y, m[0].z, m[1].x, m[1].y, m[1].z,
+                  m[2].x, m[2].y, m[2].z).determinant();
 
     float invd = 1.0f / det;
-    set(a[0] * invd, -a[4] * invd, a[8] * invd, -a[12] * invd,
-        -a[1] * invd, a[5] * invd, -a[9] * invd, a[13] * invd,
-        a[2] * invd, -a[6] * invd, a[10] * invd, -a[14] * invd,
-        -a[3] * invd, a[7] * invd, -a[11] * invd, a[15] * invd);
+    out.set(a[0] * invd, -a[4] * invd, a[8] * invd, -a[12] * invd,
+            -a[1] * invd, a[5] * invd, -a[9] * invd, a[13] * invd,
+            a[2] * invd, -a[6] * invd, a[10] * invd, -a[14] * invd,
+            -a[3] * invd, a[7] * invd, -a[11] * invd, a[15] * invd);
+
+    return true;
+}
+
+Mat4f inverseScalar (const Mat4f &m) {
+    Mat4f inv;
+    verify(cofactorInverse(m, inv));
+
+    return inv;
+}
+
+#if !SGE_SIMD_SSE
+
+// Affine inverse from the already inverted upper 3x3 columns i0, i1, i2
+// and the original translation t.
+static Mat4f affineInverse (const Vec3f &i0, const Vec3f &i1, const Vec3f &i2,
+                            const Vec3f &t) {
+    const Vec3f it = -(i0 * t.x + i1 * t.y + i2 * t.z);
+
+    return Mat4f(i0.x, i0.y, i0.z, 0.0f,
+                 i1.x, i1.y, i1.z, 0.0f,
+                 i2.x, i2.y, i2.z, 0.0f,
+                 it.x, it.y, it.z, 1.0f);
+}
+
+#endif /* !SGE_SIMD_SSE */
+
+// Block inverse: partition into 2x2 blocks A B / C D and invert via
+// their adjugates, which shares most of the work between the sixteen
+// cofactors. Feeding columns in as rows inverts the transpose, whose
+// rows are then the columns of the inverse, so no reordering is needed.
+// out is only written on success.
+static bool fastInverse (const Mat4f &m, Mat4f &out) {
+#if SGE_SIMD_SSE
+    const __m128 m0 = _mm_loadu_ps(&m[0].x);
+    const __m128 m1 = _mm_loadu_ps(&m[1].x);
+    const __m128 m2 = _mm_loadu_ps(&m[2].x);
+    const __m128 m3 = _mm_loadu_ps(&m[3].x);
+
+    const __m128 a = _mm_movelh_ps(m0, m1);
+    const __m128 b = _mm_movehl_ps(m1, m0);
+    const __m128 c = _mm_movelh_ps(m2, m3);
+    const __m128 d = _mm_movehl_ps(m3, m2);
+
+    // |A| |B| |C| |D|
+    const __m128 detSub = _mm_sub_ps(
+          _mm_mul_ps(_mm_shuffle_ps(m0, m2, _MM_SHUFFLE(2, 0, 2, 0)),
+                     _mm_shuffle_ps(m1, m3, _MM_SHUFFLE(3, 1, 3, 1))),
+          _mm_mul_ps(_mm_shuffle_ps(m0, m2, _MM_SHUFFLE(3, 1, 3, 1)),
+                     _mm_shuffle_ps(m1, m3, _MM_SHUFFLE(2, 0, 2, 0))));
+    const __m128 detA = SGE_SPLAT(detSub, 0);
+    const __m128 detB = SGE_SPLAT(detSub, 1);
+    const __m128 detC = SGE_SPLAT(detSub, 2);
+    const __m128 detD = SGE_SPLAT(detSub, 3);
+
+    const __m128 dc = adjMul2(d, c);
+    const __m128 ab = adjMul2(a, b);
+
+    // Adjugates of the blocks of the inverse, scaled by |M|.
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), mul2(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), mul2(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), mulAdj2(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), mulAdj2(a, dc));
+
+    // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+    __m128 tr = _mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 1, 2, 0)));
+    tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2)));
+    tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(2, 3, 0, 1)));
+    const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+    if (0.0f == _mm_cvtss_f32(det)) {
+        return false;
+    }
+
+    // Signs of the 2x2 adjugate, applied with 1 / |M|.
+    const __m128 invd = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+    x = _mm_mul_ps(x, invd);
+    y = _mm_mul_ps(y, invd);
+    z = _mm_mul_ps(z, invd);
+    w = _mm_mul_ps(w, invd);
+
+    // Take the adjugates and reassemble the blocks in one shuffle each.
+    _mm_storeu_ps(&out[0].x, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(&out[1].x, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(&out[2].x, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(&out[3].x, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
 
     return true;
+#else
+    return cofactorInverse(m, out);
+#endif
+}
+
+Mat4f Mat4f::inverse () const {
+    Mat4f inv;
+    verify(fastInverse(*this, inv));
+
+    return inv;
+}
+
+bool Mat4f::inverseSelf () {
+    return fastInverse(*this, *this);
+}
+
+Mat4f Mat4f::inverseAffine () const {
+#if SGE_SIMD_SSE
+    Mat4f inv;
+    __m128 r0, r1, r2, i0, i1, i2;
+    verify(inverseRows(_mm_loadu_ps(&mat[0].x), _mm_loadu_ps(&mat[1].x),
+                       _mm_loadu_ps(&mat[2].x), r0, r1, r2));
+    transpose3(r0, r1, r2, i0, i1, i2);
+    storeAffine(inv, i0, i1, i2, _mm_loadu_ps(&mat[3].x));
+
+    return inv;
+#else
+    const Mat3f inv = Mat3f(mat[0].xyz(), mat[1].xyz(), mat[2].xyz()).inverse();
+
+    return affineInverse(inv[0], inv[1], inv[2], mat[3].xyz());
+#endif
+}
+
+Mat4f Mat4f::inverseOrthogonal () const {
+#if SGE_SIMD_SSE
+    Mat4f inv;
+    __m128 i0, i1, i2;
+    transpose3(_mm_loadu_ps(&mat[0].x), _mm_loadu_ps(&mat[1].x),
+               _mm_loadu_ps(&mat[2].x), i0, i1, i2);
+    unscaleColumns(i0, i1, i2);
+    storeAffine(inv, i0, i1, i2, _mm_loadu_ps(&mat[3].x));
+
+    return inv;
+#else
+    const Mat3f inv = Mat3f(mat[0].xyz(), mat[1].xyz(), mat[2].xyz()).inverseOrthogonal();
+
+    return affineInverse(inv[0], inv[1], inv[2], mat[3].xyz());
+#endif
+}
+
+Mat4f Mat4f::inverseRigid () const {
+#if SGE_SIMD_SSE
+    Mat4f inv;
+    __m128 i0, i1, i2;
+    transpose3(_mm_loadu_ps(&mat[0].x), _mm_loadu_ps(&mat[1].x),
+               _mm_loadu_ps(&mat[2].x), i0, i1, i2);
+    storeAffine(inv, i0, i1, i2, _mm_loadu_ps(&mat[3].x));
+
+    return inv;
+#else
+    return affineInverse(Vec3f(mat[0].x, mat[1].x, mat[2].x),
+                         Vec3f(mat[0].y, mat[1].y, mat[2].y),
+                         Vec3f(mat[0].z, mat[1].z, mat[2].z),
+                         mat[3].xyz());
+#endif
+}
+
+Mat3f Mat4f::normalMatrix () const {
+#if SGE_SIMD_SSE
+    Mat3f n;
+    __m128 r0, r1, r2;
+    verify(inverseRows(_mm_loadu_ps(&mat[0].x), _mm_loadu_ps(&mat[1].x),
+                       _mm_loadu_ps(&mat[2].x), r0, r1, r2));
+    storeColumns(n, r0, r1, r2);
+
+    return n;
+#else
+    return Mat3f(mat[0].xyz(), mat[1].xyz(), mat[2].xyz()).normalMatrix();
+#endif
 }
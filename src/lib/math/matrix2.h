@@ -29,17 +29,17 @@
 class Mat2f {
 public:
     /** Construct a default (All 0.0f) Mat2f. */
-    Mat2f () : mat{Vec2f{0, 0}, Vec2f{0, 0}} { }
+    constexpr Mat2f () : mat{Vec2f{0, 0}, Vec2f{0, 0}} { }
 
     /** Fill Constructor */
-    explicit Mat2f (const float f)
+    explicit constexpr Mat2f (const float f)
           : mat{Vec2f{f, f}, Vec2f{f, f}} { }
 
     /** Construct a Mat2f with float values. */
-    explicit Mat2f (const float aa, const float ab, const float ba, const float bb);
+    explicit constexpr Mat2f (const float aa, const float ab, const float ba, const float bb);
 
     /** Construct a Mat2f using Vec2f columns. */
-    explicit Mat2f (const Vec2f &col1, const Vec2f &col2);
+    explicit constexpr Mat2f (const Vec2f &col1, const Vec2f &col2);
 
     /** 1D Array Constructor */
     explicit Mat2f (const float data[4]);
@@ -50,30 +50,30 @@ public:
     /**
      * Read access to the matrix columns using subscript notation.
      */
-    const Vec2f& operator[] (const std::size_t index) const { return mat[index]; }
+    constexpr const Vec2f& operator[] (const std::size_t index) const { return mat[index]; }
 
     /**
      * Reference/Write access to the matrix columns using subscript notation.
      */
-    Vec2f& operator[] (const std::size_t index) { return mat[index]; }
+    constexpr Vec2f& operator[] (const std::size_t index) { return mat[index]; }
 
     /**
      * Write the data from the columns of this Mat2f into
      * Vec2fs.
      */
-    void columns (Vec2f &col1, Vec2f &col2) const;
+    constexpr void columns (Vec2f &col1, Vec2f &col2) const;
 
     /**
      * Set the values of this Mat2f using Ts.
      * Destructive.
      */
-    void set (const float aa, const float ab, const float ba, const float bb);
+    constexpr void set (const float aa, const float ab, const float ba, const float bb);
 
     /**
      * Set the values of this Mat2f using Vec2f columns.
      * Destructive.
      */
-    void set (const Vec2f &col1, const Vec2f &col2);
+    constexpr void set (const Vec2f &col1, const Vec2f &col2);
 
     /**
      * Set the values of this Mat2f using a 1D array.
@@ -91,7 +91,7 @@ public:
      * Set all the values of this Mat2f to 0.0f.
      * Destructive.
      */
-    void zero ();
+    constexpr void zero ();
 
     /**
      * Return true if this Mat2f is the identity Matrix.
@@ -102,17 +102,17 @@ public:
     /**
      * Get the determinant of this Mat2f
      */
-    float determinant () const;
+    constexpr float determinant () const;
 
     /**
      * Determine whether this Mat2f has an inverse.
      */
-    bool hasInverse () const;
+    constexpr bool hasInverse () const;
 
     /**
      * Mirror the cells of this Matrix about the line x==y.
      */
-    Mat2f transpose () const;
+    constexpr Mat2f transpose () const;
 
     /**
      * Mirror the cells of this Matrix about the line x==y in place.
@@ -123,7 +123,7 @@ public:
     /**
      * Test if this Mat2f is equivalent to another Mat2f.
      */
-    bool compare (const Mat2f &other) const;
+    constexpr bool compare (const Mat2f &other) const;
 
     /**
      * Test if this Mat2f is similar to another Mat2f
@@ -142,16 +142,12 @@ extern const Mat2f Mat2f_Identity;
 
 // --------------------------------------------------------------------------
 
-inline Mat2f::Mat2f (const float aa, const float ab,
-                     const float ba, const float bb) {
-    mat[0].x = aa; mat[0].y = ab;
-    mat[1].x = ba; mat[1].y = bb;
-}
+inline constexpr Mat2f::Mat2f (const float aa, const float ab,
+                               const float ba, const float bb)
+      : mat{Vec2f{aa, ab}, Vec2f{ba, bb}} { }
 
-inline Mat2f::Mat2f (const Vec2f &col1, const Vec2f &col2) {
-    mat[0].x = col1.x; mat[0].y = col1.y;
-    mat[1].x = col2.x; mat[1].y = col2.y;
-}
+inline constexpr Mat2f::Mat2f (const Vec2f &col1, const Vec2f &col2)
+      : mat{col1, col2} { }
 
 inline Mat2f::Mat2f (const float data[4]) {
     std::memcpy(mat, data, 4 * sizeof(float));
@@ -161,18 +157,18 @@ inline Mat2f::Mat2f (const float data[2][2]) {
     std::memcpy(mat, data, 2 * 2 * sizeof(float));
 }
 
-inline void Mat2f::columns (Vec2f &col1, Vec2f &col2) const {
+inline constexpr void Mat2f::columns (Vec2f &col1, Vec2f &col2) const {
     col1 = mat[0];
     col2 = mat[1];
 }
 
-inline void Mat2f::set (const float aa, const float ab,
-                        const float ba, const float bb) {
+inline constexpr void Mat2f::set (const float aa, const float ab,
+                                  const float ba, const float bb) {
     mat[0].x = aa; mat[0].y = ab;
     mat[1].x = ba; mat[1].y = bb;
 }
 
-inline void Mat2f::set (const Vec2f &col1, const Vec2f &col2) {
+inline constexpr void Mat2f::set (const Vec2f &col1, const Vec2f &col2) {
     mat[0] = col1;
     mat[1] = col2;
 }
@@ -185,7 +181,7 @@ inline void Mat2f::set (const float **data) {
     std::memcpy(mat, data, 2 * 2 * sizeof(float));
 }
 
-inline void Mat2f::zero () {
+inline constexpr void Mat2f::zero () {
     mat[0].zero();
     mat[1].zero();
 }
@@ -198,15 +194,19 @@ inline bool Mat2f::isIdentity () const {
 // Mat2f Operators
 //=======================
 
-inline Mat2f operator* (const Mat2f &m, const float a) {
+inline constexpr Mat2f operator* (const Mat2f &m, const float a) {
     return Mat2f(m[0] * a, m[1] * a);
 }
 
-inline Mat2f operator* (const float a, const Mat2f &m) {
+inline constexpr Mat2f operator* (const float a, const Mat2f &m) {
     return Mat2f(m[0] * a, m[1] * a);
 }
 
-inline Mat2f operator* (const Mat2f &a, const Mat2f &b) {
+/**
+ * Reference scalar Mat2f product. The SIMD backends reproduce this result
+ * and it is used directly when no backend is available.
+ */
+inline constexpr Mat2f mulScalar (const Mat2f &a, const Mat2f &b) {
     return Mat2f(a[0].x * b[0].x + a[0].y * b[1].x,
                  a[0].x * b[0].y + a[0].y * b[1].y,
 
@@ -214,15 +214,45 @@ inline Mat2f operator* (const Mat2f &a, const Mat2f &b) {
                  a[1].x * b[0].y + a[1].y * b[1].y);
 }
 
-inline Mat2f operator+ (const Mat2f &a, const Mat2f &b) {
+// The whole matrix fits in one register: result[i] = a[i].x * b[0] + a[i].y * b[1].
+inline Mat2f operator* (const Mat2f &a, const Mat2f &b) {
+#if SGE_SIMD_SSE
+    Mat2f result;
+    const __m128 va = _mm_loadu_ps(&a[0].x);
+    const __m128 vb = _mm_loadu_ps(&b[0].x);
+
+    __m128 r = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(2, 2, 0, 0)), _mm_movelh_ps(vb, vb));
+    r = simd::madd(_mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 3, 1, 1)), _mm_movehl_ps(vb, vb), r);
+    _mm_storeu_ps(&result[0].x, r);
+
+    return result;
+#elif SGE_SIMD_NEON
+    Mat2f result;
+    const float32x4_t va = vld1q_f32(&a[0].x);
+    const float32x4_t vb = vld1q_f32(&b[0].x);
+    const float32x4x2_t axy = vtrnq_f32(va, va); // {a0x a0x a1x a1x}, {a0y a0y a1y a1y}
+    const float32x2_t b0 = vget_low_f32(vb);
+    const float32x2_t b1 = vget_high_f32(vb);
+
+    float32x4_t r = vmulq_f32(axy.val[0], vcombine_f32(b0, b0));
+    r = vmlaq_f32(r, axy.val[1], vcombine_f32(b1, b1));
+    vst1q_f32(&result[0].x, r);
+
+    return result;
+#else
+    return mulScalar(a, b);
+#endif
+}
+
+inline constexpr Mat2f operator+ (const Mat2f &a, const Mat2f &b) {
     return Mat2f(a[0] + b[0], a[1] + b[1]);
 }
 
-inline Mat2f operator- (const Mat2f &a, const Mat2f &b) {
+inline constexpr Mat2f operator- (const Mat2f &a, const Mat2f &b) {
     return Mat2f(a[0] - b[0], a[1] - b[1]);
 }
 
-inline Mat2f& operator*= (Mat2f &m, const float a) {
+inline constexpr Mat2f& operator*= (Mat2f &m, const float a) {
     m[0] *= a;
     m[1] *= a;
 
@@ -230,27 +260,19 @@ inline Mat2f& operator*= (Mat2f &m, const float a) {
 }
 
 inline Mat2f& operator*= (Mat2f &a, const Mat2f &b) {
-    float tmp[4];
-
-    tmp[0] = a[0].x * b[0].x + a[0].y * b[1].x;
-    tmp[1] = a[0].x * b[0].y + a[0].y * b[1].y;
-    tmp[2] = a[1].x * b[0].x + a[1].y * b[1].x;
-    tmp[3] = a[1].x * b[0].y + a[1].y * b[1].y;
-
-    a[0].x = tmp[0]; a[0].y = tmp[1];
-    a[1].x = tmp[2]; a[1].y = tmp[3];
+    a = a * b;
 
     return a;
 }
 
-inline Mat2f& operator+= (Mat2f &a, const Mat2f &b) {
+inline constexpr Mat2f& operator+= (Mat2f &a, const Mat2f &b) {
     a[0] += b[0];
     a[1] += b[1];
 
     return a;
 }
 
-inline Mat2f& operator-= (Mat2f &a, const Mat2f &b) {
+inline constexpr Mat2f& operator-= (Mat2f &a, const Mat2f &b) {
     a[0] -= b[0];
     a[1] -= b[1];
 
@@ -259,15 +281,15 @@ inline Mat2f& operator-= (Mat2f &a, const Mat2f &b) {
 
 // --------------------------------------------------------------------------
 
-inline float Mat2f::determinant () const {
+inline constexpr float Mat2f::determinant () const {
     return mat[0].x * mat[1].y - mat[0].y * mat[1].x;
 }
 
-inline bool Mat2f::hasInverse () const {
+inline constexpr bool Mat2f::hasInverse () const {
     return 0 != determinant();
 }
 
-inline Mat2f Mat2f::transpose () const {
+inline constexpr Mat2f Mat2f::transpose () const {
     return Mat2f(mat[0].x, mat[1].x, mat[0].y, mat[1].y);
 }
 
@@ -281,7 +303,7 @@ inline Mat2f& Mat2f::transposeSelf () {
 // Mat2f Comparisons
 //=======================
 
-inline bool Mat2f::compare (const Mat2f &other) const {
+inline constexpr bool Mat2f::compare (const Mat2f &other) const {
     return mat[0] == other.mat[0] && mat[1] == other.mat[1];
 }
 
@@ -290,11 +312,11 @@ inline bool Mat2f::compare (const Mat2f &other, const float threshold) const {
            mat[1].compare(other.mat[1], threshold);
 }
 
-inline bool operator== (const Mat2f &a, const Mat2f &b) {
+inline constexpr bool operator== (const Mat2f &a, const Mat2f &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Mat2f &a, const Mat2f &b) {
+inline constexpr bool operator!= (const Mat2f &a, const Mat2f &b) {
     return !a.compare(b);
 }
 
@@ -30,19 +30,19 @@
 class Mat3f {
 public:
     /** Default Constructor */
-    Mat3f () : mat{Vec3f{0, 0, 0}, Vec3f{0, 0, 0}, Vec3f{0, 0, 0}} { }
+    constexpr Mat3f () : mat{Vec3f{0, 0, 0}, Vec3f{0, 0, 0}, Vec3f{0, 0, 0}} { }
 
     /** Fill Constructor */
-    explicit Mat3f (const float f)
+    explicit constexpr Mat3f (const float f)
           : mat{Vec3f{f, f, f}, Vec3f{f, f, f}, Vec3f{f, f, f}} { }
 
     /** Value Constructor */
-    explicit Mat3f (const float aa, const float ab, const float ac,
-                    const float ba, const float bb, const float bc,
-                    const float ca, const float cb, const float cc);
+    explicit constexpr Mat3f (const float aa, const float ab, const float ac,
+                              const float ba, const float bb, const float bc,
+                              const float ca, const float cb, const float cc);
 
     /** Vec3f Column Constructor */
-    explicit Mat3f (const Vec3f &col1, const Vec3f &col2, const Vec3f &col3);
+    explicit constexpr Mat3f (const Vec3f &col1, const Vec3f &col2, const Vec3f &col3);
 
     /** 1D Array Constructor */
     explicit Mat3f (const float data[9]);
@@ -54,21 +54,21 @@ public:
      * Set all values of this Mat3f to zero.
      * Destructive.
      */
-    void zero ();
+    constexpr void zero ();
 
     /**
      * Set the values of this Mat3f using Ts.
      * Destructive.
      */
-    void set (const float aa, const float ab, const float ac,
-              const float ba, const float bb, const float bc,
-              const float ca, const float cb, const float cc);
+    constexpr void set (const float aa, const float ab, const float ac,
+                        const float ba, const float bb, const float bc,
+                        const float ca, const float cb, const float cc);
 
     /**
      * Set the values of this Mat3f using Vec3f columns.
      * Destructive.
      */
-    void set (const Vec3f &col1, const Vec3f &col2, const Vec3f &col3);
+    constexpr void set (const Vec3f &col1, const Vec3f &col2, const Vec3f &col3);
 
     /**
      * Set the values of this Mat3f using a 1D array.
@@ -84,19 +84,19 @@ public:
 
     bool isIdentity () const;
 
-    const Vec3f& operator[] (const std::size_t index) const { return mat[index]; }
+    constexpr const Vec3f& operator[] (const std::size_t index) const { return mat[index]; }
 
-    Vec3f& operator[] (const std::size_t index) { return mat[index]; }
+    constexpr Vec3f& operator[] (const std::size_t index) { return mat[index]; }
 
     /**
      * Get the determinant of this Mat3f.
      */
-    float determinant () const;
+    constexpr float determinant () const;
 
     /**
      * Determine if this Mat3f has an inverse.
      */
-    bool hasInverse () const;
+    constexpr bool hasInverse () const;
 
     /**
      * Get the inverse of this Mat3f.
@@ -110,14 +110,27 @@ public:
      */
     bool inverseSelf ();
 
-    Mat3f transpose () const;
+    /**
+     * Get the inverse of this Mat3f, assuming its columns are orthogonal,
+     * e.g. a rotation combined with a per-axis scale. Cheaper than
+     * inverse(). Pure rotations can use transpose() instead.
+     */
+    Mat3f inverseOrthogonal () const;
+
+    /**
+     * Get the inverse transpose of this Mat3f, which transforms normals
+     * consistently with the surfaces transformed by this Mat3f.
+     */
+    Mat3f normalMatrix () const;
+
+    constexpr Mat3f transpose () const;
 
     Mat3f& transposeSelf ();
 
     /**
      * Test if this Mat3f is equivalent to another Mat3f.
      */
-    bool compare (const Mat3f &other) const;
+    constexpr bool compare (const Mat3f &other) const;
 
     /**
      * Test if this Mat3f is similar to another Mat3f
@@ -135,19 +148,13 @@ extern const Mat3f Mat3f_Identity;
 
 // --------------------------------------------------------------------------
 
-inline Mat3f::Mat3f (const float aa, const float ab, const float ac,
-                     const float ba, const float bb, const float bc,
-                     const float ca, const float cb, const float cc) {
-    mat[0].x = aa; mat[0].y = ab; mat[0].z = ac;
-    mat[1].x = ba; mat[1].y = bb; mat[1].z = bc;
-    mat[2].x = ca; mat[2].y = cb; mat[2].z = cc;
-}
+inline constexpr Mat3f::Mat3f (const float aa, const float ab, const float ac,
+                               const float ba, const float bb, const float bc,
+                               const float ca, const float cb, const float cc)
+      : mat{Vec3f{aa, ab, ac}, Vec3f{ba, bb, bc}, Vec3f{ca, cb, cc}} { }
 
-inline Mat3f::Mat3f (const Vec3f &col1, const Vec3f &col2, const Vec3f &col3) {
-    mat[0].x = col1.x; mat[0].y = col1.y; mat[0].z = col1.z;
-    mat[1].x = col2.x; mat[1].y = col2.y; mat[1].z = col2.z;
-    mat[2].x = col3.x; mat[2].y = col3.y; mat[2].z = col3.z;
-}
+inline constexpr Mat3f::Mat3f (const Vec3f &col1, const Vec3f &col2, const Vec3f &col3)
+      : mat{col1, col2, col3} { }
 
 inline Mat3f::Mat3f (const float data[9]) {
     std::memcpy(mat, data, 9 * sizeof(float));
@@ -157,21 +164,21 @@ inline Mat3f::Mat3f (const float data[3][3]) {
     std::memcpy(mat, data, 3 * 3 * sizeof(float));
 }
 
-inline void Mat3f::zero () {
+inline constexpr void Mat3f::zero () {
     mat[0].zero();
     mat[1].zero();
     mat[2].zero();
 }
 
-inline void Mat3f::set (const float aa, const float ab, const float ac,
-                        const float ba, const float bb, const float bc,
-                        const float ca, const float cb, const float cc) {
+inline constexpr void Mat3f::set (const float aa, const float ab, const float ac,
+                                  const float ba, const float bb, const float bc,
+                                  const float ca, const float cb, const float cc) {
     mat[0].x = aa; mat[0].y = ab; mat[0].z = ac;
     mat[1].x = ba; mat[1].y = bb; mat[1].z = bc;
     mat[2].x = ca; mat[2].y = cb; mat[2].z = cc;
 }
 
-inline void Mat3f::set (const Vec3f &col1, const Vec3f &col2, const Vec3f &col3) {
+inline constexpr void Mat3f::set (const Vec3f &col1, const Vec3f &col2, const Vec3f &col3) {
     mat[0] = col1;
     mat[1] = col2;
     mat[2] = col3;
@@ -193,15 +200,19 @@ inline bool Mat3f::isIdentity () const {
 // Mat3f Operations
 //=======================
 
-inline Mat3f operator* (const Mat3f &m, const float a) {
+inline constexpr Mat3f operator* (const Mat3f &m, const float a) {
     return Mat3f(m[0] * a, m[1] * a, m[2] * a);
 }
 
-inline Mat3f operator* (const float a, const Mat3f &rhs) {
+inline constexpr Mat3f operator* (const float a, const Mat3f &rhs) {
     return rhs * a;
 }
 
-inline Mat3f operator* (const Mat3f &a, const Mat3f &b) {
+/**
+ * Reference scalar Mat3f product. The SIMD backends reproduce this result
+ * and it is used directly when no backend is available.
+ */
+inline constexpr Mat3f mulScalar (const Mat3f &a, const Mat3f &b) {
     Mat3f tmp = a.transpose();
 
     return Mat3f(tmp[0].dot(b[0]), tmp[1].dot(b[0]), tmp[2].dot(b[0]),
@@ -209,25 +220,80 @@ inline Mat3f operator* (const Mat3f &a, const Mat3f &b) {
                  tmp[0].dot(b[2]), tmp[1].dot(b[2]), tmp[2].dot(b[2]));
 }
 
-inline Vec3f operator* (const Mat3f &m, const Vec3f &v) {
+/**
+ * Reference scalar Mat3f inverse, by cofactor expansion. Verifies that
+ * the inverse exists.
+ */
+Mat3f inverseScalar (const Mat3f &m);
+
+// Columns are 12 bytes apart, so the nine floats are moved as two full
+// registers plus one lane and repacked into columns in registers. This
+// avoids partial loads/stores which would stall store forwarding.
+inline Mat3f operator* (const Mat3f &a, const Mat3f &b) {
+#if SGE_SIMD_SSE
+    Mat3f result;
+    const float *pa = &a[0].x;
+    const __m128 l0 = _mm_loadu_ps(pa);                 // a0x a0y a0z a1x
+    const __m128 l1 = _mm_loadu_ps(pa + 4);             // a1y a1z a2x a2y
+    const __m128 l2 = _mm_load_ss(pa + 8);              // a2z
+    const __m128 t = _mm_shuffle_ps(l0, l1, _MM_SHUFFLE(1, 0, 3, 3));
+
+    const __m128 a0 = l0;
+    const __m128 a1 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 2, 0));
+    const __m128 a2 = _mm_shuffle_ps(l1, l2, _MM_SHUFFLE(0, 0, 3, 2));
+
+    __m128 r[3];
+    for (int c = 0; c < 3; ++c) {
+        r[c] = _mm_mul_ps(a0, _mm_set1_ps(b[c].x));
+        r[c] = simd::madd(a1, _mm_set1_ps(b[c].y), r[c]);
+        r[c] = simd::madd(a2, _mm_set1_ps(b[c].z), r[c]);
+    }
+
+    float *pr = &result[0].x;
+    const __m128 u = _mm_shuffle_ps(r[0], r[1], _MM_SHUFFLE(0, 0, 2, 2));
+    _mm_storeu_ps(pr, _mm_shuffle_ps(r[0], u, _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(pr + 4, _mm_shuffle_ps(r[1], r[2], _MM_SHUFFLE(1, 0, 2, 1)));
+    _mm_store_ss(pr + 8, _mm_movehl_ps(r[2], r[2]));
+
+    return result;
+#elif SGE_SIMD_NEON
+    Mat3f result;
+    const float32x4_t a0 = simd::load3(&a[0].x);
+    const float32x4_t a1 = simd::load3(&a[1].x);
+    const float32x4_t a2 = simd::load3(&a[2].x);
+
+    for (int c = 0; c < 3; ++c) {
+        float32x4_t r = vmulq_n_f32(a0, b[c].x);
+        r = vmlaq_n_f32(r, a1, b[c].y);
+        r = vmlaq_n_f32(r, a2, b[c].z);
+        simd::store3(&result[c].x, r);
+    }
+
+    return result;
+#else
+    return mulScalar(a, b);
+#endif
+}
+
+inline constexpr Vec3f operator* (const Mat3f &m, const Vec3f &v) {
     return Vec3f(m[0].x * v.x + m[1].x * v.y + m[2].x * v.z,
                  m[0].y * v.x + m[1].y * v.y + m[2].y * v.z,
                  m[0].z * v.x + m[1].z * v.y + m[2].z * v.z);
 }
 
-inline Vec3f operator* (const Vec3f &lhs, const Mat3f &rhs) {
+inline constexpr Vec3f operator* (const Vec3f &lhs, const Mat3f &rhs) {
     return rhs * lhs;
 }
 
-inline Mat3f operator+ (const Mat3f &a, const Mat3f &b) {
+inline constexpr Mat3f operator+ (const Mat3f &a, const Mat3f &b) {
     return Mat3f(a[0] + b[0], a[1] + b[1], a[2] + b[2]);
 }
 
-inline Mat3f operator- (const Mat3f &a, const Mat3f &b) {
+inline constexpr Mat3f operator- (const Mat3f &a, const Mat3f &b) {
     return Mat3f(a[0] - b[0], a[1] - b[1], a[2] - b[2]);
 }
 
-inline Mat3f& operator*= (Mat3f &m, const float a) {
+inline constexpr Mat3f& operator*= (Mat3f &m, const float a) {
     m[0] *= a;
     m[1] *= a;
     m[2] *= a;
@@ -236,16 +302,12 @@ inline Mat3f& operator*= (Mat3f &m, const float a) {
 }
 
 inline Mat3f& operator*= (Mat3f &a, const Mat3f &b) {
-    Mat3f tmp = a.transpose();
-
-    a.set(tmp[0].dot(b[0]), tmp[1].dot(b[0]), tmp[2].dot(b[0]),
-          tmp[0].dot(b[1]), tmp[1].dot(b[1]), tmp[2].dot(b[1]),
-          tmp[0].dot(b[2]), tmp[1].dot(b[2]), tmp[2].dot(b[2]));
+    a = a * b;
 
     return a;
 }
 
-inline Mat3f& operator+= (Mat3f &a, const Mat3f &b) {
+inline constexpr Mat3f& operator+= (Mat3f &a, const Mat3f &b) {
     a[0] += b[0];
     a[1] += b[1];
     a[2] += b[2];
@@ -253,7 +315,7 @@ inline Mat3f& operator+= (Mat3f &a, const Mat3f &b) {
     return a;
 }
 
-inline Mat3f& operator-= (Mat3f &a, const Mat3f &b) {
+inline constexpr Mat3f& operator-= (Mat3f &a, const Mat3f &b) {
     a[0] -= b[0];
     a[1] -= b[1];
     a[2] -= b[2];
@@ -261,7 +323,7 @@ inline Mat3f& operator-= (Mat3f &a, const Mat3f &b) {
     return a;
 }
 
-inline float Mat3f::determinant () const {
+inline constexpr float Mat3f::determinant () const {
     // Laplace Expansion Determinant
     //    0 1 2
     // x |0 3 6|
@@ -272,11 +334,11 @@ inline float Mat3f::determinant () const {
            mat[0].z * (mat[1].x * mat[2].y - mat[2].x * mat[1].y);
 }
 
-inline bool Mat3f::hasInverse () const {
+inline constexpr bool Mat3f::hasInverse () const {
     return 0 != determinant();
 }
 
-inline Mat3f Mat3f::transpose () const {
+inline constexpr Mat3f Mat3f::transpose () const {
     return Mat3f(mat[0].x, mat[1].x, mat[2].x,
                  mat[0].y, mat[1].y, mat[2].y,
                  mat[0].z, mat[1].z, mat[2].z);
@@ -294,7 +356,7 @@ inline Mat3f &Mat3f::transposeSelf () {
 // Mat3f Comparisons
 //=======================
 
-inline bool Mat3f::compare (const Mat3f &other) const {
+inline constexpr bool Mat3f::compare (const Mat3f &other) const {
     return mat[0] == other.mat[0] &&
            mat[1] == other.mat[1] &&
            mat[2] == other.mat[2];
@@ -306,11 +368,11 @@ inline bool Mat3f::compare (const Mat3f &other, const float threshold) const {
            mat[2].compare(other.mat[2], threshold);
 }
 
-inline bool operator== (const Mat3f &a, const Mat3f &b) {
+inline constexpr bool operator== (const Mat3f &a, const Mat3f &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Mat3f &a, const Mat3f &b) {
+inline constexpr bool operator!= (const Mat3f &a, const Mat3f &b) {
     return !a.compare(b);
 }
 
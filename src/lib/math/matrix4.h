@@ -31,22 +31,22 @@
 class Mat4f {
 public:
     /** Default Constructor */
-    Mat4f ()
+    constexpr Mat4f ()
           : mat{Vec4f{0, 0, 0, 0}, Vec4f{0, 0, 0, 0}, Vec4f{0, 0, 0, 0}, Vec4f{0, 0, 0, 0}} { }
 
     /** Fill Constructor */
-    explicit Mat4f (const float f)
+    explicit constexpr Mat4f (const float f)
           : mat{Vec4f{f, f, f, f}, Vec4f{f, f, f, f}, Vec4f{f, f, f, f}, Vec4f{f, f, f, f}} { }
 
     /** Value Constructor */
-    explicit Mat4f (const float aa, const float ab, const float ac, const float ad,
-                    const float ba, const float bb, const float bc, const float bd,
-                    const float ca, const float cb, const float cc, const float cd,
-                    const float da, const float db, const float dc, const float dd);
+    explicit constexpr Mat4f (const float aa, const float ab, const float ac, const float ad,
+                              const float ba, const float bb, const float bc, const float bd,
+                              const float ca, const float cb, const float cc, const float cd,
+                              const float da, const float db, const float dc, const float dd);
 
     /** Vec4f Column Constructor */
-    explicit Mat4f (const Vec4f &col1, const Vec4f &col2,
-                    const Vec4f &col3, const Vec4f &col4);
+    explicit constexpr Mat4f (const Vec4f &col1, const Vec4f &col2,
+                              const Vec4f &col3, const Vec4f &col4);
 
     /** 1D Array Constructor */
     explicit Mat4f (const float data[16]);
@@ -58,23 +58,23 @@ public:
      * Set all values of this Mat4f to zero.
      * Destructive.
      */
-    void zero ();
+    constexpr void zero ();
 
     /**
      * Set the values of this Mat4f using float values.
      * Destructive.
      */
-    void set (const float aa, const float ab, const float ac, const float ad,
-              const float ba, const float bb, const float bc, const float bd,
-              const float ca, const float cb, const float cc, const float cd,
-              const float da, const float db, const float dc, const float dd);
+    constexpr void set (const float aa, const float ab, const float ac, const float ad,
+                        const float ba, const float bb, const float bc, const float bd,
+                        const float ca, const float cb, const float cc, const float cd,
+                        const float da, const float db, const float dc, const float dd);
 
     /**
      * Set the columns of this Mat4f using Vec4fs.
      * Destructive.
      */
-    void set (const Vec4f &col1, const Vec4f &col2, const Vec4f &col3,
-              const Vec4f &col4);
+    constexpr void set (const Vec4f &col1, const Vec4f &col2, const Vec4f &col3,
+                        const Vec4f &col4);
 
     /**
      * Set the values of this Mat4f using a 1D float array.
@@ -93,24 +93,52 @@ public:
      */
     bool isIdentity () const;
 
-    const Vec4f &operator[] (const std::size_t index) const { return mat[index]; }
+    constexpr const Vec4f &operator[] (const std::size_t index) const { return mat[index]; }
 
-    Vec4f &operator[] (const std::size_t index) { return mat[index]; }
+    constexpr Vec4f &operator[] (const std::size_t index) { return mat[index]; }
 
-    float determinant () const;
+    constexpr float determinant () const;
 
-    bool hasInverse () const;
+    constexpr bool hasInverse () const;
 
     Mat4f inverse () const;
 
     bool inverseSelf ();
 
-    Mat4f transpose () const;
+    /**
+     * Get the inverse of this Mat4f, assuming it is an affine transform,
+     * i.e. its bottom row is (0, 0, 0, 1). Cheaper than inverse() as only
+     * the upper 3x3 needs a general inverse.
+     */
+    Mat4f inverseAffine () const;
+
+    /**
+     * Get the inverse of this Mat4f, assuming it is a rotation and per-axis
+     * scale followed by a translation, as built by Transform. The upper 3x3
+     * is transposed and each axis rescaled, without any division by the
+     * determinant.
+     */
+    Mat4f inverseOrthogonal () const;
+
+    /**
+     * Get the inverse of this Mat4f, assuming it is a rotation followed by
+     * a translation. The upper 3x3 is only transposed.
+     */
+    Mat4f inverseRigid () const;
+
+    /**
+     * Get the inverse transpose of the upper 3x3 of this Mat4f, which
+     * transforms normals consistently with the surfaces transformed by
+     * this Mat4f.
+     */
+    Mat3f normalMatrix () const;
+
+    constexpr Mat4f transpose () const;
 
     Mat4f& transposeSelf ();
 
     /** Comarisons. */
-    bool compare (const Mat4f &other) const;
+    constexpr bool compare (const Mat4f &other) const;
 
     bool compare (const Mat4f &other, const float threshold) const;
 
@@ -124,23 +152,16 @@ extern const Mat4f Mat4f_Identity;
 
 // --------------------------------------------------------------------------
 
-inline Mat4f::Mat4f (const float aa, const float ab, const float ac, const float ad,
-                     const float ba, const float bb, const float bc, const float bd,
-                     const float ca, const float cb, const float cc, const float cd,
-                     const float da, const float db, const float dc, const float dd) {
-    mat[0].x = aa; mat[0].y = ab; mat[0].z = ac; mat[0].w = ad;
-    mat[1].x = ba; mat[1].y = bb; mat[1].z = bc; mat[1].w = bd;
-    mat[2].x = ca; mat[2].y = cb; mat[2].z = cc; mat[2].w = cd;
-    mat[3].x = da; mat[3].y = db; mat[3].z = dc; mat[3].w = dd;
-}
+inline constexpr Mat4f::Mat4f (const float aa, const float ab, const float ac, const float ad,
+                               const float ba, const float bb, const float bc, const float bd,
+                               const float ca, const float cb, const float cc, const float cd,
+                               const float da, const float db, const float dc, const float dd)
+      : mat{Vec4f{aa, ab, ac, ad}, Vec4f{ba, bb, bc, bd},
+            Vec4f{ca, cb, cc, cd}, Vec4f{da, db, dc, dd}} { }
 
-inline Mat4f::Mat4f (const Vec4f &col1, const Vec4f &col2,
-                     const Vec4f &col3, const Vec4f &col4) {
-    mat[0].x = col1.x; mat[0].y = col1.y; mat[0].z = col1.z; mat[0].w = col1.w;
-    mat[1].x = col2.x; mat[1].y = col2.y; mat[1].z = col2.z; mat[1].w = col2.w;
-    mat[2].x = col3.x; mat[2].y = col3.y; mat[2].z = col3.z; mat[2].w = col3.w;
-    mat[3].x = col4.x; mat[3].y = col4.y; mat[3].z = col4.z; mat[3].w = col4.w;
-}
+inline constexpr Mat4f::Mat4f (const Vec4f &col1, const Vec4f &col2,
+                               const Vec4f &col3, const Vec4f &col4)
+      : mat{col1, col2, col3, col4} { }
 
 inline Mat4f::Mat4f (const float data[16]) {
     std::memcpy(mat, data, 16 * sizeof(float));
@@ -150,22 +171,22 @@ inline Mat4f::Mat4f (const float data[4][4]) {
     std::memcpy(mat, data, 4 * 4 * sizeof(float));
 }
 
-inline void Mat4f::set (const float aa, const float ab, const float ac,
-                        const float ad,
-                        const float ba, const float bb, const float bc,
-                        const float bd,
-                        const float ca, const float cb, const float cc,
-                        const float cd,
-                        const float da, const float db, const float dc,
-                        const float dd) {
+inline constexpr void Mat4f::set (const float aa, const float ab, const float ac,
+                                  const float ad,
+                                  const float ba, const float bb, const float bc,
+                                  const float bd,
+                                  const float ca, const float cb, const float cc,
+                                  const float cd,
+                                  const float da, const float db, const float dc,
+                                  const float dd) {
     mat[0].x = aa; mat[0].y = ab; mat[0].z = ac; mat[0].w = ad;
     mat[1].x = ba; mat[1].y = bb; mat[1].z = bc; mat[1].w = bd;
     mat[2].x = ca; mat[2].y = cb; mat[2].z = cc; mat[2].w = cd;
     mat[3].x = da; mat[3].y = db; mat[3].z = dc; mat[3].w = dd;
 }
 
-inline void Mat4f::set (const Vec4f &col1, const Vec4f &col2,
-                        const Vec4f &col3, const Vec4f &col4) {
+inline constexpr void Mat4f::set (const Vec4f &col1, const Vec4f &col2,
+                                  const Vec4f &col3, const Vec4f &col4) {
     mat[0].x = col1.x; mat[0].y = col1.y; mat[0].z = col1.z; mat[0].w = col1.w;
     mat[1].x = col2.x; mat[1].y = col2.y; mat[1].z = col2.z; mat[1].w = col2.w;
     mat[2].x = col3.x; mat[2].y = col3.y; mat[2].z = col3.z; mat[2].w = col3.w;
@@ -180,7 +201,7 @@ inline void Mat4f::set (const float **data) {
     std::memcpy(mat, data, 4 * 4 * sizeof(float));
 }
 
-inline void Mat4f::zero () {
+inline constexpr void Mat4f::zero () {
     mat[0].zero();
     mat[1].zero();
     mat[2].zero();
@@ -195,15 +216,19 @@ inline bool Mat4f::isIdentity () const {
 // Mat4f Operations
 //=======================
 
-inline Mat4f operator* (const Mat4f &m, const float a) {
+inline constexpr Mat4f operator* (const Mat4f &m, const float a) {
     return Mat4f(m[0] * a, m[1] * a, m[2] * a, m[3] * a);
 }
 
-inline Mat4f operator* (const float a, const Mat4f &rhs) {
+inline constexpr Mat4f operator* (const float a, const Mat4f &rhs) {
     return rhs * a;
 }
 
-inline Mat4f operator* (const Mat4f &a, const Mat4f &b) {
+/**
+ * Reference scalar Mat4f product. The SIMD backends reproduce this result
+ * and it is used directly when no backend is available.
+ */
+inline constexpr Mat4f mulScalar (const Mat4f &a, const Mat4f &b) {
     Mat4f tmp = a.transpose();
 
     return Mat4f(tmp[0].Dot(b[0]), tmp[1].Dot(b[0]), tmp[2].Dot(b[0]), tmp[3].Dot(b[0]),
@@ -212,26 +237,113 @@ inline Mat4f operator* (const Mat4f &a, const Mat4f &b) {
                  tmp[0].Dot(b[3]), tmp[1].Dot(b[3]), tmp[2].Dot(b[3]), tmp[3].Dot(b[3]));
 }
 
-inline Vec4f operator* (const Mat4f &m, const Vec4f &v) {
+/**
+ * Reference scalar Mat4f * Vec4f product.
+ */
+inline constexpr Vec4f mulScalar (const Mat4f &m, const Vec4f &v) {
     return Vec4f(m[0].x * v.x + m[1].x * v.y + m[2].x * v.z + m[3].x * v.w,
                  m[0].y * v.x + m[1].y * v.y + m[2].y * v.z + m[3].y * v.w,
                  m[0].z * v.x + m[1].z * v.y + m[2].z * v.z + m[3].z * v.w,
                  m[0].w * v.x + m[1].w * v.y + m[2].w * v.z + m[3].w * v.w);
 }
 
+/**
+ * Reference scalar Mat4f inverse, by cofactor expansion. Verifies that
+ * the inverse exists.
+ */
+Mat4f inverseScalar (const Mat4f &m);
+
+// Each result column is a linear combination of the columns of a,
+// weighted by the matching column of b.
+inline Mat4f operator* (const Mat4f &a, const Mat4f &b) {
+#if SGE_SIMD_AVX
+    Mat4f result;
+    const float *pa = &a[0].x;
+    const float *pb = &b[0].x;
+
+    // Each 256 bit register holds two columns of the result.
+    const __m256 a0 = simd::dup128(_mm_loadu_ps(pa));
+    const __m256 a1 = simd::dup128(_mm_loadu_ps(pa + 4));
+    const __m256 a2 = simd::dup128(_mm_loadu_ps(pa + 8));
+    const __m256 a3 = simd::dup128(_mm_loadu_ps(pa + 12));
+
+    _mm256_storeu_ps(&result[0].x, simd::combine4(a0, a1, a2, a3, _mm256_loadu_ps(pb)));
+    _mm256_storeu_ps(&result[2].x, simd::combine4(a0, a1, a2, a3, _mm256_loadu_ps(pb + 8)));
+
+    return result;
+#elif SGE_SIMD_SSE
+    Mat4f result;
+    const float *pa = &a[0].x;
+    const __m128 a0 = _mm_loadu_ps(pa);
+    const __m128 a1 = _mm_loadu_ps(pa + 4);
+    const __m128 a2 = _mm_loadu_ps(pa + 8);
+    const __m128 a3 = _mm_loadu_ps(pa + 12);
+
+    _mm_storeu_ps(&result[0].x, simd::combine4(a0, a1, a2, a3, _mm_loadu_ps(&b[0].x)));
+    _mm_storeu_ps(&result[1].x, simd::combine4(a0, a1, a2, a3, _mm_loadu_ps(&b[1].x)));
+    _mm_storeu_ps(&result[2].x, simd::combine4(a0, a1, a2, a3, _mm_loadu_ps(&b[2].x)));
+    _mm_storeu_ps(&result[3].x, simd::combine4(a0, a1, a2, a3, _mm_loadu_ps(&b[3].x)));
+
+    return result;
+#elif SGE_SIMD_NEON
+    Mat4f result;
+    const float *pa = &a[0].x;
+    const float32x4_t a0 = vld1q_f32(pa);
+    const float32x4_t a1 = vld1q_f32(pa + 4);
+    const float32x4_t a2 = vld1q_f32(pa + 8);
+    const float32x4_t a3 = vld1q_f32(pa + 12);
+
+    for (int c = 0; c < 4; ++c) {
+        float32x4_t r = vmulq_n_f32(a0, b[c].x);
+        r = vmlaq_n_f32(r, a1, b[c].y);
+        r = vmlaq_n_f32(r, a2, b[c].z);
+        r = vmlaq_n_f32(r, a3, b[c].w);
+        vst1q_f32(&result[c].x, r);
+    }
+
+    return result;
+#else
+    return mulScalar(a, b);
+#endif
+}
+
+inline Vec4f operator* (const Mat4f &m, const Vec4f &v) {
+#if SGE_SIMD_SSE
+    Vec4f result;
+    const float *pm = &m[0].x;
+    _mm_storeu_ps(&result.x, simd::combine4(_mm_loadu_ps(pm), _mm_loadu_ps(pm + 4),
+                                            _mm_loadu_ps(pm + 8), _mm_loadu_ps(pm + 12),
+                                            _mm_loadu_ps(&v.x)));
+
+    return result;
+#elif SGE_SIMD_NEON
+    Vec4f result;
+    const float *pm = &m[0].x;
+    float32x4_t r = vmulq_n_f32(vld1q_f32(pm), v.x);
+    r = vmlaq_n_f32(r, vld1q_f32(pm + 4), v.y);
+    r = vmlaq_n_f32(r, vld1q_f32(pm + 8), v.z);
+    r = vmlaq_n_f32(r, vld1q_f32(pm + 12), v.w);
+    vst1q_f32(&result.x, r);
+
+    return result;
+#else
+    return mulScalar(m, v);
+#endif
+}
+
 inline Vec4f operator* (const Vec4f &lhs, const Mat4f &rhs) {
     return rhs * lhs;
 }
 
-inline Mat4f operator+ (const Mat4f &a, const Mat4f &b) {
+inline constexpr Mat4f operator+ (const Mat4f &a, const Mat4f &b) {
     return Mat4f(a[0] + b[0], a[1] + b[1], a[2] + b[2], a[3] + b[3]);
 }
 
-inline Mat4f operator- (const Mat4f &a, const Mat4f &b) {
+inline constexpr Mat4f operator- (const Mat4f &a, const Mat4f &b) {
     return Mat4f(a[0] - b[0], a[1] - b[1], a[2] - b[2], a[3] - b[3]);
 }
 
-inline Mat4f& operator*= (Mat4f &m, const float a) {
+inline constexpr Mat4f& operator*= (Mat4f &m, const float a) {
     m[0] *= a;
     m[1] *= a;
     m[2] *= a;
@@ -241,21 +353,12 @@ inline Mat4f& operator*= (Mat4f &m, const float a) {
 }
 
 inline Mat4f& operator*= (Mat4f &a, const Mat4f &b) {
-    Mat4f tmp = a.transpose();
-
-    a.set(tmp[0].Dot(b[0]), tmp[1].Dot(b[0]), tmp[2].Dot(b[0]),
-          tmp[3].Dot(b[0]),
-          tmp[0].Dot(b[1]), tmp[1].Dot(b[1]), tmp[2].Dot(b[1]),
-          tmp[3].Dot(b[1]),
-          tmp[0].Dot(b[2]), tmp[1].Dot(b[2]), tmp[2].Dot(b[2]),
-          tmp[3].Dot(b[2]),
-          tmp[0].Dot(b[3]), tmp[1].Dot(b[3]), tmp[2].Dot(b[3]),
-          tmp[3].Dot(b[3]));
+    a = a * b;
 
     return a;
 }
 
-inline Mat4f& operator+= (Mat4f &a, const Mat4f &b) {
+inline constexpr Mat4f& operator+= (Mat4f &a, const Mat4f &b) {
     a[0] += b[0];
     a[1] += b[1];
     a[2] += b[2];
@@ -264,7 +367,7 @@ inline Mat4f& operator+= (Mat4f &a, const Mat4f &b) {
     return a;
 }
 
-inline Mat4f& operator-= (Mat4f &a, const Mat4f &b) {
+inline constexpr Mat4f& operator-= (Mat4f &a, const Mat4f &b) {
     a[0] -= b[0];
     a[1] -= b[1];
     a[2] -= b[2];
@@ -273,30 +376,24 @@ inline Mat4f& operator-= (Mat4f &a, const Mat4f &b) {
     return a;
 }
 
-inline float Mat4f::determinant () const {
-    float a, b, c, d;
-
-    a = Mat3f(mat[1].y, mat[2].y, mat[3].y, mat[1].z, mat[2].z, mat[3].z,
-              mat[1].w, mat[2].w, mat[3].w)
-          .determinant();
-    b = Mat3f(mat[1].x, mat[2].x, mat[3].x, mat[1].z, mat[2].z, mat[3].z,
-              mat[1].w, mat[2].w, mat[3].w)
-          .determinant();
-    c = Mat3f(mat[1].x, mat[2].x, mat[3].x, mat[1].y, mat[2].y, mat[3].y,
-              mat[1].w, mat[2].w, mat[3].w)
-          .determinant();
-    d = Mat3f(mat[1].x, mat[2].x, mat[3].x, mat[1].y, mat[2].y, mat[3].y,
-              mat[1].z, mat[2].z, mat[3].z)
-          .determinant();
+inline constexpr float Mat4f::determinant () const {
+    const float a = Mat3f(mat[1].y, mat[2].y, mat[3].y, mat[1].z, mat[2].z, mat[3].z,
+                          mat[1].w, mat[2].w, mat[3].w).determinant();
+    const float b = Mat3f(mat[1].x, mat[2].x, mat[3].x, mat[1].z, mat[2].z, mat[3].z,
+                          mat[1].w, mat[2].w, mat[3].w).determinant();
+    const float c = Mat3f(mat[1].x, mat[2].x, mat[3].x, mat[1].y, mat[2].y, mat[3].y,
+                          mat[1].w, mat[2].w, mat[3].w).determinant();
+    const float d = Mat3f(mat[1].x, mat[2].x, mat[3].x, mat[1].y, mat[2].y, mat[3].y,
+                          mat[1].z, mat[2].z, mat[3].z).determinant();
 
     return mat[0].x * a - mat[0].y * b + mat[0].z * c - mat[0].w * d;
 }
 
-inline bool Mat4f::hasInverse () const {
+inline constexpr bool Mat4f::hasInverse () const {
     return 0 != determinant();
 }
 
-inline Mat4f Mat4f::transpose () const {
+inline constexpr Mat4f Mat4f::transpose () const {
     return Mat4f(mat[0].x, mat[1].x, mat[2].x, mat[3].x,
                      mat[0].y, mat[1].y, mat[2].y, mat[3].y,
                      mat[0].z, mat[1].z, mat[2].z, mat[3].z,
@@ -319,7 +416,7 @@ inline Mat4f &Mat4f::transposeSelf () {
 // Mat4f Comparisons
 //=======================
 
-inline bool Mat4f::compare (const Mat4f &other) const {
+inline constexpr bool Mat4f::compare (const Mat4f &other) const {
     return mat[0].compare(other.mat[0]) &&
            mat[1].compare(other.mat[1]) &&
            mat[2].compare(other.mat[2]) &&
@@ -333,11 +430,11 @@ inline bool Mat4f::compare (const Mat4f &other, const float threshold) const {
            mat[3].compare(other.mat[3], threshold);
 }
 
-inline bool operator== (const Mat4f &a, const Mat4f &b) {
+inline constexpr bool operator== (const Mat4f &a, const Mat4f &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Mat4f &a, const Mat4f &b) {
+inline constexpr bool operator!= (const Mat4f &a, const Mat4f &b) {
     return !a.compare(b);
 }
 
@@ -0,0 +1,222 @@
+/*---  Packed.h - Packed Vector Formats  ----------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Compact storage formats for vertex data: half precision floats
+ *   (Vec2h, Vec4h), signed and unsigned normalized integers, and
+ *   octahedral encoded unit vectors.
+ *
+ * Normalized integers follow the OpenGL conversion rules, so data packed
+ * here reads back the same when bound as a normalized vertex attribute:
+ * snorm n maps -1..1 to -(2^(n-1) - 1)..2^(n-1) - 1 and unorm n maps
+ * 0..1 to 0..2^n - 1. Conversions round to nearest and saturate.
+ */
+#ifndef __SGE_PACKED_H
+#define __SGE_PACKED_H
+
+#include <cmath>
+#include <cstring> // std::memcpy
+
+namespace math {
+
+/**
+ * Convert to IEEE 754 half precision, rounding to nearest even.
+ * Magnitudes above 65504 become infinity; NaN stays NaN.
+ */
+u16 floatToHalf (const float f);
+
+/**
+ * Convert from IEEE 754 half precision. Exact.
+ */
+float halfToFloat (const u16 h);
+
+s16 packSnorm16 (const float f);
+float unpackSnorm16 (const s16 s);
+
+u16 packUnorm16 (const float f);
+float unpackUnorm16 (const u16 u);
+
+s8 packSnorm8 (const float f);
+float unpackSnorm8 (const s8 s);
+
+/**
+ * Map a unit vector onto the octahedron |x| + |y| + |z| = 1, then
+ * unfold that onto the square -1..1. Two snorm16 components store a
+ * normal to within 0.005 degrees; two snorm8 to within 1.5 degrees.
+ * The zero vector encodes as +Z.
+ */
+Vec2f octEncode (const Vec3f &n);
+
+/**
+ * Inverse of octEncode(). The result is normalized.
+ */
+Vec3f octDecode (const Vec2f &e);
+
+} /* namespace math */
+
+/**
+ * 2D Vector of half precision floats, e.g. texture coordinates.
+ */
+class Vec2h {
+public:
+    u16 x = 0;
+    u16 y = 0;
+
+public:
+    /** Default Constructor. */
+    Vec2h () = default;
+
+    /** Convert from Vec2f, rounding to nearest. */
+    explicit Vec2h (const Vec2f &v)
+          : x(math::floatToHalf(v.x)), y(math::floatToHalf(v.y)) { }
+
+    Vec2f toVec2f () const;
+};
+
+/**
+ * 4D Vector of half precision floats.
+ */
+class Vec4h {
+public:
+    u16 x = 0;
+    u16 y = 0;
+    u16 z = 0;
+    u16 w = 0;
+
+public:
+    /** Default Constructor. */
+    Vec4h () = default;
+
+    /** Convert from Vec4f, rounding to nearest. */
+    explicit Vec4h (const Vec4f &v)
+          : x(math::floatToHalf(v.x)), y(math::floatToHalf(v.y)),
+            z(math::floatToHalf(v.z)), w(math::floatToHalf(v.w)) { }
+
+    Vec4f toVec4f () const;
+};
+
+// --------------------------------------------------------------------------
+
+namespace math {
+
+inline u16 floatToHalf (const float f) {
+    u32 x;
+    std::memcpy(&x, &f, sizeof(x));
+    const u16 sign = static_cast<u16>((x >> 16) & 0x8000u);
+    x &= 0x7FFFFFFFu;
+
+    if (x >= 0x7F800000u) { // Infinity or NaN. Keep NaN quiet.
+        return sign | 0x7C00u | (x > 0x7F800000u ? 0x0200u : 0u);
+    }
+    if (x >= 0x477FF000u) { // Rounds above 65504.
+        return sign | 0x7C00u;
+    }
+    if (x < 0x38800000u) {
+        // Below the smallest normal half. Adding 0.5 lines the half's
+        // denormal step (2^-24) up with the ulp of the sum, so the FPU
+        // does the rounding.
+        float a;
+        std::memcpy(&a, &x, sizeof(a));
+        a += 0.5f;
+        std::memcpy(&x, &a, sizeof(x));
+        return sign | static_cast<u16>(x - 0x3F000000u);
+    }
+
+    // Rebias the exponent and round the mantissa to nearest even.
+    x += 0xC8000FFFu + ((x >> 13) & 1u);
+    return sign | static_cast<u16>(x >> 13);
+}
+
+inline float halfToFloat (const u16 h) {
+    const u32 sign = static_cast<u32>(h & 0x8000u) << 16;
+    const u32 rest = h & 0x7FFFu;
+
+    u32 x;
+    if (rest >= 0x7C00u) { // Infinity or NaN
+        x = sign | 0x7F800000u | ((rest & 0x03FFu) << 13);
+    } else if (rest >= 0x0400u) {
+        x = sign | ((rest << 13) + 0x38000000u);
+    } else { // Zero or denormal: rest * 2^-24
+        const float f = static_cast<float>(rest) * 5.9604644775390625e-8f;
+        std::memcpy(&x, &f, sizeof(x));
+        x |= sign;
+    }
+
+    float f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+inline s16 packSnorm16 (const float f) {
+    return static_cast<s16>(roundf(clamp(f, -1.0f, 1.0f) * 32767.0f));
+}
+
+inline float unpackSnorm16 (const s16 s) {
+    return max(static_cast<float>(s) / 32767.0f, -1.0f);
+}
+
+inline u16 packUnorm16 (const float f) {
+    return static_cast<u16>(roundf(clamp(f, 0.0f, 1.0f) * 65535.0f));
+}
+
+inline float unpackUnorm16 (const u16 u) {
+    return static_cast<float>(u) / 65535.0f;
+}
+
+inline s8 packSnorm8 (const float f) {
+    return static_cast<s8>(roundf(clamp(f, -1.0f, 1.0f) * 127.0f));
+}
+
+inline float unpackSnorm8 (const s8 s) {
+    return max(static_cast<float>(s) / 127.0f, -1.0f);
+}
+
+// Sign of f, counting 0 as positive.
+inline float signNotZero (const float f) {
+    return (f >= 0.0f) ? 1.0f : -1.0f;
+}
+
+inline Vec2f octEncode (const Vec3f &n) {
+    const float l1 = fabsf(n.x) + fabsf(n.y) + fabsf(n.z);
+    if (l1 == 0.0f) {
+        return Vec2f(0.0f, 0.0f);
+    }
+
+    const float px = n.x / l1;
+    const float py = n.y / l1;
+    if (n.z >= 0.0f) {
+        return Vec2f(px, py);
+    }
+
+    // Fold the lower half over the diagonals.
+    return Vec2f((1.0f - fabsf(py)) * signNotZero(px),
+                 (1.0f - fabsf(px)) * signNotZero(py));
+}
+
+inline Vec3f octDecode (const Vec2f &e) {
+    const float z = 1.0f - fabsf(e.x) - fabsf(e.y);
+    if (z >= 0.0f) {
+        return Vec3f(e.x, e.y, z).normalize();
+    }
+
+    return Vec3f((1.0f - fabsf(e.y)) * signNotZero(e.x),
+                 (1.0f - fabsf(e.x)) * signNotZero(e.y), z).normalize();
+}
+
+} /* namespace math */
+
+inline Vec2f Vec2h::toVec2f () const {
+    return Vec2f(math::halfToFloat(x), math::halfToFloat(y));
+}
+
+inline Vec4f Vec4h::toVec4f () const {
+    return Vec4f(math::halfToFloat(x), math::halfToFloat(y),
+                 math::halfToFloat(z), math::halfToFloat(w));
+}
+
+#endif /* __SGE_PACKED_H */
@@ -3,12 +3,29 @@
 //
 #include "../lib.h"
 
-const Quat4f Quat4f_Identity {0.0f, 0.0f, 0.0f, 1.0f};
-
-
+constexpr Quat4f Quat4f_Identity {0.0f, 0.0f, 0.0f, 1.0f};
 
 Vec3f Quat4f::rotate (const Vec3f &vec) const {
     Quat4f result = (*this) * vec * conjugate();
 
     return Vec3f(result.i, result.j, result.k);
 }
+
+Quat4f slerp (const Quat4f &a, const Quat4f &b, const float t) {
+    float d = a.i * b.i + a.j * b.j + a.k * b.k + a.w * b.w;
+    float sign = 1.0f;
+    if (d < 0.0f) {
+        d = -d;
+        sign = -1.0f;
+    }
+
+    // sin(theta) vanishes as a and b converge, where nlerp is just as good.
+    if (d > kQuatSlerpNlerpThreshold) {
+        return nlerp(a, b, t);
+    }
+
+    const float theta = acosf(d);
+    const float invSin = 1.0f / sinf(theta);
+
+    return a * (sinf((1.0f - t) * theta) * invSin) + b * (sign * sinf(t * theta) * invSin);
+}
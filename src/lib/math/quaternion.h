@@ -32,7 +32,7 @@ public:
     Quat4f () = default;
 
     /** Value Constructor */
-    explicit Quat4f (const float ii, const float jj, const float kk, const float ww)
+    explicit constexpr Quat4f (const float ii, const float jj, const float kk, const float ww)
         : i(ii), j(jj), k(kk), w(ww) { }
 
     /**
@@ -55,25 +55,25 @@ public:
      */
     float &operator[] (const std::size_t index) { return (&i)[index]; }
 
-    void Zero () { i = j = k = w = 0; }
+    constexpr void Zero () { i = j = k = w = 0; }
 
-    float magSq () const;
+    constexpr float magSq () const;
 
     float mag () const;
 
     bool isIdentity () const;
 
-    bool isUnit () const;
+    constexpr bool isUnit () const;
 
     Quat4f normalize () const;
 
     void normalizeSelf ();
 
-    Quat4f conjugate () const;
+    constexpr Quat4f conjugate () const;
 
-    float dot (const Quat4f &rhs) const;
+    constexpr float dot (const Quat4f &rhs) const;
 
-    Quat4f cross (const Quat4f &rhs) const;
+    constexpr Quat4f cross (const Quat4f &rhs) const;
 
     /**
      * Apply the rotation in this quaternion to a Vec3f.
@@ -83,7 +83,7 @@ public:
     /**
      * Test if two Quat4fs are equivalent.
      */
-    bool compare (const Quat4f &rhs) const;
+    constexpr bool compare (const Quat4f &rhs) const;
 
     /**
      * Test if two Quat4fs are similar within a
@@ -94,6 +94,22 @@ public:
 
 extern const Quat4f Quat4f_Identity;
 
+/** Cosine of the angle below which slerp falls back to nlerp. */
+static constexpr float kQuatSlerpNlerpThreshold = 0.9995f;
+
+/**
+ * Normalized linear interpolation between unit quaternions a and b,
+ * along the shorter arc. Constant angular velocity only at t = 0, 0.5
+ * and 1.
+ */
+Quat4f nlerp (const Quat4f &a, const Quat4f &b, const float t);
+
+/**
+ * Spherical linear interpolation between unit quaternions a and b, along
+ * the shorter arc.
+ */
+Quat4f slerp (const Quat4f &a, const Quat4f &b, const float t);
+
 // --------------------------------------------------------------------------
 
 inline Quat4f::Quat4f (const float angle, const Vec3f &axis) {
@@ -111,17 +127,17 @@ inline Quat4f::Quat4f (const float angle, const Vec3f &axis) {
 //======================
 
 /** Multiply by scalar. */
-inline Quat4f operator* (const Quat4f &q, const float a) {
+inline constexpr Quat4f operator* (const Quat4f &q, const float a) {
     return Quat4f(a * q.i, a * q.j, a * q.k, a * q.w);
 }
 
 /** Multiply by scalar. */
-inline Quat4f operator* (const float a, const Quat4f &q) {
+inline constexpr Quat4f operator* (const float a, const Quat4f &q) {
     return Quat4f(a * q.i, a * q.j, a * q.k, a * q.w);
 }
 
 /** Multiply by quaternion. */
-inline Quat4f operator* (const Quat4f &a, const Quat4f &b) {
+inline constexpr Quat4f operator* (const Quat4f &a, const Quat4f &b) {
     return Quat4f(a.i * b.w + a.w * b.i + a.j * b.k - a.k * b.j,
                   a.j * b.w + a.w * b.j + a.k * b.i - a.i * b.k,
                   a.k * b.w + a.w * b.k + a.i * b.j - a.j * b.i,
@@ -129,7 +145,7 @@ inline Quat4f operator* (const Quat4f &a, const Quat4f &b) {
 }
 
 /** Multiply by Vector3. */
-inline Quat4f operator* (const Quat4f &a, const Vec3f &b) {
+inline constexpr Quat4f operator* (const Quat4f &a, const Vec3f &b) {
     return Quat4f(a.w * b.x + a.j * b.z - a.k * b.y,
                   a.w * b.y + a.k * b.x - a.i * b.z,
                   a.w * b.z + a.i * b.y - a.j * b.x,
@@ -137,23 +153,23 @@ inline Quat4f operator* (const Quat4f &a, const Vec3f &b) {
 }
 
 /** Addition. */
-inline Quat4f operator+ (const Quat4f &a, const Quat4f &b) {
+inline constexpr Quat4f operator+ (const Quat4f &a, const Quat4f &b) {
     return Quat4f(a.i + b.i, a.j + b.j, a.k + b.k, a.w + b.w);
 }
 
 /** Subtraction. */
-inline Quat4f operator- (const Quat4f &a, const Quat4f &b) {
+inline constexpr Quat4f operator- (const Quat4f &a, const Quat4f &b) {
     return Quat4f(a.i - b.i, a.j - b.j, a.k - b.k, a.w - b.w);
 }
 
 /** Division */
-inline Quat4f operator/ (const Quat4f &q, const float a) {
+inline constexpr Quat4f operator/ (const Quat4f &q, const float a) {
     float inva = 1.0f / a;
     return Quat4f(q.i * inva, q.j * inva, q.k * inva, q.w * inva);
 }
 
 /** Multiply by scalar in place. */
-inline Quat4f& operator*= (Quat4f &q, const float a) {
+inline constexpr Quat4f& operator*= (Quat4f &q, const float a) {
     q.i *= a;
     q.j *= a;
     q.k *= a;
@@ -163,7 +179,7 @@ inline Quat4f& operator*= (Quat4f &q, const float a) {
 }
 
 /** Multiply by quaternion in place. */
-inline Quat4f& operator*= (Quat4f &a, const Quat4f &b) {
+inline constexpr Quat4f& operator*= (Quat4f &a, const Quat4f &b) {
     a.i = a.i * b.w + a.w * b.i + a.j * b.k - a.k * b.j;
     a.j = a.j * b.w + a.w * b.j + a.k * b.i - a.i * b.k;
     a.k = a.k * b.w + a.w * b.k + a.i * b.j - a.j * b.i;
@@ -173,7 +189,7 @@ inline Quat4f& operator*= (Quat4f &a, const Quat4f &b) {
 }
 
 /** Multiply by Vector3 in place. */
-inline Quat4f& operator* (Quat4f &a, const Vec3f &b) {
+inline constexpr Quat4f& operator* (Quat4f &a, const Vec3f &b) {
     a.i = a.w * b.x + a.j * b.z - a.k * b.y;
     a.j = a.w * b.y + a.k * b.x - a.i * b.z;
     a.k = a.w * b.z + a.i * b.y - a.j * b.x;
@@ -183,7 +199,7 @@ inline Quat4f& operator* (Quat4f &a, const Vec3f &b) {
 }
 
 /** Addition in place. */
-inline Quat4f& operator+= (Quat4f &a, const Quat4f &b) {
+inline constexpr Quat4f& operator+= (Quat4f &a, const Quat4f &b) {
     a.i += b.i;
     a.j += b.j;
     a.k += b.k;
@@ -193,7 +209,7 @@ inline Quat4f& operator+= (Quat4f &a, const Quat4f &b) {
 }
 
 /** Subtraction in place. */
-inline Quat4f& operator-= (Quat4f &a, const Quat4f &b) {
+inline constexpr Quat4f& operator-= (Quat4f &a, const Quat4f &b) {
     a.i -= b.i;
     a.j -= b.j;
     a.k -= b.k;
@@ -203,7 +219,7 @@ inline Quat4f& operator-= (Quat4f &a, const Quat4f &b) {
 }
 
 /** Division in place. */
-inline Quat4f& operator/= (Quat4f &q, const float a) {
+inline constexpr Quat4f& operator/= (Quat4f &q, const float a) {
     float inva = 1.0f / a;
 
     q.i *= inva;
@@ -214,7 +230,7 @@ inline Quat4f& operator/= (Quat4f &q, const float a) {
     return q;
 }
 
-inline float Quat4f::magSq () const {
+inline constexpr float Quat4f::magSq () const {
     return i * i + j * j + k * k + w * w;
 }
 
@@ -242,31 +258,37 @@ inline bool Quat4f::isIdentity () const {
     return compare(Quat4f_Identity);
 }
 
-inline bool Quat4f::isUnit () const {
+inline constexpr bool Quat4f::isUnit () const {
     return 1.0f == magSq();
 }
 
-inline Quat4f Quat4f::conjugate () const {
+inline constexpr Quat4f Quat4f::conjugate () const {
     return Quat4f(-i, -j, -k, w);
 }
 
-inline float Quat4f::dot (const Quat4f &rhs) const {
+inline constexpr float Quat4f::dot (const Quat4f &rhs) const {
     return i * rhs.i + j * rhs.j + k * rhs.k;
 }
 
-inline Quat4f Quat4f::cross (const Quat4f &rhs) const {
+inline constexpr Quat4f Quat4f::cross (const Quat4f &rhs) const {
     return Quat4f(j * rhs.k - k * rhs.j,
                       k * rhs.i - i * rhs.k,
                       i * rhs.j - j * rhs.i,
                       w);
 }
 
+inline Quat4f nlerp (const Quat4f &a, const Quat4f &b, const float t) {
+    const float d = a.i * b.i + a.j * b.j + a.k * b.k + a.w * b.w;
+    const float tb = (d < 0.0f) ? -t : t;
+
+    return (a * (1.0f - t) + b * tb).normalize();
+}
 
 //=======================
 // Quat4f Comparison
 //=======================
 
-inline bool Quat4f::compare (const Quat4f &rhs) const {
+inline constexpr bool Quat4f::compare (const Quat4f &rhs) const {
     return i == rhs.i && j == rhs.j && k == rhs.k && w == rhs.w;
 }
 
@@ -277,11 +299,11 @@ inline bool Quat4f::compare (const Quat4f &rhs, const float threshold) const {
            (fabsf(w - rhs.w) <= threshold);
 }
 
-inline bool operator== (const Quat4f &a, const Quat4f &b) {
+inline constexpr bool operator== (const Quat4f &a, const Quat4f &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Quat4f &a, const Quat4f &b) {
+inline constexpr bool operator!= (const Quat4f &a, const Quat4f &b) {
     return !a.compare(b);
 }
 
@@ -0,0 +1,219 @@
+//
+// Batch Quaternion Implementation.
+//
+#include "../lib.h"
+
+#include <algorithm>
+
+static constexpr size_t kBlock = Floatx8::kWidth;
+
+namespace {
+
+// 8 quaternions, one per lane.
+struct QuatX8 {
+    Floatx8 i, j, k, w;
+};
+
+// Load count (<= 8) floats from v, starting at first. Missing lanes are 0.
+inline Floatx8 loadLanes (const std::vector<float> &v, const size_t first,
+                          const size_t count) {
+    if (count == kBlock) {
+        return Floatx8::load(&v[first]);
+    }
+
+    float tmp[kBlock] = {};
+    for (size_t n = 0; n < count; ++n) {
+        tmp[n] = v[first + n];
+    }
+    return Floatx8::load(tmp);
+}
+
+inline void storeLanes (const Floatx8 &f, std::vector<float> &v, const size_t first,
+                        const size_t count) {
+    if (count == kBlock) {
+        f.store(&v[first]);
+        return;
+    }
+
+    float tmp[kBlock];
+    f.store(tmp);
+    for (size_t n = 0; n < count; ++n) {
+        v[first + n] = tmp[n];
+    }
+}
+
+inline QuatX8 loadQuats (const Quat4fArray &q, const size_t first, const size_t count) {
+    return QuatX8{loadLanes(q.i, first, count), loadLanes(q.j, first, count),
+                  loadLanes(q.k, first, count), loadLanes(q.w, first, count)};
+}
+
+inline void storeQuats (const QuatX8 &q, Quat4fArray &out, const size_t first,
+                        const size_t count) {
+    storeLanes(q.i, out.i, first, count);
+    storeLanes(q.j, out.j, first, count);
+    storeLanes(q.k, out.k, first, count);
+    storeLanes(q.w, out.w, first, count);
+}
+
+inline Floatx8 dot (const QuatX8 &a, const QuatX8 &b) {
+    return madd(a.i, b.i, madd(a.j, b.j, madd(a.k, b.k, a.w * b.w)));
+}
+
+// Zero lanes are left as they are, like Quat4f::normalize().
+inline QuatX8 normalized (const QuatX8 &q) {
+    const Floatx8 magSq = dot(q, q);
+    const Floatx8 nonZero = cmpGt(magSq, Floatx8(0.0f));
+    const Floatx8 inv = select(nonZero, Floatx8(1.0f) / sqrt(magSq), Floatx8(1.0f));
+
+    return QuatX8{q.i * inv, q.j * inv, q.k * inv, q.w * inv};
+}
+
+// Interpolation parameter, the same for every quaternion...
+struct UniformT {
+    Floatx8 t;
+
+    explicit UniformT (const float pT) : t(pT) { }
+
+    Floatx8 load (const size_t, const size_t) const { return t; }
+};
+
+// ... or one per quaternion.
+struct ArrayT {
+    const std::vector<float> &t;
+
+    explicit ArrayT (const std::vector<float> &pT) : t(pT) { }
+
+    Floatx8 load (const size_t first, const size_t count) const {
+        return loadLanes(t, first, count);
+    }
+};
+
+// Weights for a * wa + b * wb. d is the dot product of a and b, whose
+// sign picks the shorter arc.
+struct NlerpWeights {
+    void operator() (const Floatx8 &d, const Floatx8 &t, const size_t,
+                     Floatx8 &wa, Floatx8 &wb) const {
+        wa = Floatx8(1.0f) - t;
+        wb = select(cmpLt(d, Floatx8(0.0f)), -t, t);
+    }
+};
+
+// The angles are per lane, so fall back to acosf/sinf one lane at a time.
+struct SlerpWeights {
+    void operator() (const Floatx8 &d, const Floatx8 &t, const size_t count,
+                     Floatx8 &wa, Floatx8 &wb) const {
+        float dv[kBlock], tv[kBlock], av[kBlock], bv[kBlock];
+        d.store(dv);
+        t.store(tv);
+
+        for (size_t n = 0; n < count; ++n) {
+            const float sign = (dv[n] < 0.0f) ? -1.0f : 1.0f;
+            const float cosTheta = dv[n] * sign;
+
+            if (cosTheta > kQuatSlerpNlerpThreshold) {
+                av[n] = 1.0f - tv[n];
+                bv[n] = sign * tv[n];
+            } else {
+                const float theta = acosf(cosTheta);
+                const float invSin = 1.0f / sinf(theta);
+                av[n] = sinf((1.0f - tv[n]) * theta) * invSin;
+                bv[n] = sign * sinf(tv[n] * theta) * invSin;
+            }
+        }
+        for (size_t n = count; n < kBlock; ++n) {
+            av[n] = bv[n] = 0.0f;
+        }
+
+        wa = Floatx8::load(av);
+        wb = Floatx8::load(bv);
+    }
+};
+
+// nlerp moves fastest around t = 0.5, relative to slerp. Warp t to slow
+// it there, by an amount fitted as a polynomial of the cosine of the
+// angle between the quaternions (see Kapoulkine, "Approximating slerp").
+struct SlerpFastWeights {
+    void operator() (const Floatx8 &d, const Floatx8 &t, const size_t,
+                     Floatx8 &wa, Floatx8 &wb) const {
+        const Floatx8 c = max(d, -d);
+
+        const Floatx8 a = madd(c, madd(c, madd(c, Floatx8(-1.43519f), Floatx8(3.55645f)),
+                                       Floatx8(-3.2452f)), Floatx8(1.0904f));
+        const Floatx8 b = madd(c, madd(c, Floatx8(0.215638f), Floatx8(-1.06021f)),
+                               Floatx8(0.848013f));
+
+        const Floatx8 h = t - Floatx8(0.5f);
+        const Floatx8 k = madd(a * h, h, b);
+        const Floatx8 warped = madd(t * h * (t - Floatx8(1.0f)), k, t);
+
+        wa = Floatx8(1.0f) - warped;
+        wb = select(cmpLt(d, Floatx8(0.0f)), -warped, warped);
+    }
+};
+
+} /* namespace */
+
+// out = normalize(a * wa + b * wb) for each block of 8.
+template <typename Weights, typename T>
+static void blend (const Quat4fArray &a, const Quat4fArray &b, const T &t,
+                   const Weights &weights, Quat4fArray &out) {
+    verify(a.size() == b.size());
+
+    const size_t size = a.size();
+    out.resize(size);
+
+    for (size_t first = 0; first < size; first += kBlock) {
+        const size_t count = std::min(kBlock, size - first);
+
+        const QuatX8 qa = loadQuats(a, first, count);
+        const QuatX8 qb = loadQuats(b, first, count);
+
+        Floatx8 wa, wb;
+        weights(dot(qa, qb), t.load(first, count), count, wa, wb);
+
+        const QuatX8 r = normalized(QuatX8{madd(qb.i, wb, qa.i * wa), madd(qb.j, wb, qa.j * wa),
+                                           madd(qb.k, wb, qa.k * wa), madd(qb.w, wb, qa.w * wa)});
+        storeQuats(r, out, first, count);
+    }
+}
+
+void normalize (Quat4fArray &q) {
+    const size_t size = q.size();
+    for (size_t first = 0; first < size; first += kBlock) {
+        const size_t count = std::min(kBlock, size - first);
+        storeQuats(normalized(loadQuats(q, first, count)), q, first, count);
+    }
+}
+
+void nlerp (const Quat4fArray &a, const Quat4fArray &b, const float t,
+            Quat4fArray &out) {
+    blend(a, b, UniformT(t), NlerpWeights(), out);
+}
+
+void nlerp (const Quat4fArray &a, const Quat4fArray &b, const std::vector<float> &t,
+            Quat4fArray &out) {
+    verify(t.size() == a.size());
+    blend(a, b, ArrayT(t), NlerpWeights(), out);
+}
+
+void slerp (const Quat4fArray &a, const Quat4fArray &b, const float t,
+            Quat4fArray &out) {
+    blend(a, b, UniformT(t), SlerpWeights(), out);
+}
+
+void slerp (const Quat4fArray &a, const Quat4fArray &b, const std::vector<float> &t,
+            Quat4fArray &out) {
+    verify(t.size() == a.size());
+    blend(a, b, ArrayT(t), SlerpWeights(), out);
+}
+
+void slerpFast (const Quat4fArray &a, const Quat4fArray &b, const float t,
+                Quat4fArray &out) {
+    blend(a, b, UniformT(t), SlerpFastWeights(), out);
+}
+
+void slerpFast (const Quat4fArray &a, const Quat4fArray &b, const std::vector<float> &t,
+                Quat4fArray &out) {
+    verify(t.size() == a.size());
+    blend(a, b, ArrayT(t), SlerpFastWeights(), out);
+}
@@ -13,11 +13,6 @@
 #define __SGE_TRANSFORM_H
 
 class Transform {
-public:
-    Vec3f position;
-    Quat4f orientation;
-    Vec3f scale;
-
 public:
     /**
      * Create a new Transformation.
@@ -25,7 +20,38 @@ public:
     explicit Transform (const Vec3f &p_pos = Vec3f_Zero,
                         const Quat4f &p_ori = Quat4f_Identity,
                         const Vec3f &p_scale = Vec3f_One)
-          : position(p_pos), orientation(p_ori), scale(p_scale) { }
+          : mPosition(p_pos), mOrientation(p_ori), mScale(p_scale),
+            mWorldDirty(true), mViewDirty(true), mRebuilds(0), mReuses(0) { }
+
+    const Vec3f& position () const { return mPosition; }
+
+    const Quat4f& orientation () const { return mOrientation; }
+
+    const Vec3f& scale () const { return mScale; }
+
+    /**
+     * Set the position of this Transform.
+     * Destructive.
+     */
+    void setPosition (const Vec3f &pPosition);
+
+    /**
+     * Set the orientation of this Transform.
+     * Destructive.
+     */
+    void setOrientation (const Quat4f &pOrientation);
+
+    /**
+     * Set the scale of this Transform.
+     * Destructive.
+     */
+    void setScale (const Vec3f &pScale);
+
+    /**
+     * Move this Transform by an offset in World Space.
+     * Destructive.
+     */
+    void translate (const Vec3f &offset);
 
     /**
      * Clear transformations on this Transform.
@@ -82,7 +108,8 @@ public:
 
     /**
      * Return a Mat4f representing complete model transformation
-     * of this Transform.
+     * of this Transform. The result is cached until the Transform
+     * next changes.
      */
     Mat4f transformationMatrix () const;
 
@@ -90,45 +117,107 @@ public:
      * Return a Mat4f representing the view transformation (i.e.
      * components are applied in reverse order and the final Matrix is
      * inverted. Use this if you want to transform the camera/viewport.)
+     * The result is cached until the Transform next changes.
      */
     Mat4f viewTransformationMatrix () const;
+
+    /**
+     * Number of times a cached matrix had to be rebuilt, and number of
+     * times a rebuild was skipped because the cache was up to date.
+     * For profiling.
+     */
+    u32 matrixRebuilds () const { return mRebuilds; }
+
+    u32 matrixReuses () const { return mReuses; }
+
+    void resetMatrixStats () const;
+
+private:
+    void invalidate ();
+    const Mat4f &world () const;
+
+    Vec3f mPosition;
+    Quat4f mOrientation;
+    Vec3f mScale;
+
+    // Lazily rebuilt on read, so a const Transform must not be read from
+    // several threads at once.
+    mutable Mat4f mWorld;
+    mutable Mat4f mView;
+    mutable bool mWorldDirty;
+    mutable bool mViewDirty;
+    mutable u32 mRebuilds;
+    mutable u32 mReuses;
 };
 
 // --------------------------------------------------------------------------
 
+inline void Transform::invalidate () {
+    mWorldDirty = true;
+    mViewDirty = true;
+}
+
+inline void Transform::setPosition (const Vec3f &pPosition) {
+    mPosition = pPosition;
+    invalidate();
+}
+
+inline void Transform::setOrientation (const Quat4f &pOrientation) {
+    mOrientation = pOrientation;
+    invalidate();
+}
+
+inline void Transform::setScale (const Vec3f &pScale) {
+    mScale = pScale;
+    invalidate();
+}
+
+inline void Transform::translate (const Vec3f &offset) {
+    mPosition += offset;
+    invalidate();
+}
+
 inline void Transform::reset () {
-    position = Vec3f_Zero;
-    orientation = Quat4f_Identity;
-    scale = Vec3f_One;
+    mPosition = Vec3f_Zero;
+    mOrientation = Quat4f_Identity;
+    mScale = Vec3f_One;
+    invalidate();
+}
+
+inline void Transform::resetMatrixStats () const {
+    mRebuilds = 0;
+    mReuses = 0;
 }
 
 inline Vec3f Transform::up () const {
-    return orientation.rotate(Vec3f_Y);
+    return mOrientation.rotate(Vec3f_Y);
 }
 
 inline Vec3f Transform::forward () const {
-    return orientation.rotate(Vec3f_Z);
+    return mOrientation.rotate(Vec3f_Z);
 }
 
 inline Vec3f Transform::right () const {
-    return orientation.rotate(Vec3f_X);
+    return mOrientation.rotate(Vec3f_X);
 }
 
 inline void Transform::rotateL (const float angle, const Vec3f &axis) {
-    orientation *= Quat4f(angle, axis);
-    orientation.normalizeSelf();
+    mOrientation *= Quat4f(angle, axis);
+    mOrientation.normalizeSelf();
+    invalidate();
 }
 
 inline void Transform::rotateW (const float angle, const Vec3f &axis) {
-    orientation = Quat4f(angle, axis) * orientation;
-    orientation.normalizeSelf();
+    mOrientation = Quat4f(angle, axis) * mOrientation;
+    mOrientation.normalizeSelf();
+    invalidate();
 }
 
 inline Mat4f Transform::translationMatrix () const {
     return Mat4f(1.0f,       0.0f,       0.0f,       0.0f,
                  0.0f,       1.0f,       0.0f,       0.0f,
                  0.0f,       0.0f,       1.0f,       0.0f,
-                 position.x, position.y, position.z, 1.0f);
+                 mPosition.x, mPosition.y, mPosition.z, 1.0f);
 }
 
 inline Mat4f Transform::orientationMatrix () const {
@@ -145,18 +234,51 @@ inline Mat4f Transform::orientationMatrix () const {
 }
 
 inline Mat4f Transform::scaleMatrix () const {
-    return Mat4f(scale.x, 0.0f,    0.0f,    0.0f,
-                 0.0f,    scale.y, 0.0f,    0.0f,
-                 0.0f,    0.0f,    scale.z, 0.0f,
-                 0.0f,    0.0f,    0.0f,    1.0f);
+    return Mat4f(mScale.x, 0.0f,     0.0f,     0.0f,
+                 0.0f,     mScale.y, 0.0f,     0.0f,
+                 0.0f,     0.0f,     mScale.z, 0.0f,
+                 0.0f,     0.0f,     0.0f,     1.0f);
+}
+
+// translation * orientation * scale, built directly: the orientation
+// columns are the local axes, scaled per axis, and the translation is
+// the last column. Not counted in the matrix stats, so that rebuilding
+// the view matrix counts once.
+inline const Mat4f &Transform::world () const {
+    if (mWorldDirty) {
+        const Vec3f r = right() * mScale.x;
+        const Vec3f u = up() * mScale.y;
+        const Vec3f f = forward() * mScale.z;
+
+        mWorld = Mat4f(r.x,         r.y,         r.z,         0.0f,
+                       u.x,         u.y,         u.z,         0.0f,
+                       f.x,         f.y,         f.z,         0.0f,
+                       mPosition.x, mPosition.y, mPosition.z, 1.0f);
+        mWorldDirty = false;
+    }
+    return mWorld;
 }
 
 inline Mat4f Transform::transformationMatrix () const {
-    return translationMatrix() * orientationMatrix() * scaleMatrix();
+    if (mWorldDirty) {
+        ++mRebuilds;
+    } else {
+        ++mReuses;
+    }
+
+    return world();
 }
 
 inline Mat4f Transform::viewTransformationMatrix () const {
-    return transformationMatrix().inverse();
+    if (mViewDirty) {
+        mView = world().inverseOrthogonal();
+        mViewDirty = false;
+        ++mRebuilds;
+    } else {
+        ++mReuses;
+    }
+
+    return mView;
 }
 
 #endif /* __SGE_TRANSFORM_H */
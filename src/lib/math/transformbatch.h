@@ -0,0 +1,89 @@
+/*---  TransformBatch.h - Batch Vector Transforms  -----------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Transform whole arrays of vectors by a Mat4f.
+ *
+ * Inputs and outputs are StridedSpans so a member of an array of structs
+ * (e.g. Vertex::position) can be transformed in place without repacking.
+ * The SIMD kernels keep the matrix columns in registers for the whole
+ * array and evaluate one element per 128 bit register (two Vec4f per 256
+ * bit register under AVX).
+ *
+ * Passing threaded = true allows arrays larger than kTransformBatchGrain to
+ * be split across sge::workerCount() threads.
+ */
+#ifndef __SGE_TRANSFORMBATCH_H
+#define __SGE_TRANSFORMBATCH_H
+
+#include "../container/stridedspan.h"
+
+/** Smallest number of elements worth handing to another thread. */
+static constexpr size_t kTransformBatchGrain = 16384;
+
+/**
+ * Transform points by m, i.e. out[i] = (m * Vec4f(in[i], 1)).xyz().
+ * The bottom row of m is ignored, so there is no perspective divide.
+ *
+ * in and out must be the same size. They may be the same span but must
+ * not otherwise overlap.
+ */
+void transformPoints (const Mat4f &m, StridedSpan<const Vec3f> in,
+                      StridedSpan<Vec3f> out, const bool threaded = false);
+
+/**
+ * Transform points by m in place.
+ */
+void transformPoints (const Mat4f &m, StridedSpan<Vec3f> inOut,
+                      const bool threaded = false);
+
+/**
+ * Transform directions by m, i.e. out[i] = (m * Vec4f(in[i], 0)).xyz().
+ * Translation is ignored and the results are not renormalized. To
+ * transform normals under non-uniform scale, pass the inverse transpose.
+ *
+ * in and out must be the same size. They may be the same span but must
+ * not otherwise overlap.
+ */
+void transformDirections (const Mat4f &m, StridedSpan<const Vec3f> in,
+                          StridedSpan<Vec3f> out, const bool threaded = false);
+
+/**
+ * Transform directions by m in place.
+ */
+void transformDirections (const Mat4f &m, StridedSpan<Vec3f> inOut,
+                          const bool threaded = false);
+
+/**
+ * Transform homogeneous vectors by m, i.e. out[i] = m * in[i].
+ *
+ * in and out must be the same size. They may be the same span but must
+ * not otherwise overlap.
+ */
+void transformPoints (const Mat4f &m, StridedSpan<const Vec4f> in,
+                      StridedSpan<Vec4f> out, const bool threaded = false);
+
+/**
+ * Transform homogeneous vectors by m in place.
+ */
+void transformPoints (const Mat4f &m, StridedSpan<Vec4f> inOut,
+                      const bool threaded = false);
+
+/**
+ * Scalar reference implementations. Single threaded.
+ */
+void transformPointsScalar (const Mat4f &m, StridedSpan<const Vec3f> in,
+                            StridedSpan<Vec3f> out);
+
+void transformDirectionsScalar (const Mat4f &m, StridedSpan<const Vec3f> in,
+                                StridedSpan<Vec3f> out);
+
+void transformPointsScalar (const Mat4f &m, StridedSpan<const Vec4f> in,
+                            StridedSpan<Vec4f> out);
+
+#endif /* __SGE_TRANSFORMBATCH_H */
@@ -0,0 +1,158 @@
+//
+// Transform Hierarchy Implementation.
+//
+#include "../lib.h"
+
+#include "../util/parallel.h"
+
+#include <atomic>
+
+constexpr u32 TransformHierarchy::kNoParent;
+
+u32 TransformHierarchy::add (const Transform &local, const u32 parent) {
+    const u32 id = static_cast<u32>(mSlot.size());
+    const u32 slot = static_cast<u32>(mLocal.size());
+
+    u32 parentSlot = kNoParent;
+    u32 root = slot;
+    if (parent != kNoParent) {
+        verify(parent < mSlot.size());
+        parentSlot = mSlot[parent];
+        root = mRoot[parentSlot];
+
+        // Appending keeps each subtree contiguous only when the new node
+        // belongs to the last subtree.
+        if (root != mRoot.back()) {
+            mOrderDirty = true;
+        }
+    }
+
+    mLocal.push_back(local);
+    mWorld.push_back(Mat4f_Identity);
+    mParent.push_back(parentSlot);
+    mRoot.push_back(root);
+    mId.push_back(id);
+    mDirty.push_back(1);
+    mSlot.push_back(slot);
+
+    return id;
+}
+
+void TransformHierarchy::clear () {
+    mLocal.clear();
+    mWorld.clear();
+    mParent.clear();
+    mRoot.clear();
+    mId.clear();
+    mDirty.clear();
+    mSlot.clear();
+    mOrderDirty = false;
+    mLastUpdated = 0;
+}
+
+// Stable counting sort of the slots by root. Roots keep their relative
+// order, and so do the nodes within each subtree, so parents still come
+// before their children.
+void TransformHierarchy::reorder () {
+    const size_t n = mLocal.size();
+
+    // Subtree sizes, accumulated on the root slots, then turned into the
+    // first new slot of each subtree.
+    std::vector<u32> first(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        ++first[mRoot[i]];
+    }
+    u32 next = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (mRoot[i] == i) {
+            const u32 count = first[i];
+            first[i] = next;
+            next += count;
+        }
+    }
+
+    std::vector<u32> newSlot(n);
+    for (size_t i = 0; i < n; ++i) {
+        newSlot[i] = first[mRoot[i]]++;
+    }
+
+    std::vector<Transform> local(n);
+    std::vector<Mat4f> world(n);
+    std::vector<u32> parent(n), root(n), id(n);
+    std::vector<u8> dirty(n);
+    for (size_t i = 0; i < n; ++i) {
+        const u32 s = newSlot[i];
+        local[s] = mLocal[i];
+        world[s] = mWorld[i];
+        parent[s] = (mParent[i] == kNoParent) ? kNoParent : newSlot[mParent[i]];
+        root[s] = newSlot[mRoot[i]];
+        id[s] = mId[i];
+        dirty[s] = mDirty[i];
+        mSlot[mId[i]] = s;
+    }
+
+    mLocal.swap(local);
+    mWorld.swap(world);
+    mParent.swap(parent);
+    mRoot.swap(root);
+    mId.swap(id);
+    mDirty.swap(dirty);
+    mOrderDirty = false;
+}
+
+// Parents come first, so by the time a node is reached its parent's
+// dirty flag already includes every ancestor and its world matrix is up
+// to date. [begin, end) must not split a subtree.
+size_t TransformHierarchy::updateRange (const size_t begin, const size_t end) {
+    size_t updated = 0;
+
+    for (size_t i = begin; i < end; ++i) {
+        const u32 p = mParent[i];
+        if (p != kNoParent && mDirty[p]) {
+            mDirty[i] = 1;
+        }
+
+        if (mDirty[i]) {
+            mWorld[i] = (p == kNoParent) ? mLocal[i].transformationMatrix()
+                                         : mWorld[p] * mLocal[i].transformationMatrix();
+            ++updated;
+        }
+    }
+
+    // Flags are cleared afterwards, as descendants read them above.
+    for (size_t i = begin; i < end; ++i) {
+        mDirty[i] = 0;
+    }
+
+    return updated;
+}
+
+void TransformHierarchy::update (const bool threaded) {
+    if (mOrderDirty) {
+        reorder();
+    }
+
+    const size_t n = mLocal.size();
+    if (!threaded || n <= kTransformHierarchyGrain) {
+        mLastUpdated = updateRange(0, n);
+        return;
+    }
+
+    // Split evenly by node count, then move each boundary forward to the
+    // start of the next subtree. Neighbouring ranges move their shared
+    // boundary identically, so the ranges still tile [0, n).
+    const auto snap = [this, n](size_t i) {
+        while (i < n && mRoot[i] != i) {
+            ++i;
+        }
+        return i;
+    };
+
+    std::atomic<size_t> updated(0);
+    sge::parallelFor(n, kTransformHierarchyGrain,
+                     [&](const size_t begin, const size_t end) {
+        updated += updateRange(snap(begin), snap(end));
+    });
+
+    mLastUpdated = updated;
+}
@@ -0,0 +1,135 @@
+/*---  TransformHierarchy.h - Parent/Child Transforms  --------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief A flattened tree of Transforms with world matrix propagation.
+ *
+ * Local transforms, parent links and world matrices are held in parallel
+ * arrays, ordered so that every parent comes before its children and
+ * every root's subtree is contiguous. update() is then a single linear
+ * pass which only recomputes nodes whose local transform, or that of an
+ * ancestor, changed since the last update. Separate root subtrees can be
+ * updated on separate threads.
+ *
+ * Nodes are referred to by the id returned from add(), which stays valid
+ * when the arrays are reordered.
+ */
+#ifndef __SGE_TRANSFORMHIERARCHY_H
+#define __SGE_TRANSFORMHIERARCHY_H
+
+#include <vector>
+
+/** Smallest number of nodes worth handing to another thread. */
+static constexpr size_t kTransformHierarchyGrain = 4096;
+
+class TransformHierarchy {
+public:
+    /** Parent id of a root node. */
+    static constexpr u32 kNoParent = 0xFFFFFFFF;
+
+    TransformHierarchy () : mOrderDirty(false), mLastUpdated(0) { }
+
+    /**
+     * Add a node with the given local transform. parent must be the id
+     * of an existing node, or kNoParent to add a root.
+     * @return the id of the new node.
+     */
+    u32 add (const Transform &local, const u32 parent = kNoParent);
+
+    size_t size () const { return mLocal.size(); }
+
+    bool empty () const { return mLocal.empty(); }
+
+    /**
+     * Remove all nodes.
+     */
+    void clear ();
+
+    /**
+     * Get the id of the parent of node, or kNoParent for a root.
+     */
+    u32 parent (const u32 node) const;
+
+    const Transform& local (const u32 node) const { return mLocal[mSlot[node]]; }
+
+    /**
+     * Replace the local transform of node. It and its descendants are
+     * recomputed on the next update.
+     */
+    void setLocal (const u32 node, const Transform &local);
+
+    /**
+     * Get the local transform of node for modification. It and its
+     * descendants are recomputed on the next update.
+     */
+    Transform& modify (const u32 node);
+
+    /**
+     * Get the world matrix of node as of the last update().
+     */
+    const Mat4f& world (const u32 node) const { return mWorld[mSlot[node]]; }
+
+    /**
+     * Recompute the world matrices of changed nodes and their
+     * descendants. Passing threaded = true allows hierarchies larger than
+     * kTransformHierarchyGrain to be split across threads by root.
+     */
+    void update (const bool threaded = false);
+
+    /**
+     * Number of world matrices recomputed by the last update. For
+     * profiling.
+     */
+    size_t lastUpdated () const { return mLastUpdated; }
+
+private:
+    void markDirty (const u32 slot);
+
+    void reorder ();
+
+    size_t updateRange (const size_t begin, const size_t end);
+
+    // Indexed by slot, the position in the update order.
+    std::vector<Transform> mLocal;
+    std::vector<Mat4f> mWorld;
+    std::vector<u32> mParent;       // Slot of parent, or kNoParent.
+    std::vector<u32> mRoot;         // Slot of root.
+    std::vector<u32> mId;           // Id of the node in each slot.
+    std::vector<u8> mDirty;
+
+    // Indexed by id.
+    std::vector<u32> mSlot;
+
+    bool mOrderDirty;               // A root's subtree is not contiguous.
+    size_t mLastUpdated;
+};
+
+// --------------------------------------------------------------------------
+
+inline void TransformHierarchy::markDirty (const u32 slot) {
+    mDirty[slot] = 1;
+}
+
+inline u32 TransformHierarchy::parent (const u32 node) const {
+    const u32 p = mParent[mSlot[node]];
+
+    return (p == kNoParent) ? kNoParent : mId[p];
+}
+
+inline void TransformHierarchy::setLocal (const u32 node, const Transform &local) {
+    mLocal[mSlot[node]] = local;
+    markDirty(mSlot[node]);
+}
+
+inline Transform& TransformHierarchy::modify (const u32 node) {
+    markDirty(mSlot[node]);
+
+    return mLocal[mSlot[node]];
+}
+
+#endif /* __SGE_TRANSFORMHIERARCHY_H */
@@ -9,29 +9,29 @@
 // VECTOR 2
 //==================================
 
-const Vec2f Vec2f_Zero {0.0f};
-const Vec2f Vec2f_One  {1.0f};
-const Vec2f Vec2f_X    {1.0f, 0.0f};
-const Vec2f Vec2f_Y    {0.0f, 1.0f};
+constexpr Vec2f Vec2f_Zero {0.0f};
+constexpr Vec2f Vec2f_One  {1.0f};
+constexpr Vec2f Vec2f_X    {1.0f, 0.0f};
+constexpr Vec2f Vec2f_Y    {0.0f, 1.0f};
 
 //==================================
 // VECTOR 2i
 //==================================
 
-const Vec2i Vec2i_Zero {0};
-const Vec2i Vec2i_One  {1};
-const Vec2i Vec2i_X    {1, 0};
-const Vec2i Vec2i_Y    {0, 1};
+constexpr Vec2i Vec2i_Zero {0};
+constexpr Vec2i Vec2i_One  {1};
+constexpr Vec2i Vec2i_X    {1, 0};
+constexpr Vec2i Vec2i_Y    {0, 1};
 
 //==================================
 // VECTOR 3
 //==================================
 
-const Vec3f Vec3f_Zero {0.0f};
-const Vec3f Vec3f_One  {1.0f};
-const Vec3f Vec3f_X    {1.0f, 0.0f, 0.0f};
-const Vec3f Vec3f_Y    {0.0f, 1.0f, 0.0f};
-const Vec3f Vec3f_Z    {0.0f, 0.0f, 1.0f};
+constexpr Vec3f Vec3f_Zero {0.0f};
+constexpr Vec3f Vec3f_One  {1.0f};
+constexpr Vec3f Vec3f_X    {1.0f, 0.0f, 0.0f};
+constexpr Vec3f Vec3f_Y    {0.0f, 1.0f, 0.0f};
+constexpr Vec3f Vec3f_Z    {0.0f, 0.0f, 1.0f};
 
 
 Vec3f Vec3f::rotate (const float angle, const Vec3f &axis) const {
@@ -65,9 +65,9 @@ Vec3f Vec3f::random (const s32 seed) {
 // VECTOR 4
 //==================================
 
-const Vec4f Vec4f_Zero {0.0f};
-const Vec4f Vec4f_One  {1.0f};
-const Vec4f Vec4f_X    {1.0f, 0.0f, 0.0f, 0.0f};
-const Vec4f Vec4f_Y    {0.0f, 1.0f, 0.0f, 0.0f};
-const Vec4f Vec4f_Z    {0.0f, 0.0f, 1.0f, 0.0f};
-const Vec4f Vec4f_W    {0.0f, 0.0f, 0.0f, 1.0f};
+constexpr Vec4f Vec4f_Zero {0.0f};
+constexpr Vec4f Vec4f_One  {1.0f};
+constexpr Vec4f Vec4f_X    {1.0f, 0.0f, 0.0f, 0.0f};
+constexpr Vec4f Vec4f_Y    {0.0f, 1.0f, 0.0f, 0.0f};
+constexpr Vec4f Vec4f_Z    {0.0f, 0.0f, 1.0f, 0.0f};
+constexpr Vec4f Vec4f_W    {0.0f, 0.0f, 0.0f, 1.0f};
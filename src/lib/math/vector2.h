@@ -25,10 +25,10 @@ public:
     Vec2f () = default;
 
     /** Fill Constructor. */
-    explicit Vec2f (const float f) : x(f), y(f) { }
+    explicit constexpr Vec2f (const float f) : x(f), y(f) { }
 
     /** Construct a Vec2f using x, y coordinates. */
-    explicit Vec2f (const float xx, const float yy) : x(xx), y(yy) { }
+    explicit constexpr Vec2f (const float xx, const float yy) : x(xx), y(yy) { }
 
     /** Value access by index. */
     float operator[] (const std::size_t index) const;
@@ -40,7 +40,7 @@ public:
      * Set the values of x and y to 0.0f.
      * Destructive.
      */
-    void zero () { x = y = 0; }
+    constexpr void zero () { x = y = 0; }
 
     /**
      * Set the values of x and y.
@@ -49,14 +49,14 @@ public:
      * @param xx The X component
      * @param yy The Y component
      */
-    void set (const float xx, const float yy);
+    constexpr void set (const float xx, const float yy);
 
     /**
      * Get the squared magnitude of this Vec2f.
      *
      * @return The Vector's Length squared
      */
-    float magSq () const;
+    constexpr float magSq () const;
 
     /**
      * Get the magnitude of this Vec2f.
@@ -144,7 +144,7 @@ public:
      * @param min Vec2f minimum bound
      * @param max Vec2f maximum bound
      */
-    Vec2f clamp (const Vec2f &min, const Vec2f &max) const;
+    constexpr Vec2f clamp (const Vec2f &min, const Vec2f &max) const;
 
     /**
      * Clamp Vec2f within minimum and maximum bounds, given by other
@@ -154,21 +154,21 @@ public:
      * @param min Vec2f minimum bound
      * @param max Vec2f maximum bound
      */
-    void clampSelf (const Vec2f &min, const Vec2f &max);
+    constexpr void clampSelf (const Vec2f &min, const Vec2f &max);
 
     /**
      * Return the dot product of this Vec2f and another Vec2f.
      *
      * @return Vec2f Dot Product
      */
-    float dot (const Vec2f &rhs) const;
+    constexpr float dot (const Vec2f &rhs) const;
 
     /**
      * Return the cross product of this Vec2f and another Vec2f.
      *
      * @return Vec2f Cross Product
      */
-    float cross (const Vec2f &rhs) const;
+    constexpr float cross (const Vec2f &rhs) const;
 
     /**
      * Return the mirror of this Vec2f about an arbitrary axis.
@@ -176,14 +176,14 @@ public:
      * @param axis The axis of symmetry
      * @return Result of mirroring this Vec2f about axis
      */
-    Vec2f mirror (const Vec2f &axis) const;
+    constexpr Vec2f mirror (const Vec2f &axis) const;
 
     /**
      * Compare this Vec2f against another Vec2f.
      *
      * @return true if this Vec2f equals the other, false otherwise.
      */
-    bool compare (const Vec2f &other) const;
+    constexpr bool compare (const Vec2f &other) const;
 
     /**
      * Compare this Vec2f against another Vec2f within a given tolerance.
@@ -210,7 +210,7 @@ inline float &Vec2f::operator[] (const std::size_t index) {
     return (&x)[index];
 }
 
-inline void Vec2f::set (const float xx, const float yy) {
+inline constexpr void Vec2f::set (const float xx, const float yy) {
     x = xx;
     y = yy;
 }
@@ -220,43 +220,43 @@ inline void Vec2f::set (const float xx, const float yy) {
 //==========================
 
 /** Negate. */
-inline Vec2f operator- (const Vec2f &v) {
+inline constexpr Vec2f operator- (const Vec2f &v) {
     return Vec2f(-v.x, -v.y);
 }
 
 /** Multiply by scalar. */
-inline Vec2f operator* (const Vec2f &v, const float a) {
+inline constexpr Vec2f operator* (const Vec2f &v, const float a) {
     return Vec2f(a * v.x, a * v.y);
 }
 
 /** Multiply by scalar. */
-inline Vec2f operator* (const float a, const Vec2f &v) {
+inline constexpr Vec2f operator* (const float a, const Vec2f &v) {
     return Vec2f(a * v.x, a * v.y);
 }
 
 /** Piecewise multiplication. */
-inline Vec2f operator* (const Vec2f &a, const Vec2f &b) {
+inline constexpr Vec2f operator* (const Vec2f &a, const Vec2f &b) {
     return Vec2f(a.x * b.x, a.y * b.y);
 }
 
 /** Addition. */
-inline Vec2f operator+ (const Vec2f &a, const Vec2f &b) {
+inline constexpr Vec2f operator+ (const Vec2f &a, const Vec2f &b) {
     return Vec2f(a.x + b.x, a.y + b.y);
 }
 
 /** Subtraction. */
-inline Vec2f operator- (const Vec2f &a, const Vec2f &b) {
+inline constexpr Vec2f operator- (const Vec2f &a, const Vec2f &b) {
     return Vec2f(a.x - b.x, a.y - b.y);
 }
 
 /** Division. */
-inline Vec2f operator/ (const Vec2f &v, const float a) {
+inline constexpr Vec2f operator/ (const Vec2f &v, const float a) {
     float inva = 1.0f / a;
     return Vec2f(v.x * inva, v.y * inva);
 }
 
 /** Multiply by scalar in place. */
-inline Vec2f& operator*= (Vec2f &v, const float a) {
+inline constexpr Vec2f& operator*= (Vec2f &v, const float a) {
     v.x *= a;
     v.y *= a;
 
@@ -264,7 +264,7 @@ inline Vec2f& operator*= (Vec2f &v, const float a) {
 }
 
 /** Piecewise multiplication in place. */
-inline Vec2f& operator*= (Vec2f &a, const Vec2f &b) {
+inline constexpr Vec2f& operator*= (Vec2f &a, const Vec2f &b) {
     a.x *= b.x;
     a.y *= b.y;
 
@@ -272,7 +272,7 @@ inline Vec2f& operator*= (Vec2f &a, const Vec2f &b) {
 }
 
 /** Addition in place. */
-inline Vec2f& operator+= (Vec2f &a, const Vec2f &b) {
+inline constexpr Vec2f& operator+= (Vec2f &a, const Vec2f &b) {
     a.x += b.x;
     a.y += b.y;
 
@@ -280,7 +280,7 @@ inline Vec2f& operator+= (Vec2f &a, const Vec2f &b) {
 }
 
 /** Subtraction in place. */
-inline Vec2f& operator-= (Vec2f &a, const Vec2f &b) {
+inline constexpr Vec2f& operator-= (Vec2f &a, const Vec2f &b) {
     a.x -= b.x;
     a.y -= b.y;
 
@@ -288,7 +288,7 @@ inline Vec2f& operator-= (Vec2f &a, const Vec2f &b) {
 }
 
 /** Division in place. */
-inline Vec2f& operator/= (Vec2f &v, const float a) {
+inline constexpr Vec2f& operator/= (Vec2f &v, const float a) {
     float inva = 1.0f / a;
     v.x *= inva;
     v.y *= inva;
@@ -297,7 +297,7 @@ inline Vec2f& operator/= (Vec2f &v, const float a) {
 }
 
 /** Piecewise division in place. */
-inline Vec2f& operator/= (Vec2f &a, const Vec2f &b) {
+inline constexpr Vec2f& operator/= (Vec2f &a, const Vec2f &b) {
     a.x /= b.x;
     a.y /= b.y;
 
@@ -308,7 +308,7 @@ inline Vec2f& operator/= (Vec2f &a, const Vec2f &b) {
 // Vec2f Length Operators
 //==========================
 
-inline float Vec2f::magSq () const {
+inline constexpr float Vec2f::magSq () const {
     return x * x + y * y;
 }
 
@@ -388,25 +388,25 @@ inline void Vec2f::clampMagSelf (const float min, const float max) {
     }
 }
 
-inline Vec2f Vec2f::clamp (const Vec2f &min, const Vec2f &max) const {
+inline constexpr Vec2f Vec2f::clamp (const Vec2f &min, const Vec2f &max) const {
     return Vec2f(math::clamp(x, min.x, max.x),
                  math::clamp(y, min.y, max.y));
 }
 
-inline void Vec2f::clampSelf (const Vec2f &min, const Vec2f &max) {
+inline constexpr void Vec2f::clampSelf (const Vec2f &min, const Vec2f &max) {
     x = math::clamp(x, min.x, max.x);
     y = math::clamp(y, min.y, max.y);
 }
 
-inline float Vec2f::dot (const Vec2f &rhs) const {
+inline constexpr float Vec2f::dot (const Vec2f &rhs) const {
     return x * rhs.x + y * rhs.y;
 }
 
-inline float Vec2f::cross (const Vec2f &rhs) const {
+inline constexpr float Vec2f::cross (const Vec2f &rhs) const {
     return x * rhs.y - y * rhs.x;
 }
 
-inline Vec2f Vec2f::mirror (const Vec2f &axis) const {
+inline constexpr Vec2f Vec2f::mirror (const Vec2f &axis) const {
     return 2.0f * this->dot(axis) * axis - *this;
 }
 
@@ -414,7 +414,7 @@ inline Vec2f Vec2f::mirror (const Vec2f &axis) const {
 // Vec2f Comparisons
 //==========================
 
-inline bool Vec2f::compare (const Vec2f &other) const {
+inline constexpr bool Vec2f::compare (const Vec2f &other) const {
     return x == other.x && y == other.y;
 }
 
@@ -423,11 +423,11 @@ inline bool Vec2f::compare (const Vec2f &other, const float threshold) const {
            (fabsf(y - other.y) <= threshold);
 }
 
-inline bool operator== (const Vec2f &a, const Vec2f &b) {
+inline constexpr bool operator== (const Vec2f &a, const Vec2f &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Vec2f &a, const Vec2f &b) {
+inline constexpr bool operator!= (const Vec2f &a, const Vec2f &b) {
     return !a.compare(b);
 }
 
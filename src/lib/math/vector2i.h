@@ -25,10 +25,10 @@ public:
     Vec2i () = default;
 
     /** Fill Constructor. */
-    explicit Vec2i (const int f) : x(f), y(f) { }
+    explicit constexpr Vec2i (const int f) : x(f), y(f) { }
 
     /** Construct a Vec2i using x, y coordinates. */
-    explicit Vec2i (const int xx, const int yy) : x(xx), y(yy) { }
+    explicit constexpr Vec2i (const int xx, const int yy) : x(xx), y(yy) { }
 
     /** Value access by index. */
     int operator[] (const std::size_t index) const;
@@ -40,7 +40,7 @@ public:
      * Set the values of x and y to 0.0f.
      * Destructive.
      */
-    void zero () { x = y = 0; }
+    constexpr void zero () { x = y = 0; }
 
     /**
      * Set the values of x and y.
@@ -49,7 +49,7 @@ public:
      * @param xx The X component
      * @param yy The Y component
      */
-    void set (const int xx, const int yy);
+    constexpr void set (const int xx, const int yy);
 
 
     /**
@@ -58,7 +58,7 @@ public:
      * @return true if this Vec2i equals the other within given
      *         tolerance, false otherwise
      */
-    bool compare (const Vec2i &other) const;
+    constexpr bool compare (const Vec2i &other) const;
 };
 
 extern const Vec2i Vec2i_Zero;
@@ -76,7 +76,7 @@ inline int &Vec2i::operator[] (const std::size_t index) {
     return (&x)[index];
 }
 
-inline void Vec2i::set (const int xx, const int yy) {
+inline constexpr void Vec2i::set (const int xx, const int yy) {
     x = xx;
     y = yy;
 }
@@ -86,42 +86,42 @@ inline void Vec2i::set (const int xx, const int yy) {
 //==========================
 
 /** Negate. */
-inline Vec2i operator- (const Vec2i &v) {
+inline constexpr Vec2i operator- (const Vec2i &v) {
     return Vec2i(-v.x, -v.y);
 }
 
 /** Multiply by scalar. */
-inline Vec2i operator* (const Vec2i &v, const int a) {
+inline constexpr Vec2i operator* (const Vec2i &v, const int a) {
     return Vec2i(a * v.x, a * v.y);
 }
 
 /** Multiply by scalar. */
-inline Vec2i operator* (const int a, const Vec2i &v) {
+inline constexpr Vec2i operator* (const int a, const Vec2i &v) {
     return Vec2i(a * v.x, a * v.y);
 }
 
 /** Piecewise multiplication. */
-inline Vec2i operator* (const Vec2i &a, const Vec2i &b) {
+inline constexpr Vec2i operator* (const Vec2i &a, const Vec2i &b) {
     return Vec2i(a.x * b.x, a.y * b.y);
 }
 
 /** Addition. */
-inline Vec2i operator+ (const Vec2i &a, const Vec2i &b) {
+inline constexpr Vec2i operator+ (const Vec2i &a, const Vec2i &b) {
     return Vec2i(a.x + b.x, a.y + b.y);
 }
 
 /** Subtraction. */
-inline Vec2i operator- (const Vec2i &a, const Vec2i &b) {
+inline constexpr Vec2i operator- (const Vec2i &a, const Vec2i &b) {
     return Vec2i(a.x - b.x, a.y - b.y);
 }
 
 /** Division. */
-inline Vec2i operator/ (const Vec2i &v, const int a) {
+inline constexpr Vec2i operator/ (const Vec2i &v, const int a) {
     return Vec2i(v.x / a, v.y / a);
 }
 
 /** Multiply by scalar in place. */
-inline Vec2i& operator*= (Vec2i &v, const float a) {
+inline constexpr Vec2i& operator*= (Vec2i &v, const float a) {
     v.x *= a;
     v.y *= a;
 
@@ -129,7 +129,7 @@ inline Vec2i& operator*= (Vec2i &v, const float a) {
 }
 
 /** Piecewise multiplication in place. */
-inline Vec2i& operator*= (Vec2i &a, const Vec2i &b) {
+inline constexpr Vec2i& operator*= (Vec2i &a, const Vec2i &b) {
     a.x *= b.x;
     a.y *= b.y;
 
@@ -137,7 +137,7 @@ inline Vec2i& operator*= (Vec2i &a, const Vec2i &b) {
 }
 
 /** Addition in place. */
-inline Vec2i& operator+= (Vec2i &a, const Vec2i &b) {
+inline constexpr Vec2i& operator+= (Vec2i &a, const Vec2i &b) {
     a.x += b.x;
     a.y += b.y;
 
@@ -145,7 +145,7 @@ inline Vec2i& operator+= (Vec2i &a, const Vec2i &b) {
 }
 
 /** Subtraction in place. */
-inline Vec2i& operator-= (Vec2i &a, const Vec2i &b) {
+inline constexpr Vec2i& operator-= (Vec2i &a, const Vec2i &b) {
     a.x -= b.x;
     a.y -= b.y;
 
@@ -153,7 +153,7 @@ inline Vec2i& operator-= (Vec2i &a, const Vec2i &b) {
 }
 
 /** Division in place. */
-inline Vec2i& operator/= (Vec2i &v, const int a) {
+inline constexpr Vec2i& operator/= (Vec2i &v, const int a) {
     v.x /= a;
     v.y /= a;
 
@@ -161,7 +161,7 @@ inline Vec2i& operator/= (Vec2i &v, const int a) {
 }
 
 /** Piecewise division in place. */
-inline Vec2i& operator/= (Vec2i &a, const Vec2i &b) {
+inline constexpr Vec2i& operator/= (Vec2i &a, const Vec2i &b) {
     a.x /= b.x;
     a.y /= b.y;
 
@@ -172,19 +172,19 @@ inline Vec2i& operator/= (Vec2i &a, const Vec2i &b) {
 // Vec2i Comparisons
 //==========================
 
-inline bool Vec2i::compare (const Vec2i &other) const {
+inline constexpr bool Vec2i::compare (const Vec2i &other) const {
     return x == other.x && y == other.y;
 }
 
-inline bool operator== (const Vec2i &a, const Vec2i &b) {
+inline constexpr bool operator== (const Vec2i &a, const Vec2i &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Vec2i &a, const Vec2i &b) {
+inline constexpr bool operator!= (const Vec2i &a, const Vec2i &b) {
     return !a.compare(b);
 }
 
-inline bool operator< (const Vec2i &a, const Vec2i &b) {
+inline constexpr bool operator< (const Vec2i &a, const Vec2i &b) {
     return a.x < b.x || (a.x == b.x && a.y < b.y);
 }
 
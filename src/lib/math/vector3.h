@@ -28,11 +28,11 @@ public:
     Vec3f () = default;
 
     /** Fill Constructor. */
-    explicit Vec3f (const float f)
+    explicit constexpr Vec3f (const float f)
           : x(f), y(f), z(f) { }
 
     /** Construct a Vec3f using x, y, z coordinates. */
-    explicit Vec3f (const float xx, const float yy, const float zz)
+    explicit constexpr Vec3f (const float xx, const float yy, const float zz)
           : x(xx), y(yy), z(zz) { }
 
     /** Value access using an index. */
@@ -45,7 +45,7 @@ public:
      * Set the values of x, y, and z to 0.0f.
      * Destructive.
      */
-    void zero () { x = y = z = 0; }
+    constexpr void zero () { x = y = z = 0; }
 
     /**
      * Set the values of x, y, and z.
@@ -55,14 +55,14 @@ public:
      * @param yy The Y component
      * @param zz The Z component
      */
-    void Set (const float xx, const float yy, const float zz);
+    constexpr void Set (const float xx, const float yy, const float zz);
 
     /**
      * Get the squared magnitude of this Vec3f.
      *
      * @return The Vector's magnitude squared
      */
-    float magSq () const;
+    constexpr float magSq () const;
 
     /**
      * Get the magnitude of this Vec3f.
@@ -147,7 +147,7 @@ public:
      * @param min Vec3f minimum bound
      * @param max Vec3f maximum bound
      */
-    Vec3f clamp (const Vec3f &min, const Vec3f &max) const;
+    constexpr Vec3f clamp (const Vec3f &min, const Vec3f &max) const;
 
     /**
      * Clamp Vec3f within minimum and maximum bounds, given by other
@@ -157,14 +157,14 @@ public:
      * @param min Vec3f minimum bound
      * @param max Vec3f maximum bound
      */
-    void clampSelf (const Vec3f &min, const Vec3f &max);
+    constexpr void clampSelf (const Vec3f &min, const Vec3f &max);
 
     /**
      * Return the dot product of this Vec3f and another Vec3f.
      *
      * @return Vec3f Dot Product
      */
-    float dot (const Vec3f &rhs) const;
+    constexpr float dot (const Vec3f &rhs) const;
 
     /**
      * Return the cross product of this Vec3f and another Vec3f. The
@@ -182,7 +182,7 @@ public:
      *
      * @return Vec2f Cross Product
      */
-    Vec3f cross (const Vec3f &rhs) const;
+    constexpr Vec3f cross (const Vec3f &rhs) const;
 
     /**
      * Return the mirror of this Vec3f about an arbitrary axis.
@@ -190,7 +190,7 @@ public:
      * @param axis The axis of symmetry
      * @return Result of mirroring this Vec3f about axis
      */
-    Vec3f mirror (const Vec3f &axis) const;
+    constexpr Vec3f mirror (const Vec3f &axis) const;
 
     /**
      * Return the result of rotation this Vec3f by an angle around an
@@ -215,16 +215,16 @@ public:
     static Vec3f random (const s32 seed);
 
     /** Swizzling */
-    Vec2f xy () const { return Vec2f(x, y); }
-    Vec2f xz () const { return Vec2f(x, z); }
-    Vec2f yz () const { return Vec2f(y, z); }
+    constexpr Vec2f xy () const { return Vec2f(x, y); }
+    constexpr Vec2f xz () const { return Vec2f(x, z); }
+    constexpr Vec2f yz () const { return Vec2f(y, z); }
 
     /**
      * Compare this Vec3f against another Vec3f.
      *
      * @return true if this Vec3f equals the other, false otherwise.
      */
-    bool compare (const Vec3f &other) const;
+    constexpr bool compare (const Vec3f &other) const;
 
     /**
      * Compare this Vec3f against another Vec3f within a given tolerance.
@@ -245,7 +245,7 @@ extern const Vec3f Vec3f_Z;
 
 // --------------------------------------------------------------------------
 
-inline void Vec3f::Set (const float xx, const float yy, const float zz) {
+inline constexpr void Vec3f::Set (const float xx, const float yy, const float zz) {
     x = xx;
     y = yy;
     z = zz;
@@ -256,43 +256,43 @@ inline void Vec3f::Set (const float xx, const float yy, const float zz) {
 //==========================
 
 /** Negate. */
-inline Vec3f operator- (const Vec3f &v) {
+inline constexpr Vec3f operator- (const Vec3f &v) {
     return Vec3f(-v.x, -v.y, -v.z);
 }
 
 /** Multiply by scalar. */
-inline Vec3f operator* (const Vec3f &v, const float a) {
+inline constexpr Vec3f operator* (const Vec3f &v, const float a) {
     return Vec3f(a * v.x, a * v.y, a * v.z);
 }
 
 /** Multiply by scalar. */
-inline Vec3f operator* (const float a, const Vec3f &v) {
+inline constexpr Vec3f operator* (const float a, const Vec3f &v) {
     return Vec3f(a * v.x, a * v.y, a * v.z);
 }
 
 /** Piecewise multiplication. */
-inline Vec3f operator* (const Vec3f &a, const Vec3f &b) {
+inline constexpr Vec3f operator* (const Vec3f &a, const Vec3f &b) {
     return Vec3f(a.x * b.x, a.y * b.y, a.z * b.z);
 }
 
 /** Addition. */
-inline Vec3f operator+ (const Vec3f &a, const Vec3f &b) {
+inline constexpr Vec3f operator+ (const Vec3f &a, const Vec3f &b) {
     return Vec3f(a.x + b.x, a.y + b.y, a.z + b.z);
 }
 
 /** Subtraction. */
-inline Vec3f operator- (const Vec3f &a, const Vec3f &b) {
+inline constexpr Vec3f operator- (const Vec3f &a, const Vec3f &b) {
     return Vec3f(a.x - b.x, a.y - b.y, a.z - b.z);
 }
 
 /** Division. */
-inline Vec3f operator/ (const Vec3f &v, const float a) {
+inline constexpr Vec3f operator/ (const Vec3f &v, const float a) {
     float inva = 1.0f / a;
     return Vec3f(v.x * inva, v.y * inva, v.z * inva);
 }
 
 /** Multiply by scalar in place. */
-inline Vec3f& operator*= (Vec3f &v, const float a) {
+inline constexpr Vec3f& operator*= (Vec3f &v, const float a) {
     v.x *= a;
     v.y *= a;
     v.z *= a;
@@ -301,7 +301,7 @@ inline Vec3f& operator*= (Vec3f &v, const float a) {
 }
 
 /** Piecewise multiplication in place. */
-inline Vec3f& operator*= (Vec3f &a, const Vec3f &b) {
+inline constexpr Vec3f& operator*= (Vec3f &a, const Vec3f &b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
@@ -310,7 +310,7 @@ inline Vec3f& operator*= (Vec3f &a, const Vec3f &b) {
 }
 
 /** Addition in place. */
-inline Vec3f& operator+= (Vec3f &a, const Vec3f &b) {
+inline constexpr Vec3f& operator+= (Vec3f &a, const Vec3f &b) {
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
@@ -319,7 +319,7 @@ inline Vec3f& operator+= (Vec3f &a, const Vec3f &b) {
 }
 
 /** Subtraction in place. */
-inline Vec3f& operator-= (Vec3f &a, const Vec3f &b) {
+inline constexpr Vec3f& operator-= (Vec3f &a, const Vec3f &b) {
     a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
@@ -328,7 +328,7 @@ inline Vec3f& operator-= (Vec3f &a, const Vec3f &b) {
 }
 
 /** Division in place. */
-inline Vec3f& operator/= (Vec3f &v, const float a) {
+inline constexpr Vec3f& operator/= (Vec3f &v, const float a) {
     float inva = 1.0f / a;
     v.x *= inva;
     v.y *= inva;
@@ -338,7 +338,7 @@ inline Vec3f& operator/= (Vec3f &v, const float a) {
 }
 
 /** Piecewise division in place. */
-inline Vec3f& operator/= (Vec3f &a, const Vec3f &b) {
+inline constexpr Vec3f& operator/= (Vec3f &a, const Vec3f &b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
@@ -350,7 +350,7 @@ inline Vec3f& operator/= (Vec3f &a, const Vec3f &b) {
 // Vec3f Length Operators
 //==========================
 
-inline float Vec3f::magSq () const {
+inline constexpr float Vec3f::magSq () const {
     return x * x + y * y + z * z;
 }
 
@@ -431,30 +431,30 @@ inline void Vec3f::clampMagSelf (const float min, const float max) {
     }
 }
 
-inline Vec3f Vec3f::clamp (const Vec3f &min, const Vec3f &max) const {
+inline constexpr Vec3f Vec3f::clamp (const Vec3f &min, const Vec3f &max) const {
     return Vec3f(math::clamp(x, min.x, max.x),
                  math::clamp(y, min.y, max.y),
                  math::clamp(z, min.z, max.z));
 }
 
-inline void Vec3f::clampSelf (const Vec3f &min, const Vec3f &max) {
+inline constexpr void Vec3f::clampSelf (const Vec3f &min, const Vec3f &max) {
     x = math::clamp(x, min.x, max.x);
     y = math::clamp(y, min.y, max.y);
     z = math::clamp(z, min.z, max.z);
 }
 
 // Dot product.
-inline float Vec3f::dot (const Vec3f &rhs) const {
+inline constexpr float Vec3f::dot (const Vec3f &rhs) const {
     return x * rhs.x + y * rhs.y + z * rhs.z;
 }
 
 // Vec3f Cross Product.
-inline Vec3f Vec3f::cross (const Vec3f &rhs) const {
+inline constexpr Vec3f Vec3f::cross (const Vec3f &rhs) const {
     return Vec3f(y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z,
                  x * rhs.y - y * rhs.x);
 }
 
-inline Vec3f Vec3f::mirror (const Vec3f &axis) const {
+inline constexpr Vec3f Vec3f::mirror (const Vec3f &axis) const {
     return 2.0f * this->dot(axis) * axis - *this;
 }
 
@@ -462,7 +462,7 @@ inline Vec3f Vec3f::mirror (const Vec3f &axis) const {
 // Vec3f Comparison
 //==========================
 
-inline bool Vec3f::compare (const Vec3f &other) const {
+inline constexpr bool Vec3f::compare (const Vec3f &other) const {
     return x == other.x && y == other.y && z == other.z;
 }
 
@@ -472,11 +472,11 @@ inline bool Vec3f::compare (const Vec3f &other, const float threshold) const {
            (fabsf(z - other.z) <= threshold);
 }
 
-inline bool operator== (const Vec3f &a, const Vec3f &b) {
+inline constexpr bool operator== (const Vec3f &a, const Vec3f &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Vec3f &a, const Vec3f &b) {
+inline constexpr bool operator!= (const Vec3f &a, const Vec3f &b) {
     return !a.compare(b);
 }
 
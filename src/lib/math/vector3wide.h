@@ -0,0 +1,534 @@
+/*---  Vector3Wide.h - SoA 3D Vector Header  -----------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Defines Vec3x4 and Vec3x8, structure of arrays counterparts of
+ * Vec3f which hold 4 or 8 vectors and operate on all of them at once.
+ *
+ * Typical use is to gather a block of Vec3f from an array, do the math on
+ * whole blocks, and scatter the results back:
+ *
+ * <pre>
+ *   for (size_t i = 0; i < v.size(); i += Vec3x8::kWidth) {
+ *       Vec3x8::gather(v, i).normalize().scatter(v, i);
+ *   }
+ * </pre>
+ */
+#ifndef __SGE_VECTOR3WIDE_H
+#define __SGE_VECTOR3WIDE_H
+
+#include "../container/stridedspan.h"
+
+/**
+ * SoA 3D Vector. F is the lane type, Floatx4 or Floatx8.
+ */
+template <typename F>
+class Vec3Wide {
+public:
+    static constexpr int kWidth = F::kWidth;
+
+    F x; /**< x coordinate of each lane. */
+    F y; /**< y coordinate of each lane. */
+    F z; /**< z coordinate of each lane. */
+
+public:
+    /** Default Constructor. All lanes 0. */
+    Vec3Wide () = default;
+
+    /** Fill Constructor. Every lane set to v. */
+    explicit Vec3Wide (const Vec3f &v)
+          : x(v.x), y(v.y), z(v.z) { }
+
+    /** Construct from x, y, z lanes. */
+    explicit Vec3Wide (const F &xx, const F &yy, const F &zz)
+          : x(xx), y(yy), z(zz) { }
+
+    /**
+     * Load lanes from src[first] onwards. Lanes past the end of src
+     * are set to 0.
+     */
+    static Vec3Wide gather (StridedSpan<const Vec3f> src, const size_t first);
+
+    /**
+     * Load lane i from src[indices[i]], for the first count lanes. The
+     * remaining lanes are set to 0.
+     */
+    static Vec3Wide gatherIndexed (StridedSpan<const Vec3f> src, const u32 *indices,
+                                   const size_t count = kWidth);
+
+    /**
+     * Store lanes to dst[first] onwards. Lanes past the end of dst are
+     * discarded.
+     */
+    void scatter (StridedSpan<Vec3f> dst, const size_t first) const;
+
+    /**
+     * Store lane i to dst[indices[i]], for the first count lanes. If an
+     * index repeats, the highest lane wins.
+     */
+    void scatterIndexed (StridedSpan<Vec3f> dst, const u32 *indices,
+                         const size_t count = kWidth) const;
+
+    /** Get lane i as a Vec3f. Slow; for tests and debugging. */
+    Vec3f lane (const size_t i) const;
+
+    /**
+     * Get the squared magnitude of each lane.
+     */
+    F magSq () const;
+
+    /**
+     * Get the magnitude of each lane.
+     */
+    F mag () const;
+
+    /**
+     * Set the magnitude of each lane to 1.0f, maintaining direction.
+     * Lanes with magnitude 0.0f are left as they are.
+     *
+     * @return New normalized Vec3Wide
+     */
+    Vec3Wide normalize () const;
+
+    /**
+     * Set the magnitude of each lane to 1.0f, maintaining direction.
+     * Lanes with magnitude 0.0f are left as they are.
+     * Destructive.
+     */
+    void normalizeSelf ();
+
+    /**
+     * Return the dot product of each lane with the same lane of rhs.
+     */
+    F dot (const Vec3Wide &rhs) const;
+
+    /**
+     * Return the cross product of each lane with the same lane of rhs.
+     */
+    Vec3Wide cross (const Vec3Wide &rhs) const;
+
+    /**
+     * Linear interpolation from each lane to the same lane of other. As
+     * math::lerp, each lane of ratio is clamped to [0, 1].
+     */
+    Vec3Wide lerp (const Vec3Wide &other, const F &ratio) const;
+
+    /**
+     * Linear interpolation from each lane to the same lane of other, by
+     * the same ratio. The ratio is clamped to [0, 1].
+     */
+    Vec3Wide lerp (const Vec3Wide &other, const float ratio) const;
+};
+
+typedef Vec3Wide<Floatx4> Vec3x4;
+typedef Vec3Wide<Floatx8> Vec3x8;
+
+// --------------------------------------------------------------------------
+
+//==========================
+// Lane Transposes
+//==========================
+
+// Load the Vec3f at s[first + i] into lane i of x, y, z, and the reverse.
+// The whole block must be in range.
+//
+// Tightly packed Vec3f are moved as three full registers per 4 elements
+// ([x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]) and deinterleaved with five
+// shuffles (six to interleave). Strided elements are moved one at a time.
+
+#if SGE_SIMD_SSE
+
+// Deinterleave/interleave 4 packed Vec3f in each 128 bit lane of m0..m2.
+#define SGE_VEC3_DEINTERLEAVE(shuffle, m0, m1, m2, x, y, z)                     \
+    do {                                                                        \
+        const auto xy = shuffle(m1, m2, _MM_SHUFFLE(2, 1, 3, 2));               \
+        const auto yz = shuffle(m0, m1, _MM_SHUFFLE(1, 0, 2, 1));               \
+        x = shuffle(m0, xy, _MM_SHUFFLE(2, 0, 3, 0));                           \
+        y = shuffle(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));                           \
+        z = shuffle(yz, m2, _MM_SHUFFLE(3, 0, 3, 1));                           \
+    } while (false)
+
+#define SGE_VEC3_INTERLEAVE(shuffle, x, y, z, m0, m1, m2)                       \
+    do {                                                                        \
+        const auto rxy = shuffle(x, y, _MM_SHUFFLE(2, 0, 2, 0));                \
+        const auto ryz = shuffle(y, z, _MM_SHUFFLE(3, 1, 3, 1));                \
+        const auto rzx = shuffle(z, x, _MM_SHUFFLE(3, 1, 2, 0));                \
+        m0 = shuffle(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));                        \
+        m1 = shuffle(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));                        \
+        m2 = shuffle(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));                        \
+    } while (false)
+
+inline void gatherLanes (StridedSpan<const Vec3f> s, const size_t first,
+                         Floatx4 &x, Floatx4 &y, Floatx4 &z) {
+    if (s.isContiguous()) {
+        const float *p = &s[first].x;
+        const __m128 m0 = _mm_loadu_ps(p);
+        const __m128 m1 = _mm_loadu_ps(p + 4);
+        const __m128 m2 = _mm_loadu_ps(p + 8);
+        SGE_VEC3_DEINTERLEAVE(_mm_shuffle_ps, m0, m1, m2, x.v, y.v, z.v);
+        return;
+    }
+
+    const __m128 r0 = simd::load3(&s[first + 0].x);
+    const __m128 r1 = simd::load3(&s[first + 1].x);
+    const __m128 r2 = simd::load3(&s[first + 2].x);
+    const __m128 r3 = simd::load3(&s[first + 3].x);
+
+    const __m128 t0 = _mm_unpacklo_ps(r0, r1);
+    const __m128 t1 = _mm_unpackhi_ps(r0, r1);
+    const __m128 t2 = _mm_unpacklo_ps(r2, r3);
+    const __m128 t3 = _mm_unpackhi_ps(r2, r3);
+    x = _mm_movelh_ps(t0, t2);
+    y = _mm_movehl_ps(t2, t0);
+    z = _mm_movelh_ps(t1, t3);
+}
+
+inline void scatterLanes (StridedSpan<Vec3f> s, const size_t first,
+                          const Floatx4 &x, const Floatx4 &y, const Floatx4 &z) {
+    if (s.isContiguous()) {
+        float *p = &s[first].x;
+        __m128 m0, m1, m2;
+        SGE_VEC3_INTERLEAVE(_mm_shuffle_ps, x.v, y.v, z.v, m0, m1, m2);
+        _mm_storeu_ps(p, m0);
+        _mm_storeu_ps(p + 4, m1);
+        _mm_storeu_ps(p + 8, m2);
+        return;
+    }
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 u0 = _mm_unpacklo_ps(x.v, y.v);
+    const __m128 u1 = _mm_unpackhi_ps(x.v, y.v);
+    const __m128 u2 = _mm_unpacklo_ps(z.v, zero);
+    const __m128 u3 = _mm_unpackhi_ps(z.v, zero);
+
+    simd::store3(&s[first + 0].x, _mm_movelh_ps(u0, u2));
+    simd::store3(&s[first + 1].x, _mm_movehl_ps(u2, u0));
+    simd::store3(&s[first + 2].x, _mm_movelh_ps(u1, u3));
+    simd::store3(&s[first + 3].x, _mm_movehl_ps(u3, u1));
+}
+
+#else
+
+inline void gatherLanes (StridedSpan<const Vec3f> s, const size_t first,
+                         Floatx4 &x, Floatx4 &y, Floatx4 &z) {
+    x = Floatx4(s[first + 0].x, s[first + 1].x, s[first + 2].x, s[first + 3].x);
+    y = Floatx4(s[first + 0].y, s[first + 1].y, s[first + 2].y, s[first + 3].y);
+    z = Floatx4(s[first + 0].z, s[first + 1].z, s[first + 2].z, s[first + 3].z);
+}
+
+inline void scatterLanes (StridedSpan<Vec3f> s, const size_t first,
+                          const Floatx4 &x, const Floatx4 &y, const Floatx4 &z) {
+    float t[3][4];
+    x.store(t[0]);
+    y.store(t[1]);
+    z.store(t[2]);
+
+    for (int i = 0; i < 4; ++i) {
+        s[first + i].Set(t[0][i], t[1][i], t[2][i]);
+    }
+}
+
+#endif /* SGE_SIMD_SSE */
+
+#if SGE_SIMD_AVX
+
+inline void gatherLanes (StridedSpan<const Vec3f> s, const size_t first,
+                         Floatx8 &x, Floatx8 &y, Floatx8 &z) {
+    if (s.isContiguous()) {
+        // Elements 0-3 in the low half, 4-7 in the high half.
+        const float *p = &s[first].x;
+        const __m256 m0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)),
+                                               _mm_loadu_ps(p + 12), 1);
+        const __m256 m1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)),
+                                               _mm_loadu_ps(p + 16), 1);
+        const __m256 m2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)),
+                                               _mm_loadu_ps(p + 20), 1);
+        SGE_VEC3_DEINTERLEAVE(_mm256_shuffle_ps, m0, m1, m2, x.v, y.v, z.v);
+        return;
+    }
+
+    // Element k in the low half, k + 4 in the high half.
+    const __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(simd::load3(&s[first + 0].x)),
+                                           simd::load3(&s[first + 4].x), 1);
+    const __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(simd::load3(&s[first + 1].x)),
+                                           simd::load3(&s[first + 5].x), 1);
+    const __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(simd::load3(&s[first + 2].x)),
+                                           simd::load3(&s[first + 6].x), 1);
+    const __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(simd::load3(&s[first + 3].x)),
+                                           simd::load3(&s[first + 7].x), 1);
+
+    const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    x = _mm256_shuffle_ps(t0, t2, 0x44);
+    y = _mm256_shuffle_ps(t0, t2, 0xEE);
+    z = _mm256_shuffle_ps(t1, t3, 0x44);
+}
+
+inline void scatterLanes (StridedSpan<Vec3f> s, const size_t first,
+                          const Floatx8 &x, const Floatx8 &y, const Floatx8 &z) {
+    if (s.isContiguous()) {
+        float *p = &s[first].x;
+        __m256 m0, m1, m2;
+        SGE_VEC3_INTERLEAVE(_mm256_shuffle_ps, x.v, y.v, z.v, m0, m1, m2);
+        _mm_storeu_ps(p, _mm256_castps256_ps128(m0));
+        _mm_storeu_ps(p + 4, _mm256_castps256_ps128(m1));
+        _mm_storeu_ps(p + 8, _mm256_castps256_ps128(m2));
+        _mm_storeu_ps(p + 12, _mm256_extractf128_ps(m0, 1));
+        _mm_storeu_ps(p + 16, _mm256_extractf128_ps(m1, 1));
+        _mm_storeu_ps(p + 20, _mm256_extractf128_ps(m2, 1));
+        return;
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 u0 = _mm256_unpacklo_ps(x.v, y.v);
+    const __m256 u1 = _mm256_unpackhi_ps(x.v, y.v);
+    const __m256 u2 = _mm256_unpacklo_ps(z.v, zero);
+    const __m256 u3 = _mm256_unpackhi_ps(z.v, zero);
+    const __m256 o0 = _mm256_shuffle_ps(u0, u2, 0x44);
+    const __m256 o1 = _mm256_shuffle_ps(u0, u2, 0xEE);
+    const __m256 o2 = _mm256_shuffle_ps(u1, u3, 0x44);
+    const __m256 o3 = _mm256_shuffle_ps(u1, u3, 0xEE);
+
+    simd::store3(&s[first + 0].x, _mm256_castps256_ps128(o0));
+    simd::store3(&s[first + 1].x, _mm256_castps256_ps128(o1));
+    simd::store3(&s[first + 2].x, _mm256_castps256_ps128(o2));
+    simd::store3(&s[first + 3].x, _mm256_castps256_ps128(o3));
+    simd::store3(&s[first + 4].x, _mm256_extractf128_ps(o0, 1));
+    simd::store3(&s[first + 5].x, _mm256_extractf128_ps(o1, 1));
+    simd::store3(&s[first + 6].x, _mm256_extractf128_ps(o2, 1));
+    simd::store3(&s[first + 7].x, _mm256_extractf128_ps(o3, 1));
+}
+
+#else
+
+inline void gatherLanes (StridedSpan<const Vec3f> s, const size_t first,
+                         Floatx8 &x, Floatx8 &y, Floatx8 &z) {
+    Floatx4 lx, ly, lz, hx, hy, hz;
+    gatherLanes(s, first, lx, ly, lz);
+    gatherLanes(s, first + 4, hx, hy, hz);
+
+    x = Floatx8(lx, hx);
+    y = Floatx8(ly, hy);
+    z = Floatx8(lz, hz);
+}
+
+inline void scatterLanes (StridedSpan<Vec3f> s, const size_t first,
+                          const Floatx8 &x, const Floatx8 &y, const Floatx8 &z) {
+    scatterLanes(s, first, x.lo, y.lo, z.lo);
+    scatterLanes(s, first + 4, x.hi, y.hi, z.hi);
+}
+
+#endif /* SGE_SIMD_AVX */
+
+#if SGE_SIMD_SSE
+ #undef SGE_VEC3_DEINTERLEAVE
+ #undef SGE_VEC3_INTERLEAVE
+#endif
+
+//==========================
+// Vec3Wide Gather/Scatter
+//==========================
+
+template <typename F>
+inline Vec3Wide<F> Vec3Wide<F>::gather (StridedSpan<const Vec3f> src, const size_t first) {
+    Vec3Wide r;
+    if (first + kWidth <= src.size()) {
+        gatherLanes(src, first, r.x, r.y, r.z);
+    } else {
+        // Partial block: pad with zeros.
+        Vec3f tmp[kWidth];
+        for (size_t i = first; i < src.size(); ++i) {
+            tmp[i - first] = src[i];
+        }
+        gatherLanes(StridedSpan<const Vec3f>(tmp, kWidth), 0, r.x, r.y, r.z);
+    }
+    return r;
+}
+
+template <typename F>
+inline Vec3Wide<F> Vec3Wide<F>::gatherIndexed (StridedSpan<const Vec3f> src, const u32 *indices,
+                                               const size_t count) {
+    Vec3f tmp[kWidth];
+    for (size_t i = 0; i < count; ++i) {
+        tmp[i] = src[indices[i]];
+    }
+
+    Vec3Wide r;
+    gatherLanes(StridedSpan<const Vec3f>(tmp, kWidth), 0, r.x, r.y, r.z);
+    return r;
+}
+
+template <typename F>
+inline void Vec3Wide<F>::scatter (StridedSpan<Vec3f> dst, const size_t first) const {
+    if (first + kWidth <= dst.size()) {
+        scatterLanes(dst, first, x, y, z);
+    } else {
+        Vec3f tmp[kWidth];
+        scatterLanes(StridedSpan<Vec3f>(tmp, kWidth), 0, x, y, z);
+        for (size_t i = first; i < dst.size(); ++i) {
+            dst[i] = tmp[i - first];
+        }
+    }
+}
+
+template <typename F>
+inline void Vec3Wide<F>::scatterIndexed (StridedSpan<Vec3f> dst, const u32 *indices,
+                                         const size_t count) const {
+    Vec3f tmp[kWidth];
+    scatterLanes(StridedSpan<Vec3f>(tmp, kWidth), 0, x, y, z);
+    for (size_t i = 0; i < count; ++i) {
+        dst[indices[i]] = tmp[i];
+    }
+}
+
+template <typename F>
+inline Vec3f Vec3Wide<F>::lane (const size_t i) const {
+    return Vec3f(x[i], y[i], z[i]);
+}
+
+//==========================
+// Vec3Wide Operators
+//==========================
+
+/** Negate. */
+template <typename F>
+inline Vec3Wide<F> operator- (const Vec3Wide<F> &v) {
+    return Vec3Wide<F>(-v.x, -v.y, -v.z);
+}
+
+/** Multiply each lane by the same lane of a. */
+template <typename F>
+inline Vec3Wide<F> operator* (const Vec3Wide<F> &v, const F &a) {
+    return Vec3Wide<F>(v.x * a, v.y * a, v.z * a);
+}
+
+/** Multiply each lane by the same lane of a. */
+template <typename F>
+inline Vec3Wide<F> operator* (const F &a, const Vec3Wide<F> &v) {
+    return Vec3Wide<F>(v.x * a, v.y * a, v.z * a);
+}
+
+/** Multiply by scalar. */
+template <typename F>
+inline Vec3Wide<F> operator* (const Vec3Wide<F> &v, const float a) {
+    return v * F(a);
+}
+
+/** Multiply by scalar. */
+template <typename F>
+inline Vec3Wide<F> operator* (const float a, const Vec3Wide<F> &v) {
+    return v * F(a);
+}
+
+/** Piecewise multiplication. */
+template <typename F>
+inline Vec3Wide<F> operator* (const Vec3Wide<F> &a, const Vec3Wide<F> &b) {
+    return Vec3Wide<F>(a.x * b.x, a.y * b.y, a.z * b.z);
+}
+
+/** Addition. */
+template <typename F>
+inline Vec3Wide<F> operator+ (const Vec3Wide<F> &a, const Vec3Wide<F> &b) {
+    return Vec3Wide<F>(a.x + b.x, a.y + b.y, a.z + b.z);
+}
+
+/** Subtraction. */
+template <typename F>
+inline Vec3Wide<F> operator- (const Vec3Wide<F> &a, const Vec3Wide<F> &b) {
+    return Vec3Wide<F>(a.x - b.x, a.y - b.y, a.z - b.z);
+}
+
+/** Divide each lane by the same lane of a. */
+template <typename F>
+inline Vec3Wide<F> operator/ (const Vec3Wide<F> &v, const F &a) {
+    const F inva = F(1.0f) / a;
+    return Vec3Wide<F>(v.x * inva, v.y * inva, v.z * inva);
+}
+
+/** Division by scalar. */
+template <typename F>
+inline Vec3Wide<F> operator/ (const Vec3Wide<F> &v, const float a) {
+    return v * F(1.0f / a);
+}
+
+/** Multiply each lane by the same lane of a in place. */
+template <typename F>
+inline Vec3Wide<F> &operator*= (Vec3Wide<F> &v, const F &a) {
+    return v = v * a;
+}
+
+/** Multiply by scalar in place. */
+template <typename F>
+inline Vec3Wide<F> &operator*= (Vec3Wide<F> &v, const float a) {
+    return v = v * F(a);
+}
+
+/** Addition in place. */
+template <typename F>
+inline Vec3Wide<F> &operator+= (Vec3Wide<F> &a, const Vec3Wide<F> &b) {
+    return a = a + b;
+}
+
+/** Subtraction in place. */
+template <typename F>
+inline Vec3Wide<F> &operator-= (Vec3Wide<F> &a, const Vec3Wide<F> &b) {
+    return a = a - b;
+}
+
+//==========================
+// Vec3Wide Length Operators
+//==========================
+
+template <typename F>
+inline F Vec3Wide<F>::magSq () const {
+    return madd(z, z, madd(y, y, x * x));
+}
+
+template <typename F>
+inline F Vec3Wide<F>::mag () const {
+    return sqrt(magSq());
+}
+
+template <typename F>
+inline Vec3Wide<F> Vec3Wide<F>::normalize () const {
+    const F m = mag();
+    const F one = F(1.0f);
+    return *this * select(cmpEq(m, F(0.0f)), one, one / m);
+}
+
+template <typename F>
+inline void Vec3Wide<F>::normalizeSelf () {
+    *this = normalize();
+}
+
+template <typename F>
+inline F Vec3Wide<F>::dot (const Vec3Wide &rhs) const {
+    return madd(z, rhs.z, madd(y, rhs.y, x * rhs.x));
+}
+
+template <typename F>
+inline Vec3Wide<F> Vec3Wide<F>::cross (const Vec3Wide &rhs) const {
+    return Vec3Wide(y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z,
+                    x * rhs.y - y * rhs.x);
+}
+
+template <typename F>
+inline Vec3Wide<F> Vec3Wide<F>::lerp (const Vec3Wide &other, const F &ratio) const {
+    const F t = min(max(ratio, F(0.0f)), F(1.0f));
+    return Vec3Wide(madd(other.x - x, t, x), madd(other.y - y, t, y),
+                    madd(other.z - z, t, z));
+}
+
+template <typename F>
+inline Vec3Wide<F> Vec3Wide<F>::lerp (const Vec3Wide &other, const float ratio) const {
+    return lerp(other, F(ratio));
+}
+
+#endif /* __SGE_VECTOR3WIDE_H */
@@ -27,14 +27,14 @@ public:
     Vec4f () = default;
 
     /** Fill Constructor. */
-    explicit Vec4f (const float f) : x(f), y(f), z(f), w(f) { }
+    explicit constexpr Vec4f (const float f) : x(f), y(f), z(f), w(f) { }
 
     /** Construct a Vec4f using x, y, z, w coordinates. */
-    explicit Vec4f (const float xx, const float yy, const float zz, const float ww)
+    explicit constexpr Vec4f (const float xx, const float yy, const float zz, const float ww)
         : x(xx), y(yy), z(zz), w(ww) { }
 
     /** Construct a Vec4f using the x,y,z components of a Vec3f. */
-    Vec4f (const Vec3f &vec, const float ww) : x(vec.x), y(vec.y), z(vec.z), w(ww) { }
+    constexpr Vec4f (const Vec3f &vec, const float ww) : x(vec.x), y(vec.y), z(vec.z), w(ww) { }
 
     /** Value access using an index. */
     float operator[] (const std::size_t index) const { return (&x)[index]; }
@@ -46,7 +46,7 @@ public:
      * Set the values of x, y, z, and w to 0.0f.
      * Destructive.
      */
-    void zero () { x = y = z = w = 0; }
+    constexpr void zero () { x = y = z = w = 0; }
 
     /**
      * Set the values of x, y, z, and w.
@@ -57,13 +57,13 @@ public:
      * @param zz The Z component
      * @param ww The W component
      */
-    void set (const float xx, const float yy, const float zz, const float ww);
+    constexpr void set (const float xx, const float yy, const float zz, const float ww);
 
     /**
      * Get the squared magnitude of this Vec4f.
      * @return The Vector's Length squared
      */
-    float magSq () const;
+    constexpr float magSq () const;
 
     /**
      * Get the magnitude of this Vec4f.
@@ -146,7 +146,7 @@ public:
      * @param min Vec4f minimum bound
      * @param max Vec4f maximum bound
      */
-    Vec4f clamp (const Vec4f &min, const Vec4f &max) const;
+    constexpr Vec4f clamp (const Vec4f &min, const Vec4f &max) const;
 
     /**
      * Clamp Vec4f within minimum and maximum bounds, given by other
@@ -155,22 +155,22 @@ public:
      * @param min Vec4f minimum bound
      * @param max Vec4f maximum bound
      */
-    void clampSelf (const Vec4f &min, const Vec4f &max);
+    constexpr void clampSelf (const Vec4f &min, const Vec4f &max);
 
-    float Dot (const Vec4f &rhs) const;
+    constexpr float Dot (const Vec4f &rhs) const;
 
     /** Swizzling */
-    Vec3f xyz () const { return Vec3f(x, y, z); }
-    Vec2f  xy () const { return Vec2f(x, y); }
-    Vec2f  xz () const { return Vec2f(x, z); }
-    Vec2f  yz () const { return Vec2f(y, z); }
+    constexpr Vec3f xyz () const { return Vec3f(x, y, z); }
+    constexpr Vec2f  xy () const { return Vec2f(x, y); }
+    constexpr Vec2f  xz () const { return Vec2f(x, z); }
+    constexpr Vec2f  yz () const { return Vec2f(y, z); }
 
     /**
      * Compare this Vec4f against another Vec4f exactly.
      *
      * @return true if this Vec4f exactly equals the other, false otherwise
      */
-    bool compare (const Vec4f &other) const;
+    constexpr bool compare (const Vec4f &other) const;
 
     /**
      * Compare this Vec4f against another Vec4f within a given tolerance.
@@ -191,8 +191,8 @@ extern const Vec4f Vec4f_W;
 
 // --------------------------------------------------------------------------
 
-inline void Vec4f::set (const float xx, const float yy, const float zz,
-                        const float ww) {
+inline constexpr void Vec4f::set (const float xx, const float yy, const float zz,
+                                  const float ww) {
     x = xx;
     y = yy;
     z = zz;
@@ -204,43 +204,43 @@ inline void Vec4f::set (const float xx, const float yy, const float zz,
 //==========================
 
 /** Negate. */
-inline Vec4f operator- (const Vec4f &v) {
+inline constexpr Vec4f operator- (const Vec4f &v) {
     return Vec4f(-v.x, -v.y, -v.z, -v.w);
 }
 
 /** Multiply by scalar. */
-inline Vec4f operator* (const Vec4f &v, const float a) {
+inline constexpr Vec4f operator* (const Vec4f &v, const float a) {
     return Vec4f(a * v.x, a * v.y, a * v.z, a * v.w);
 }
 
 /** Multiply by scalar. */
-inline Vec4f operator* (const float a, const Vec4f &v) {
+inline constexpr Vec4f operator* (const float a, const Vec4f &v) {
     return Vec4f(a * v.x, a * v.y, a * v.z, a * v.w);
 }
 
 /** Piecewise multiplication. */
-inline Vec4f operator* (const Vec4f &a, const Vec4f &b) {
+inline constexpr Vec4f operator* (const Vec4f &a, const Vec4f &b) {
     return Vec4f(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
 }
 
 /** Addition. */
-inline Vec4f operator+ (const Vec4f &a, const Vec4f &b) {
+inline constexpr Vec4f operator+ (const Vec4f &a, const Vec4f &b) {
     return Vec4f(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
 }
 
 /** Subtraction. */
-inline Vec4f operator- (const Vec4f &a, const Vec4f &b) {
+inline constexpr Vec4f operator- (const Vec4f &a, const Vec4f &b) {
     return Vec4f(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
 }
 
 /** Division. */
-inline Vec4f operator/ (const Vec4f &v, const float a) {
+inline constexpr Vec4f operator/ (const Vec4f &v, const float a) {
     float inva = 1.0f / a;
     return Vec4f(v.x * inva, v.y * inva, v.z * inva, v.w * inva);
 }
 
 /** Multiply by scalar in place. */
-inline Vec4f& operator*= (Vec4f &v, const float a) {
+inline constexpr Vec4f& operator*= (Vec4f &v, const float a) {
     v.x *= a;
     v.y *= a;
     v.z *= a;
@@ -250,7 +250,7 @@ inline Vec4f& operator*= (Vec4f &v, const float a) {
 }
 
 /** Piecewise multiplication in place. */
-inline Vec4f& operator*= (Vec4f &a, const Vec4f &b) {
+inline constexpr Vec4f& operator*= (Vec4f &a, const Vec4f &b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
@@ -260,7 +260,7 @@ inline Vec4f& operator*= (Vec4f &a, const Vec4f &b) {
 }
 
 /** Addition in place. */
-inline Vec4f& operator+= (Vec4f &a, const Vec4f &b) {
+inline constexpr Vec4f& operator+= (Vec4f &a, const Vec4f &b) {
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
@@ -270,7 +270,7 @@ inline Vec4f& operator+= (Vec4f &a, const Vec4f &b) {
 }
 
 /** Subtraction in place. */
-inline Vec4f& operator-= (Vec4f &a, const Vec4f &b) {
+inline constexpr Vec4f& operator-= (Vec4f &a, const Vec4f &b) {
     a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
@@ -280,7 +280,7 @@ inline Vec4f& operator-= (Vec4f &a, const Vec4f &b) {
 }
 
 /** Division in place. */
-inline Vec4f& operator/= (Vec4f &v, const float a) {
+inline constexpr Vec4f& operator/= (Vec4f &v, const float a) {
     float inva = 1.0f / a;
     v.x *= inva;
     v.y *= inva;
@@ -291,7 +291,7 @@ inline Vec4f& operator/= (Vec4f &v, const float a) {
 }
 
 /** Piecewise division in place. */
-inline Vec4f& operator/= (Vec4f &a, const Vec4f &b) {
+inline constexpr Vec4f& operator/= (Vec4f &a, const Vec4f &b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
@@ -304,7 +304,7 @@ inline Vec4f& operator/= (Vec4f &a, const Vec4f &b) {
 // Vec4f Length Operators
 //==========================
 
-inline float Vec4f::magSq () const {
+inline constexpr float Vec4f::magSq () const {
     return x * x + y * y + z * z + w * w;
 }
 
@@ -385,14 +385,14 @@ inline void Vec4f::clampMagSelf (const float min, const float max) {
     }
 }
 
-inline Vec4f Vec4f::clamp (const Vec4f &min, const Vec4f &max) const {
+inline constexpr Vec4f Vec4f::clamp (const Vec4f &min, const Vec4f &max) const {
     return Vec4f(math::clamp(x, min.x, max.x),
                  math::clamp(y, min.y, max.y),
                  math::clamp(z, min.z, max.z),
                  math::clamp(w, min.w, max.w));
 }
 
-inline void Vec4f::clampSelf (const Vec4f &min, const Vec4f &max) {
+inline constexpr void Vec4f::clampSelf (const Vec4f &min, const Vec4f &max) {
     x = math::clamp(x, min.x, max.x);
     y = math::clamp(y, min.y, max.y);
     z = math::clamp(z, min.z, max.z);
@@ -400,7 +400,7 @@ inline void Vec4f::clampSelf (const Vec4f &min, const Vec4f &max) {
 }
 
 // Dot product.
-inline float Vec4f::Dot (const Vec4f &rhs) const {
+inline constexpr float Vec4f::Dot (const Vec4f &rhs) const {
     return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w;
 }
 
@@ -410,7 +410,7 @@ inline float Vec4f::Dot (const Vec4f &rhs) const {
 
 // This comparison may be inaccurate, prefer Compare(val, threshold)
 // where possible.
-inline bool Vec4f::compare (const Vec4f &other) const {
+inline constexpr bool Vec4f::compare (const Vec4f &other) const {
     return x == other.x && y == other.y && z == other.z && w == other.w;
 }
 
@@ -421,11 +421,11 @@ inline bool Vec4f::compare (const Vec4f &other, const float threshold) const {
            fabsf(w - other.w) <= threshold;
 }
 
-inline bool operator== (const Vec4f &a, const Vec4f &b) {
+inline constexpr bool operator== (const Vec4f &a, const Vec4f &b) {
     return a.compare(b);
 }
 
-inline bool operator!= (const Vec4f &a, const Vec4f &b) {
+inline constexpr bool operator!= (const Vec4f &a, const Vec4f &b) {
     return !a.compare(b);
 }
 
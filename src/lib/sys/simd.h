@@ -0,0 +1,160 @@
+/*---  Simd.h - SIMD backend selection  ----------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Selects the vector instruction set used by the math kernels.
+ *
+ * The backend is chosen at compile time from the target flags (e.g.
+ * -msse4.1, -mavx, -march=native). Every SIMD kernel has a scalar
+ * reference implementation which is used when no backend is available,
+ * or when SGE_NO_SIMD is defined.
+ *
+ * Each SGE_SIMD_* macro is always defined as 0 or 1 so it is safe to test
+ * with #if under -Wundef.
+ */
+#ifndef __SGE_SIMD_H
+#define __SGE_SIMD_H
+
+#if !defined(SGE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+ #define SGE_SIMD_SSE 1
+#else
+ #define SGE_SIMD_SSE 0
+#endif
+
+#if SGE_SIMD_SSE && defined(__SSE4_1__)
+ #define SGE_SIMD_SSE41 1
+#else
+ #define SGE_SIMD_SSE41 0
+#endif
+
+#if SGE_SIMD_SSE && defined(__AVX__)
+ #define SGE_SIMD_AVX 1
+#else
+ #define SGE_SIMD_AVX 0
+#endif
+
+#if SGE_SIMD_AVX && defined(__AVX2__)
+ #define SGE_SIMD_AVX2 1
+#else
+ #define SGE_SIMD_AVX2 0
+#endif
+
+#if SGE_SIMD_SSE && defined(__FMA__)
+ #define SGE_SIMD_FMA 1
+#else
+ #define SGE_SIMD_FMA 0
+#endif
+
+#if !defined(SGE_NO_SIMD) && !SGE_SIMD_SSE && defined(__ARM_NEON)
+ #define SGE_SIMD_NEON 1
+#else
+ #define SGE_SIMD_NEON 0
+#endif
+
+#if SGE_SIMD_SSE
+ #include <immintrin.h>
+#elif SGE_SIMD_NEON
+ #include <arm_neon.h>
+#endif
+
+namespace simd {
+
+/** Name of the widest backend compiled in, for logs and benchmarks. */
+constexpr const char *kBackend = SGE_SIMD_AVX  ? "avx"
+                               : SGE_SIMD_SSE  ? "sse"
+                               : SGE_SIMD_NEON ? "neon"
+                               : "scalar";
+
+#if SGE_SIMD_SSE
+
+/** a * b + c, fused when the target has FMA. */
+inline __m128 madd (const __m128 a, const __m128 b, const __m128 c) {
+#if SGE_SIMD_FMA
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+/** Broadcast lane n of v to all lanes. */
+#define SGE_SPLAT(v, n) _mm_shuffle_ps((v), (v), _MM_SHUFFLE(n, n, n, n))
+
+/**
+ * Weighted sum of four column vectors, using the lanes of w as the
+ * weights: c0 * w.x + c1 * w.y + c2 * w.z + c3 * w.w.
+ */
+inline __m128 combine4 (const __m128 c0, const __m128 c1, const __m128 c2,
+                        const __m128 c3, const __m128 w) {
+    __m128 r = _mm_mul_ps(c0, SGE_SPLAT(w, 0));
+    r = madd(c1, SGE_SPLAT(w, 1), r);
+    r = madd(c2, SGE_SPLAT(w, 2), r);
+    return madd(c3, SGE_SPLAT(w, 3), r);
+}
+
+/** Load 3 floats into lanes x, y, z without reading past p[2]. */
+inline __m128 load3 (const float *p) {
+    __m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(p));
+    return _mm_movelh_ps(xy, _mm_load_ss(p + 2));
+}
+
+/** Store lanes x, y, z without writing past p[2]. */
+inline void store3 (float *p, const __m128 v) {
+    _mm_storel_pi(reinterpret_cast<__m64 *>(p), v);
+    _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+}
+
+#endif /* SGE_SIMD_SSE */
+
+#if SGE_SIMD_AVX
+
+/** a * b + c, fused when the target has FMA. */
+inline __m256 madd (const __m256 a, const __m256 b, const __m256 c) {
+#if SGE_SIMD_FMA
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+
+/**
+ * combine4 on two sets of weights at once: each 128 bit half of w weights
+ * the columns (duplicated in both halves of c0..c3) independently.
+ */
+inline __m256 combine4 (const __m256 c0, const __m256 c1, const __m256 c2,
+                        const __m256 c3, const __m256 w) {
+    __m256 r = _mm256_mul_ps(c0, _mm256_shuffle_ps(w, w, 0x00));
+    r = madd(c1, _mm256_shuffle_ps(w, w, 0x55), r);
+    r = madd(c2, _mm256_shuffle_ps(w, w, 0xAA), r);
+    return madd(c3, _mm256_shuffle_ps(w, w, 0xFF), r);
+}
+
+/** Copy a 128 bit vector into both halves of a 256 bit vector. */
+inline __m256 dup128 (const __m128 v) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(v), v, 1);
+}
+
+#endif /* SGE_SIMD_AVX */
+
+#if SGE_SIMD_NEON
+
+/** Load 3 floats into lanes x, y, z without reading past p[2]. */
+inline float32x4_t load3 (const float *p) {
+    return vcombine_f32(vld1_f32(p), vld1_dup_f32(p + 2));
+}
+
+/** Store lanes x, y, z without writing past p[2]. */
+inline void store3 (float *p, const float32x4_t v) {
+    vst1_f32(p, vget_low_f32(v));
+    vst1q_lane_f32(p + 2, v, 2);
+}
+
+#endif /* SGE_SIMD_NEON */
+
+} /* namespace simd */
+
+#endif /* __SGE_SIMD_H */
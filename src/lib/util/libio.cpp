@@ -92,18 +92,18 @@ std::ostream& operator<< (std::ostream &os, const Transform &tr) {
     Vec3f up = tr.up();
     Vec3f f = tr.forward();
     Vec3f r = tr.right();
-    bool uniScale = ((tr.scale.x == tr.scale.y) && (tr.scale.x == tr.scale.z));
+    bool uniScale = ((tr.scale().x == tr.scale().y) && (tr.scale().x == tr.scale().z));
 
-    os << "<transform P=" << tr.position
+    os << "<transform P=" << tr.position()
        << " O=[" << f.x << " " << f.y << " " << f.z
        << "|" << up.x << " " << up.y << " " << up.z
        << "|" << r.x << " " << r.y << " " << r.z
        << "] S=";
 
     if (uniScale) {
-        os << tr.scale.x;
+        os << tr.scale().x;
     } else {
-        os << tr.scale;
+        os << tr.scale();
     }
     os << ">";
     return os;
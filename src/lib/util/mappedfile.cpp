@@ -0,0 +1,94 @@
+//
+// MappedFile Implementation.
+//
+#include "../lib.h"
+
+#if defined(_WIN32)
+#include <cstdio>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sge {
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile (const char * const filename)
+      : mData{nullptr}, mSize{0}, mOpen{false}, mMapped{false} {
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        return;
+    }
+
+    if (fseek(file, 0, SEEK_END) == 0) {
+        const long size = ftell(file);
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0) {
+            char *buffer = new char[size];
+            if (fread(buffer, 1, size, file) == static_cast<size_t>(size)) {
+                mData = buffer;
+                mSize = static_cast<size_t>(size);
+                mOpen = true;
+            } else {
+                delete[] buffer;
+            }
+        } else if (size == 0) {
+            mOpen = true;
+        }
+    }
+    fclose(file);
+}
+
+void MappedFile::close () {
+    delete[] mData;
+    mData = nullptr;
+    mSize = 0;
+    mOpen = false;
+}
+
+#else
+
+MappedFile::MappedFile (const char * const filename)
+      : mData{nullptr}, mSize{0}, mOpen{false}, mMapped{false} {
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        if (info.st_size == 0) {
+            // Zero length mappings are an error, but an empty file isn't.
+            mOpen = true;
+        } else {
+            void *map = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED) {
+#if defined(MADV_SEQUENTIAL)
+                madvise(map, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+#endif
+                mData = static_cast<const char *>(map);
+                mSize = static_cast<size_t>(info.st_size);
+                mOpen = true;
+                mMapped = true;
+            }
+        }
+    }
+    // The mapping holds its own reference to the file.
+    ::close(fd);
+}
+
+void MappedFile::close () {
+    if (mMapped) {
+        munmap(const_cast<char *>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+    mOpen = false;
+    mMapped = false;
+}
+
+#endif /* defined(_WIN32) */
+
+} /* namespace sge */
@@ -0,0 +1,117 @@
+/*---  MappedFile.h - Read Only Memory Mapped Files  ----------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Map a whole file into memory for reading.
+ *
+ * Parsers can then scan the file's bytes in place, without copying them
+ * through stream buffers or into strings first. Where memory mapping is
+ * unavailable the file is read into a single heap buffer instead.
+ */
+#ifndef __SGE_MAPPEDFILE_H
+#define __SGE_MAPPEDFILE_H
+
+namespace sge {
+
+/**
+ * The contents of a file, mapped read only for the lifetime of the
+ * object. Movable but not copyable.
+ */
+class MappedFile {
+public:
+    /** No file. */
+    MappedFile ();
+
+    /**
+     * Map filename. Check isOpen() to see whether it succeeded.
+     */
+    explicit MappedFile (const char * const filename);
+
+    ~MappedFile ();
+
+    MappedFile (MappedFile &&other);
+    MappedFile &operator= (MappedFile &&other);
+
+    MappedFile (const MappedFile &) = delete;
+    MappedFile &operator= (const MappedFile &) = delete;
+
+    /**
+     * @return True if the file was opened. An empty file is open, with
+     *   a size of 0.
+     */
+    bool isOpen () const;
+
+    /**
+     * @return The first byte of the file. The contents are not null
+     *   terminated.
+     */
+    const char *data () const;
+
+    /**
+     * @return Size of the file in bytes.
+     */
+    size_t size () const;
+
+    /** Unmap the file, leaving this object without one. */
+    void close ();
+
+private:
+    const char *mData;
+    size_t mSize;
+    bool mOpen;
+    bool mMapped; // mData is a mapping rather than a heap buffer.
+};
+
+// --------------------------------------------------------------------------
+
+inline MappedFile::MappedFile ()
+      : mData{nullptr}, mSize{0}, mOpen{false}, mMapped{false} {
+}
+
+inline MappedFile::~MappedFile () {
+    close();
+}
+
+inline MappedFile::MappedFile (MappedFile &&other)
+      : mData{other.mData}, mSize{other.mSize}, mOpen{other.mOpen}, mMapped{other.mMapped} {
+    other.mData = nullptr;
+    other.mSize = 0;
+    other.mOpen = false;
+    other.mMapped = false;
+}
+
+inline MappedFile &MappedFile::operator= (MappedFile &&other) {
+    if (this != &other) {
+        close();
+        mData = other.mData;
+        mSize = other.mSize;
+        mOpen = other.mOpen;
+        mMapped = other.mMapped;
+        other.mData = nullptr;
+        other.mSize = 0;
+        other.mOpen = false;
+        other.mMapped = false;
+    }
+    return *this;
+}
+
+inline bool MappedFile::isOpen () const {
+    return mOpen;
+}
+
+inline const char *MappedFile::data () const {
+    return mData;
+}
+
+inline size_t MappedFile::size () const {
+    return mSize;
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_MAPPEDFILE_H */
@@ -0,0 +1,53 @@
+//
+// Parallel Helpers Implementation.
+//
+#include "../lib.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace sge {
+
+u32 workerCount () {
+    static const u32 count = std::max(std::thread::hardware_concurrency(), 1u);
+    return count;
+}
+
+void parallelFor (const size_t count, const size_t grain,
+                  const std::function<void (size_t, size_t)> &fn) {
+    if (count == 0) {
+        return;
+    }
+
+    const size_t g = std::max(grain, static_cast<size_t>(1));
+    const size_t ranges = std::min(static_cast<size_t>(workerCount()),
+                                   (count + g - 1) / g);
+    if (ranges <= 1) {
+        fn(0, count);
+        return;
+    }
+
+    // Even split, with the remainder spread one item at a time over the
+    // first ranges. Range 0 runs on this thread.
+    const size_t base = count / ranges;
+    const size_t extra = count % ranges;
+
+    std::vector<std::thread> threads;
+    threads.reserve(ranges - 1);
+
+    size_t begin = base + (extra > 0 ? 1 : 0);
+    for (size_t r = 1; r < ranges; ++r) {
+        const size_t end = begin + base + (r < extra ? 1 : 0);
+        threads.emplace_back(fn, begin, end);
+        begin = end;
+    }
+
+    fn(0, base + (extra > 0 ? 1 : 0));
+
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+} /* namespace sge */
@@ -0,0 +1,40 @@
+/*---  Parallel.h - Data Parallel Helpers  -------------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Split a range of work across the hardware threads.
+ */
+#ifndef __SGE_PARALLEL_H
+#define __SGE_PARALLEL_H
+
+#include <functional>
+
+namespace sge {
+
+/**
+ * Number of threads parallelFor will spread work across. At least 1.
+ */
+u32 workerCount ();
+
+/**
+ * Split [0, count) into contiguous ranges of at least grain items and call
+ * fn(begin, end) once for each range. Ranges run concurrently on up to
+ * workerCount() threads, one of which is the calling thread. Returns once
+ * every range has completed.
+ *
+ * When count is no more than grain, or only one worker is available, fn is
+ * called once on the calling thread with the whole range.
+ *
+ * fn must be safe to call concurrently on disjoint ranges.
+ */
+void parallelFor (size_t count, size_t grain,
+                  const std::function<void (size_t, size_t)> &fn);
+
+} /* namespace sge */
+
+#endif /* __SGE_PARALLEL_H */
@@ -0,0 +1,175 @@
+//
+// Scanner Implementation.
+//
+#include "../lib.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace sge {
+
+// Powers of ten exactly representable as doubles.
+static const double kExactPow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+static constexpr s32 kMaxExactPow10 = 22;
+static constexpr u64 kMaxExactMantissa = u64(1) << 53;
+static constexpr u32 kMaxMantissaDigits = 19;
+
+// The 29 bits of a double's mantissa below a float's 23, and their value
+// halfway between two floats.
+static constexpr u64 kFloatDroppedBits = (u64(1) << 29) - 1;
+static constexpr u64 kFloatHalfway = u64(1) << 28;
+
+static inline bool isDigit (const char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Parse with strtof from a null terminated copy of [begin, end).
+static const char *slowParseFloat (const char *begin, const char *end, float &out) {
+    const size_t len = static_cast<size_t>(end - begin);
+    char buffer[64];
+    std::string heap;
+    char *text = buffer;
+    if (len >= sizeof(buffer)) {
+        heap.assign(begin, len);
+        text = &heap[0];
+    } else {
+        memcpy(buffer, begin, len);
+        buffer[len] = '\0';
+    }
+
+    char *stop = nullptr;
+    const float f = strtof(text, &stop);
+    if (stop == text) {
+        return nullptr;
+    }
+    out = f;
+    return begin + (stop - text);
+}
+
+const char *parseFloat (const char *begin, const char *end, float &out) {
+    const char *p = begin;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    u64 mantissa = 0;
+    u32 digits = 0; // Significant digits in mantissa.
+    s32 exponent = 0;
+    bool truncated = false;
+    const char *first = p;
+
+    for (; p < end && isDigit(*p); ++p) {
+        if (digits < kMaxMantissaDigits) {
+            mantissa = mantissa * 10 + static_cast<u64>(*p - '0');
+            digits += (mantissa != 0) ? 1 : 0;
+        } else {
+            ++exponent;
+            truncated |= (*p != '0');
+        }
+    }
+    bool any = (p != first);
+
+    if (p < end && *p == '.') {
+        ++p;
+        const char *fraction = p;
+        for (; p < end && isDigit(*p); ++p) {
+            if (digits < kMaxMantissaDigits) {
+                mantissa = mantissa * 10 + static_cast<u64>(*p - '0');
+                digits += (mantissa != 0) ? 1 : 0;
+                --exponent;
+            } else {
+                truncated |= (*p != '0');
+            }
+        }
+        any |= (p != fraction);
+    }
+
+    if (!any) {
+        // Maybe inf or nan, which are short. Anything else isn't a number;
+        // strtof would skip whitespace, even past the end of the line.
+        if (first == end || (*first != 'i' && *first != 'I' && *first != 'n' && *first != 'N')) {
+            return nullptr;
+        }
+        return slowParseFloat(begin, (end - begin > 16) ? begin + 16 : end, out);
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *e = p + 1;
+        bool negativeExp = false;
+        if (e < end && (*e == '-' || *e == '+')) {
+            negativeExp = (*e == '-');
+            ++e;
+        }
+        if (e < end && isDigit(*e)) {
+            s32 value = 0;
+            for (; e < end && isDigit(*e); ++e) {
+                if (value < 100000) {
+                    value = value * 10 + (*e - '0');
+                }
+            }
+            exponent += negativeExp ? -value : value;
+            p = e;
+        }
+        // Otherwise the 'e' isn't part of the number.
+    }
+
+    if (truncated || mantissa > kMaxExactMantissa ||
+        exponent < -kMaxExactPow10 || exponent > kMaxExactPow10) {
+        if (mantissa == 0 && !truncated) {
+            out = negative ? -0.0f : 0.0f;
+            return p;
+        }
+        return slowParseFloat(begin, p, out);
+    }
+
+    // Both operands are exact, so the one rounding gives the correctly
+    // rounded double. Every float, and every point halfway between two,
+    // is a double, so the number and d are on the same side of each
+    // halfway point unless d is one; only then can rounding d to float
+    // differ from rounding the number.
+    double d = static_cast<double>(mantissa);
+    d = (exponent < 0) ? d / kExactPow10[-exponent] : d * kExactPow10[exponent];
+    u64 bits;
+    memcpy(&bits, &d, sizeof(bits));
+    if ((bits & kFloatDroppedBits) == kFloatHalfway) {
+        return slowParseFloat(begin, p, out);
+    }
+    out = static_cast<float>(negative ? -d : d);
+    return p;
+}
+
+const char *parseInt (const char *begin, const char *end, s32 &out) {
+    const char *p = begin;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    if (p >= end || !isDigit(*p)) {
+        return nullptr;
+    }
+
+    s64 value = 0;
+    for (; p < end && isDigit(*p); ++p) {
+        value = value * 10 + (*p - '0');
+        if (value > 0x80000000LL) {
+            return nullptr;
+        }
+    }
+    if (negative) {
+        value = -value;
+    }
+    if (value > 0x7FFFFFFFLL) {
+        return nullptr;
+    }
+    out = static_cast<s32>(value);
+    return p;
+}
+
+} /* namespace sge */
@@ -0,0 +1,205 @@
+/*---  Scanner.h - Allocation Free Text Scanning  --------------------*- C++ -*---
+ *
+ *                           Stuart's Game Engine
+ *
+ * This file is distributed under the Revised BSD License. See LICENSE.TXT
+ * for details.
+ *
+ * --------------------------------------------------------------------------
+ *
+ * @brief Read words and numbers from a text buffer in place.
+ *
+ * Made for line oriented formats such as Wavefront .obj: the scanner
+ * walks a range of characters, e.g. a MappedFile, and parses numbers
+ * straight out of it without copying lines or tokens into strings.
+ *
+ * parseFloat() accumulates up to 19 significant digits in an integer and
+ * scales them by an exact power of ten in double precision. When the
+ * digits fit in a double's mantissa and the exponent is at most 22, i.e.
+ * for practically every number written by a modelling tool, that double
+ * is correctly rounded, and so is the float from it unless the double
+ * falls exactly halfway between two floats. Those, longer or more extreme
+ * numbers, and inf and nan go through strtof.
+ */
+#ifndef __SGE_SCANNER_H
+#define __SGE_SCANNER_H
+
+#include <cstring> // memchr
+
+namespace sge {
+
+/**
+ * Parse a decimal float from the start of [begin, end), with an optional
+ * sign, fraction and exponent.
+ *
+ * @return One past the last character used, or nullptr if there is no
+ *   number at begin.
+ */
+const char *parseFloat (const char *begin, const char *end, float &out);
+
+/**
+ * Parse a decimal integer from the start of [begin, end), with an
+ * optional sign.
+ *
+ * @return One past the last character used, or nullptr if there is no
+ *   number at begin or it doesn't fit in an s32.
+ */
+const char *parseInt (const char *begin, const char *end, s32 &out);
+
+/**
+ * A position in a range of characters. Lines end at '\n'; '\r', spaces
+ * and tabs are whitespace within a line.
+ */
+class Scanner {
+public:
+    Scanner (const char *begin, const char *end);
+
+    /** @return True if every character has been read. */
+    bool atEnd () const;
+
+    /** @return True at the end of the current line, or of the input. */
+    bool atEndOfLine () const;
+
+    /** @return The next character, or '\0' at the end of the input. */
+    char peek () const;
+
+    /** @return Position of the next character. */
+    const char *position () const;
+
+    /** Skip spaces, tabs and '\r' within the current line. */
+    void skipSpace ();
+
+    /** Move to the start of the next line. */
+    void skipLine ();
+
+    /**
+     * Consume c if it is the next character.
+     *
+     * @return True if c was consumed.
+     */
+    bool match (const char c);
+
+    /**
+     * Read characters up to the next whitespace or end of line.
+     *
+     * @param word Set to the start of the word in the input.
+     * @return Length of the word, 0 if there is none.
+     */
+    size_t readWord (const char *&word);
+
+    /**
+     * Read the rest of the line, without leading or trailing whitespace.
+     *
+     * @return Length of the text, 0 if there is none.
+     */
+    size_t readRest (const char *&text);
+
+    /**
+     * Skip whitespace then read a float. The scanner doesn't move if there
+     * is no number.
+     */
+    bool readFloat (float &out);
+
+    /**
+     * Skip whitespace then read an integer. The scanner doesn't move if
+     * there is no number.
+     */
+    bool readInt (s32 &out);
+
+private:
+    const char *mPos;
+    const char *mEnd;
+
+    static bool isSpace (const char c);
+};
+
+// --------------------------------------------------------------------------
+
+inline Scanner::Scanner (const char *begin, const char *end)
+      : mPos{begin}, mEnd{end} {
+}
+
+inline bool Scanner::isSpace (const char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool Scanner::atEnd () const {
+    return mPos >= mEnd;
+}
+
+inline bool Scanner::atEndOfLine () const {
+    return mPos >= mEnd || *mPos == '\n';
+}
+
+inline char Scanner::peek () const {
+    return (mPos < mEnd) ? *mPos : '\0';
+}
+
+inline const char *Scanner::position () const {
+    return mPos;
+}
+
+inline void Scanner::skipSpace () {
+    while (mPos < mEnd && isSpace(*mPos)) {
+        ++mPos;
+    }
+}
+
+inline void Scanner::skipLine () {
+    const void *newline = (mPos < mEnd) ? memchr(mPos, '\n', static_cast<size_t>(mEnd - mPos)) : nullptr;
+    mPos = newline ? static_cast<const char *>(newline) + 1 : mEnd;
+}
+
+inline bool Scanner::match (const char c) {
+    if (mPos < mEnd && *mPos == c) {
+        ++mPos;
+        return true;
+    }
+    return false;
+}
+
+inline size_t Scanner::readWord (const char *&word) {
+    skipSpace();
+    word = mPos;
+    while (mPos < mEnd && *mPos != '\n' && !isSpace(*mPos)) {
+        ++mPos;
+    }
+    return static_cast<size_t>(mPos - word);
+}
+
+inline size_t Scanner::readRest (const char *&text) {
+    skipSpace();
+    text = mPos;
+    const char *last = mPos;
+    while (mPos < mEnd && *mPos != '\n') {
+        if (!isSpace(*mPos)) {
+            last = mPos + 1;
+        }
+        ++mPos;
+    }
+    return static_cast<size_t>(last - text);
+}
+
+inline bool Scanner::readFloat (float &out) {
+    skipSpace();
+    const char *next = parseFloat(mPos, mEnd, out);
+    if (next) {
+        mPos = next;
+        return true;
+    }
+    return false;
+}
+
+inline bool Scanner::readInt (s32 &out) {
+    skipSpace();
+    const char *next = parseInt(mPos, mEnd, out);
+    if (next) {
+        mPos = next;
+        return true;
+    }
+    return false;
+}
+
+} /* namespace sge */
+
+#endif /* __SGE_SCANNER_H */
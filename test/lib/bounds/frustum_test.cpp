@@ -0,0 +1,93 @@
+//
+// Frustum Tests
+//
+#include <gtest/gtest.h>
+#include "lib.h"
+
+using sge::Aabb;
+using sge::AabbArray;
+using sge::Frustum;
+using sge::Sphere;
+using sge::SphereArray;
+
+// Camera at the origin looking down -z, 90 degree fov, near 1, far 100.
+static Mat4f perspective () {
+    const float n = 1.0f;
+    const float f = 100.0f;
+    return Mat4f(1.0f, 0.0f, 0.0f, 0.0f,
+                 0.0f, 1.0f, 0.0f, 0.0f,
+                 0.0f, 0.0f, -(f + n) / (f - n), -1.0f,
+                 0.0f, 0.0f, -(2.0f * f * n) / (f - n), 0.0f);
+}
+
+static bool isVisible (const std::vector<u64> &visible, const size_t i) {
+    return (visible[i / 64] >> (i % 64)) & 1;
+}
+
+TEST (Frustum_Test, Extract_Planes) {
+    Frustum f(perspective());
+
+    EXPECT_TRUE(Vec4f(0.0f, 0.0f, -1.0f, -1.0f).compare(f.plane(Frustum::kNear), 1e-5f));
+    EXPECT_TRUE(Vec4f(0.0f, 0.0f, 1.0f, 100.0f).compare(f.plane(Frustum::kFar), 1e-3f));
+    EXPECT_TRUE(Vec4f(0.70710678f, 0.0f, -0.70710678f, 0.0f).compare(f.plane(Frustum::kLeft), 1e-5f));
+}
+
+TEST (Frustum_Test, Scalar_Tests) {
+    Frustum f(perspective());
+
+    EXPECT_TRUE(contains(f, Vec3f(0.0f, 0.0f, -10.0f)));
+    EXPECT_FALSE(contains(f, Vec3f(0.0f, 0.0f, 10.0f)));
+    EXPECT_FALSE(contains(f, Vec3f(0.0f, 0.0f, -0.5f)));
+    EXPECT_FALSE(contains(f, Vec3f(20.0f, 0.0f, -10.0f)));
+
+    EXPECT_TRUE(intersects(f, Sphere(Vec3f(11.0f, 0.0f, -10.0f), 2.0f)));
+    EXPECT_FALSE(intersects(f, Sphere(Vec3f(13.0f, 0.0f, -10.0f), 2.0f)));
+    EXPECT_TRUE(intersects(f, Sphere(Vec3f(0.0f, 0.0f, -101.0f), 2.0f)));
+
+    EXPECT_TRUE(intersects(f, Aabb(10.5f, -1.0f, -11.0f, 12.0f, 1.0f, -9.0f)));
+    EXPECT_FALSE(intersects(f, Aabb(12.0f, -1.0f, -11.0f, 14.0f, 1.0f, -9.0f)));
+
+    // Default frustum contains everything.
+    EXPECT_TRUE(contains(Frustum(), Vec3f(1e6f, -1e6f, 1e6f)));
+}
+
+TEST (Frustum_Test, Batch_Matches_Scalar) {
+    sge::Random r(5);
+    Frustum f(perspective());
+    SphereArray spheres;
+    AabbArray boxes;
+    std::vector<Sphere> s;
+    std::vector<Aabb> b;
+
+    // Not a multiple of 8 or 64, to cover the tail.
+    for (int k = 0; k < 1001; ++k) {
+        Vec3f c = Vec3f(r.nextFloat(-60.0f, 60.0f), r.nextFloat(-60.0f, 60.0f), r.nextFloat(-120.0f, 20.0f));
+        s.push_back(Sphere(c, r.nextFloat(0.0f, 5.0f)));
+        b.push_back(Aabb(c, c + Vec3f(r.nextFloat(0.0f, 5.0f), r.nextFloat(0.0f, 5.0f), r.nextFloat(0.0f, 5.0f))));
+        spheres.add(s.back());
+        boxes.add(b.back());
+    }
+
+    std::vector<u64> visible;
+    for (int frame = 0; frame < 3; ++frame) {
+        f.cull(spheres, visible);
+        ASSERT_EQ(16u, visible.size());
+        for (size_t i = 0; i < s.size(); ++i) {
+            EXPECT_EQ(intersects(f, s[i]), isVisible(visible, i));
+        }
+        EXPECT_EQ(0u, visible.back() >> (1001 % 64));
+
+        f.cull(boxes, visible);
+        for (size_t i = 0; i < b.size(); ++i) {
+            EXPECT_EQ(intersects(f, b[i]), isVisible(visible, i));
+        }
+
+        // Move everything so cached planes are sometimes wrong.
+        for (size_t i = 0; i < s.size(); ++i) {
+            s[i].center.x = -s[i].center.x;
+            spheres.set(i, s[i]);
+            b[i] = Aabb(b[i].min + Vec3f(0.0f, 0.0f, 40.0f), b[i].max + Vec3f(0.0f, 0.0f, 40.0f));
+            boxes.set(i, b[i]);
+        }
+    }
+}
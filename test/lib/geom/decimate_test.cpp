@@ -0,0 +1,144 @@
+//
+// Mesh Decimation Tests
+//
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "lib.h"
+#include "meshfixtures.h"
+
+using sge::Mesh;
+using sge::MeshLod;
+using sge::Vertex;
+
+// An indexed n x n grid of quads in the xy plane. With a seam, the column
+// at x = n / 2 is split into two vertices, texture coordinate s = 0 on the
+// left and s = 1 on the right.
+static Mesh grid (const u32 n, const bool seam) {
+    Mesh m;
+    std::vector<u32> left((n + 1) * (n + 1));
+    std::vector<u32> right((n + 1) * (n + 1));
+    for (u32 y = 0; y <= n; ++y) {
+        for (u32 x = 0; x <= n; ++x) {
+            const u32 i = y * (n + 1) + x;
+            const float s = (x > n / 2) ? 1.0f : 0.0f;
+            left[i] = right[i] = m.vertCount();
+            m.addVertex(Vertex(static_cast<float>(x), static_cast<float>(y), 0.0f, 0, 0, 1,
+                               s, 0, 255, 255, 255, 255));
+            if (seam && x == n / 2) {
+                right[i] = m.vertCount();
+                m.addVertex(Vertex(static_cast<float>(x), static_cast<float>(y), 0.0f, 0, 0, 1,
+                                   1, 0, 255, 255, 255, 255));
+            }
+        }
+    }
+    for (u32 y = 0; y < n; ++y) {
+        for (u32 x = 0; x < n; ++x) {
+            const std::vector<u32> &v = (x < n / 2) ? left : right;
+            const u32 i = y * (n + 1) + x;
+            m.addFace(v[i], v[i + 1], v[i + n + 2]);
+            m.addFace(v[i], v[i + n + 2], v[i + n + 1]);
+        }
+    }
+    return m;
+}
+
+static Vec3f centroid (const Mesh &m, const u32 t) {
+    return (m.vertices[m.indices[t * 3]].position + m.vertices[m.indices[t * 3 + 1]].position +
+            m.vertices[m.indices[t * 3 + 2]].position) / 3.0f;
+}
+
+TEST (Decimate_Test, Flat_Grid_Keeps_Outline) {
+    const Mesh m = grid(16, false);
+    const MeshLod lod = sge::decimate(m, 0.1f);
+
+    EXPECT_LE(lod.mesh.faceCount(), m.faceCount() / 10);
+    EXPECT_GT(lod.mesh.faceCount(), 0u);
+    EXPECT_NEAR(0.0f, lod.error, 1e-4f);
+    EXPECT_FLOAT_EQ(static_cast<float>(lod.mesh.faceCount()) / m.faceCount(), lod.ratio);
+
+    // The corners are still there, and the area and winding are unchanged.
+    float area = 0.0f;
+    sge::Aabb box;
+    for (u32 t = 0; t < lod.mesh.faceCount(); ++t) {
+        const Vec3f &a = lod.mesh.vertices[lod.mesh.indices[t * 3]].position;
+        const Vec3f &b = lod.mesh.vertices[lod.mesh.indices[t * 3 + 1]].position;
+        const Vec3f &c = lod.mesh.vertices[lod.mesh.indices[t * 3 + 2]].position;
+        area += (b - a).cross(c - a).z * 0.5f;
+        box.addPoint(a);
+        box.addPoint(b);
+        box.addPoint(c);
+    }
+    EXPECT_FLOAT_EQ(256.0f, area);
+    EXPECT_EQ(Vec3f(0.0f, 0.0f, 0.0f), box.min);
+    EXPECT_EQ(Vec3f(16.0f, 16.0f, 0.0f), box.max);
+}
+
+TEST (Decimate_Test, Seam_Preserved) {
+    const Mesh m = grid(16, true);
+    const MeshLod lod = sge::decimate(m, 0.1f);
+
+    EXPECT_LE(lod.mesh.faceCount(), m.faceCount() / 10);
+    EXPECT_NEAR(0.0f, lod.error, 1e-4f);
+
+    // Triangles either side of the seam only use vertices from their side.
+    for (u32 t = 0; t < lod.mesh.faceCount(); ++t) {
+        const float side = (centroid(lod.mesh, t).x < 8.0f) ? 0.0f : 1.0f;
+        for (u32 k = 0; k < 3; ++k) {
+            EXPECT_EQ(side, lod.mesh.vertices[lod.mesh.indices[t * 3 + k]].texCoord.x);
+        }
+    }
+}
+
+TEST (Decimate_Test, Sphere_Chain) {
+    const Mesh m = fixture::sphere(16);
+    ASSERT_EQ(6u * 16u * 16u + 2u, m.vertCount());
+    const std::vector<MeshLod> lods = sge::buildLodChain(m, {1.0f, 0.5f, 0.25f, 0.1f});
+    ASSERT_EQ(4u, lods.size());
+
+    EXPECT_EQ(m.faceCount(), lods[0].mesh.faceCount());
+    EXPECT_EQ(m.vertCount(), lods[0].mesh.vertCount());
+    EXPECT_EQ(0.0f, lods[0].error);
+
+    const float ratios[] = {1.0f, 0.5f, 0.25f, 0.1f};
+    for (size_t i = 1; i < lods.size(); ++i) {
+        const Mesh &lod = lods[i].mesh;
+        EXPECT_LE(lod.faceCount(), static_cast<u32>(ratios[i] * m.faceCount()));
+        EXPECT_GE(lods[i].error, lods[i - 1].error);
+        EXPECT_LT(lods[i].ratio, lods[i - 1].ratio);
+
+        // Vertices don't move, and no triangle faces inwards.
+        for (const Vertex &v : lod.vertices) {
+            EXPECT_NEAR(1.0f, v.position.mag(), 1e-5f);
+        }
+        for (u32 t = 0; t < lod.faceCount(); ++t) {
+            const Vec3f &a = lod.vertices[lod.indices[t * 3]].position;
+            const Vec3f &b = lod.vertices[lod.indices[t * 3 + 1]].position;
+            const Vec3f &c = lod.vertices[lod.indices[t * 3 + 2]].position;
+            EXPECT_GT((b - a).cross(c - a).dot(centroid(lod, t)), 0.0f);
+        }
+    }
+    EXPECT_GT(lods[3].error, 0.0f);
+    EXPECT_LT(lods[3].error, 0.5f);
+}
+
+TEST (Decimate_Test, Select_Lod) {
+    std::vector<MeshLod> lods(3);
+    lods[0].error = 0.0f;
+    lods[1].error = 0.01f;
+    lods[2].error = 0.1f;
+
+    // 1 unit spans the viewport at distance 1 with a 90 degree field of view.
+    EXPECT_NEAR(500.0f, sge::lodErrorScale(1.0f, math::kPi * 0.5f, 1000.0f), 1e-3f);
+
+    EXPECT_EQ(0u, sge::selectLod(lods, sge::lodErrorScale(1.0f, math::kPi * 0.5f, 1000.0f), 1.0f));
+    EXPECT_EQ(1u, sge::selectLod(lods, sge::lodErrorScale(10.0f, math::kPi * 0.5f, 1000.0f), 1.0f));
+    EXPECT_EQ(2u, sge::selectLod(lods, sge::lodErrorScale(100.0f, math::kPi * 0.5f, 1000.0f), 1.0f));
+}
+
+TEST (Decimate_Test, Empty) {
+    const MeshLod lod = sge::decimate(Mesh(), 0.5f);
+    EXPECT_EQ(0u, lod.mesh.vertCount());
+    EXPECT_EQ(0u, lod.mesh.faceCount());
+    EXPECT_EQ(1.0f, lod.ratio);
+}
@@ -0,0 +1,141 @@
+//
+// IndexBuffer Tests
+//
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "lib.h"
+#include "meshfixtures.h"
+
+using sge::IndexBuffer;
+using sge::Mesh;
+
+// Every triangle rotated to start from its smallest index, so rotations
+// compare equal but windings don't, sorted.
+static std::vector<std::array<u32, 3>> triangleSet (const std::vector<u32> &indices) {
+    std::vector<std::array<u32, 3>> tris;
+    for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+        const u32 *c = &indices[t];
+        const u32 first = (c[0] < c[1]) ? ((c[0] < c[2]) ? 0 : 2) : ((c[1] < c[2]) ? 1 : 2);
+        tris.push_back({{c[first], c[(first + 1) % 3], c[(first + 2) % 3]}});
+    }
+    std::sort(tris.begin(), tris.end());
+    return tris;
+}
+
+TEST (IndexBuffer_Test, Stripify_Single_Triangle) {
+    const std::vector<u32> tri = {4, 5, 6};
+    EXPECT_EQ(tri, sge::stripify(tri));
+    EXPECT_EQ(tri, sge::unstripify(tri));
+}
+
+TEST (IndexBuffer_Test, Stripify_Empty) {
+    EXPECT_TRUE(sge::stripify(std::vector<u32>()).empty());
+    EXPECT_TRUE(sge::unstripify(std::vector<u32>()).empty());
+}
+
+TEST (IndexBuffer_Test, Stripify_Quad) {
+    const std::vector<u32> quad = {0, 1, 2, 0, 2, 3};
+    const std::vector<u32> strip = sge::stripify(quad);
+
+    EXPECT_EQ(4u, strip.size());
+    EXPECT_EQ(triangleSet(quad), triangleSet(sge::unstripify(strip)));
+}
+
+TEST (IndexBuffer_Test, Unstripify_Restart_And_Degenerate) {
+    const std::vector<u32> strip = {0, 1, 2, 3, sge::kRestartIndex, 7, 8, 8, 9};
+
+    // The second strip only has degenerate triangles.
+    EXPECT_EQ((std::vector<u32>{0, 1, 2, 2, 1, 3}), sge::unstripify(strip));
+}
+
+TEST (IndexBuffer_Test, Stripify_Preserves_Triangles) {
+    Mesh m = fixture::grid(40, 30);
+    sge::optimizeVertexCache(m.indices, m.vertCount());
+
+    const std::vector<u32> strip = sge::stripify(m.indices);
+    EXPECT_EQ(triangleSet(m.indices), triangleSet(sge::unstripify(strip)));
+
+    // Strips restart often to follow the cache order, but a grid should
+    // still need little more than half the indices.
+    EXPECT_LT(strip.size(), m.indices.size() * 6 / 10);
+}
+
+TEST (IndexBuffer_Test, Stripify_Disconnected_Triangles) {
+    std::vector<u32> indices;
+    for (u32 t = 0; t < 10; ++t) {
+        indices.push_back(t * 3);
+        indices.push_back(t * 3 + 2);
+        indices.push_back(t * 3 + 1);
+    }
+
+    const std::vector<u32> strip = sge::stripify(indices);
+    EXPECT_EQ(10u * 4 - 1, strip.size());
+    EXPECT_EQ(9, std::count(strip.begin(), strip.end(), sge::kRestartIndex));
+    EXPECT_EQ(triangleSet(indices), triangleSet(sge::unstripify(strip)));
+}
+
+TEST (IndexBuffer_Test, Format_Selection) {
+    EXPECT_TRUE(IndexBuffer::fits16(0x10000, sge::kTriangles));
+    EXPECT_FALSE(IndexBuffer::fits16(0x10001, sge::kTriangles));
+    EXPECT_TRUE(IndexBuffer::fits16(0xFFFF, sge::kTriangleStrip));
+    EXPECT_FALSE(IndexBuffer::fits16(0x10000, sge::kTriangleStrip));
+
+    const std::vector<u32> indices = {0, 1, 2, 2, 1, 3};
+    const IndexBuffer small(indices, 4);
+    EXPECT_EQ(sge::kIndex16, small.format());
+    EXPECT_EQ(2u, small.indexSize());
+    EXPECT_EQ(6u, small.count());
+    EXPECT_EQ(12u, small.size());
+    EXPECT_EQ(0xFFFFu, small.restartIndex());
+
+    const IndexBuffer large(indices, 100000);
+    EXPECT_EQ(sge::kIndex32, large.format());
+    EXPECT_EQ(4u, large.indexSize());
+    EXPECT_EQ(24u, large.size());
+    EXPECT_EQ(sge::kRestartIndex, large.restartIndex());
+
+    for (u32 i = 0; i < 6; ++i) {
+        EXPECT_EQ(indices[i], small[i]);
+        EXPECT_EQ(indices[i], large[i]);
+    }
+}
+
+TEST (IndexBuffer_Test, Empty) {
+    const IndexBuffer empty;
+    EXPECT_EQ(0u, empty.count());
+    EXPECT_EQ(0u, empty.size());
+    EXPECT_EQ(sge::kTriangles, empty.primitive());
+}
+
+TEST (IndexBuffer_Test, Strip_Restart_Narrowed) {
+    Mesh m = fixture::grid(20, 20);
+    sge::optimizeVertexCache(m.indices, m.vertCount());
+
+    const IndexBuffer strip(m.indices, m.vertCount(), sge::kTriangleStrip);
+    EXPECT_EQ(sge::kTriangleStrip, strip.primitive());
+    EXPECT_EQ(sge::kIndex16, strip.format());
+
+    const std::vector<u32> wide = sge::stripify(m.indices);
+    ASSERT_EQ(wide.size(), strip.count());
+    for (u32 i = 0; i < strip.count(); ++i) {
+        if (wide[i] == sge::kRestartIndex) {
+            EXPECT_EQ(0xFFFFu, strip[i]);
+        } else {
+            EXPECT_EQ(wide[i], strip[i]);
+        }
+    }
+}
+
+TEST (IndexBuffer_Test, From_Packed_Data) {
+    const u16 packed[] = {0, 1, 2, 2, 1, 3};
+    const IndexBuffer ib(sge::kIndex16, sge::kTriangles, 6, packed);
+
+    EXPECT_EQ(sge::kIndex16, ib.format());
+    EXPECT_EQ(6u, ib.count());
+    EXPECT_EQ(sizeof(packed), ib.size());
+    for (u32 i = 0; i < 6; ++i) {
+        EXPECT_EQ(packed[i], ib[i]);
+    }
+}
@@ -3,6 +3,7 @@
 //
 #include <gtest/gtest.h>
 #include "lib.h"
+#include "meshfixtures.h"
 
 using sge::Mesh;
 using sge::Vertex;
@@ -29,3 +30,79 @@ TEST (Mesh_Test, FaceCount) {
 
     ASSERT_EQ(2, m.faceCount());
 }
+
+// Every face still refers to the same vertex data, within tolerance.
+static void expectSameFaces (const Mesh &before, const Mesh &after, const float tolerance) {
+    ASSERT_EQ(before.indexCount(), after.indexCount());
+    for (u32 i = 0; i < before.indexCount(); ++i) {
+        ASSERT_LT(after.indices[i], after.vertCount());
+        const Vertex &a = before.vertices[before.indices[i]];
+        const Vertex &b = after.vertices[after.indices[i]];
+        EXPECT_TRUE(a.position.compare(b.position, tolerance));
+        EXPECT_TRUE(a.texCoord.compare(b.texCoord, tolerance));
+        EXPECT_EQ(a.color, b.color);
+    }
+}
+
+TEST (Mesh_Test, Simplify_Exact) {
+    const Mesh grid = fixture::quadGrid(8, 5);
+    Mesh m = grid;
+    m.simplify();
+
+    EXPECT_EQ(9u * 6u, m.vertCount());
+    expectSameFaces(grid, m, 0.0f);
+
+    // Survivors keep their order.
+    EXPECT_EQ(grid.vertices[0], m.vertices[0]);
+    EXPECT_EQ(grid.vertices[1], m.vertices[1]);
+
+    // Already welded.
+    Mesh again = m;
+    again.simplify();
+    EXPECT_EQ(m.vertices.size(), again.vertices.size());
+    EXPECT_EQ(m.indices, again.indices);
+}
+
+TEST (Mesh_Test, Simplify_Exact_Keeps_Distinct) {
+    Mesh m;
+    m.addVertex(Vertex(0.0f, 0.0f, 0.0f, 0, 0, 1, 0, 0, 255, 255, 255, 255));
+    m.addVertex(Vertex(-0.0f, 0.0f, 0.0f, 0, 0, 1, 0, 0, 255, 255, 255, 255));
+    m.addVertex(Vertex(0.0f, 0.0f, 0.0f, 0, 1, 0, 0, 0, 255, 255, 255, 255));
+    m.addVertex(Vertex(0.0f, 0.0f, 0.0f, 0, 0, 1, 0, 0, 255, 255, 255, 0));
+    m.addVertex(Vertex(1e-7f, 0.0f, 0.0f, 0, 0, 1, 0, 0, 255, 255, 255, 255));
+    m.addFace(0, 1, 2);
+    m.addFace(3, 4, 1);
+
+    // Only -0 and 0 weld.
+    m.simplify();
+    EXPECT_EQ(4u, m.vertCount());
+    EXPECT_EQ(std::vector<u32>({0, 0, 1, 2, 3, 0}), m.indices);
+}
+
+TEST (Mesh_Test, Simplify_Epsilon) {
+    const Mesh grid = fixture::quadGrid(8, 5, 1e-5f);
+    Mesh exact = grid;
+    exact.simplify();
+
+    Mesh m = grid;
+    m.simplify(1e-3f);
+    EXPECT_EQ(9u * 6u, m.vertCount());
+    EXPECT_GT(exact.vertCount(), 2 * m.vertCount());
+    expectSameFaces(grid, m, 1e-4f);
+}
+
+TEST (Mesh_Test, Simplify_Threaded) {
+    // Enough vertices to be split across threads.
+    const Mesh grid = fixture::quadGrid(128, 64);
+    ASSERT_GT(grid.vertCount(), sge::kMeshWeldGrain);
+
+    Mesh serial = grid;
+    Mesh threaded = grid;
+    serial.simplify(0.0f, false);
+    threaded.simplify(0.0f, true);
+
+    EXPECT_EQ(129u * 65u, serial.vertCount());
+    EXPECT_EQ(serial.vertices, threaded.vertices);
+    EXPECT_EQ(serial.indices, threaded.indices);
+    expectSameFaces(grid, threaded, 0.0f);
+}
@@ -0,0 +1,217 @@
+//
+// MeshCache Tests
+//
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <utime.h>
+#include "lib.h"
+#include "meshfixtures.h"
+
+using sge::Mesh;
+using sge::MeshCache;
+using sge::Vertex;
+
+// A grid with texture coordinates from 0 to 1 across it.
+static Mesh grid (const u32 w, const u32 h) {
+    return fixture::grid(w, h, 1.0f / w, 1.0f / h);
+}
+
+static std::string tempPath (const char *name) {
+    return ::testing::TempDir() + name;
+}
+
+static std::string readFile (const std::string &path) {
+    std::string bytes;
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file) {
+        char buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            bytes.append(buffer, n);
+        }
+        fclose(file);
+    }
+    return bytes;
+}
+
+static void writeFile (const std::string &path, const std::string &bytes) {
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file) {
+        fwrite(bytes.data(), 1, bytes.size(), file);
+        fclose(file);
+    }
+}
+
+TEST (MeshCache_Test, Round_Trip) {
+    const Mesh m = grid(16, 12);
+    const std::string path = tempPath("sge_meshcache_round_trip.sgem");
+    ASSERT_TRUE(sge::writeMeshCache(path.c_str(), m, {0.5f, 0.25f}));
+
+    const MeshCache cache(path.c_str());
+    ASSERT_TRUE(cache.isValid());
+    EXPECT_EQ(3u, cache.lodCount());
+    EXPECT_EQ(sge::kTriangles, cache.primitive());
+    EXPECT_EQ(static_cast<u32>(sizeof(Vertex)), cache.layout().stride());
+    EXPECT_EQ(Vertex::layout().attributes().size(), cache.layout().attributes().size());
+    EXPECT_EQ(Vec3f(0.0f, 0.0f, 0.0f), cache.bounds().min);
+    EXPECT_EQ(Vec3f(16.0f, 12.0f, 0.0f), cache.bounds().max);
+
+    // Level 0 is the mesh as MeshRenderer would have optimised it.
+    Mesh optimized = m;
+    optimized.optimize();
+    const Mesh loaded = cache.toMesh(0);
+    EXPECT_EQ(optimized.vertices, loaded.vertices);
+    EXPECT_EQ(optimized.indices, loaded.indices);
+    EXPECT_EQ(1.0f, cache.lod(0).ratio);
+    EXPECT_EQ(0.0f, cache.lod(0).error);
+
+    for (u32 level = 1; level < cache.lodCount(); ++level) {
+        EXPECT_LT(cache.lod(level).indexCount, cache.lod(level - 1).indexCount);
+        EXPECT_GE(cache.lod(level).error, cache.lod(level - 1).error);
+        const Mesh lod = cache.toMesh(level);
+        for (const u32 i : lod.indices) {
+            EXPECT_LT(i, lod.vertCount());
+        }
+    }
+
+    remove(path.c_str());
+}
+
+TEST (MeshCache_Test, Buffers_Are_Aligned) {
+    const std::string path = tempPath("sge_meshcache_aligned.sgem");
+    ASSERT_TRUE(sge::writeMeshCache(path.c_str(), grid(7, 5), {0.5f}));
+
+    const MeshCache cache(path.c_str());
+    ASSERT_TRUE(cache.isValid());
+    for (u32 level = 0; level < cache.lodCount(); ++level) {
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(cache.vertexData(level)) % sge::kMeshCacheAlignment);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(cache.indexData(level)) % sge::kMeshCacheAlignment);
+    }
+
+    remove(path.c_str());
+}
+
+TEST (MeshCache_Test, Packed_Indices) {
+    const Mesh m = grid(16, 16);
+    const std::string path = tempPath("sge_meshcache_strips.sgem");
+    ASSERT_TRUE(sge::writeMeshCache(path.c_str(), m, {}, sge::kTriangleStrip));
+
+    const MeshCache cache(path.c_str());
+    ASSERT_TRUE(cache.isValid());
+    EXPECT_EQ(sge::kTriangleStrip, cache.primitive());
+    EXPECT_EQ(sge::kIndex16, cache.lod(0).indexFormat);
+
+    const sge::IndexBuffer ib = cache.indices(0);
+    EXPECT_EQ(sge::kTriangleStrip, ib.primitive());
+    EXPECT_EQ(sge::kIndex16, ib.format());
+    std::vector<u32> strip(ib.count());
+    for (u32 i = 0; i < ib.count(); ++i) {
+        strip[i] = (ib[i] == ib.restartIndex()) ? sge::kRestartIndex : ib[i];
+    }
+    EXPECT_EQ(m.indexCount(), sge::unstripify(strip).size());
+
+    remove(path.c_str());
+}
+
+TEST (MeshCache_Test, Rejects_Bad_Files) {
+    EXPECT_FALSE(MeshCache("no/such/file.sgem").isValid());
+    EXPECT_FALSE(MeshCache().isValid());
+
+    const std::string path = tempPath("sge_meshcache_good.sgem");
+    const std::string bad = tempPath("sge_meshcache_bad.sgem");
+    ASSERT_TRUE(sge::writeMeshCache(path.c_str(), grid(4, 4)));
+    const std::string bytes = readFile(path);
+    ASSERT_TRUE(MeshCache(path.c_str()).isValid());
+
+    // Truncated.
+    writeFile(bad, bytes.substr(0, bytes.size() - 1));
+    EXPECT_FALSE(MeshCache(bad.c_str()).isValid());
+    writeFile(bad, bytes.substr(0, sizeof(sge::MeshCacheHeader) - 1));
+    EXPECT_FALSE(MeshCache(bad.c_str()).isValid());
+
+    // Another version.
+    std::string patched = bytes;
+    sge::MeshCacheHeader header;
+    memcpy(&header, patched.data(), sizeof(header));
+    header.version = sge::kMeshCacheVersion + 1;
+    memcpy(&patched[0], &header, sizeof(header));
+    writeFile(bad, patched);
+    EXPECT_FALSE(MeshCache(bad.c_str()).isValid());
+
+    // An attribute offset which would wrap past the stride in 32 bits.
+    patched = bytes;
+    memcpy(&header, patched.data(), sizeof(header));
+    header.version = sge::kMeshCacheVersion;
+    header.attribs[0].offset = 0xFFFFFFFFu - 3;
+    memcpy(&patched[0], &header, sizeof(header));
+    writeFile(bad, patched);
+    EXPECT_FALSE(MeshCache(bad.c_str()).isValid());
+
+    // An index past the last vertex.
+    patched = bytes;
+    sge::MeshCacheLod lod;
+    memcpy(&lod, patched.data() + sizeof(header), sizeof(lod));
+    ASSERT_EQ(static_cast<u32>(sge::kIndex16), lod.indexFormat);
+    const u16 index = static_cast<u16>(lod.vertexCount);
+    memcpy(&patched[lod.indexOffset], &index, sizeof(index));
+    writeFile(bad, patched);
+    EXPECT_FALSE(MeshCache(bad.c_str()).isValid());
+
+    // Not a mesh cache.
+    writeFile(bad, std::string(bytes.size(), 'x'));
+    EXPECT_FALSE(MeshCache(bad.c_str()).isValid());
+
+    remove(path.c_str());
+    remove(bad.c_str());
+}
+
+TEST (MeshCache_Test, Cook_Obj) {
+    const std::string obj = tempPath("sge_meshcache_cook.obj");
+    const std::string path = sge::meshCachePath(obj.c_str());
+    EXPECT_EQ(obj + ".sgemesh", path);
+    writeFile(obj, "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nf 1 2 3 4\n");
+
+    ASSERT_TRUE(sge::cookObjMesh(obj.c_str(), path.c_str(), {0.5f}, false));
+    const MeshCache cache(path.c_str());
+    ASSERT_TRUE(cache.isValid());
+    EXPECT_EQ(2u, cache.lodCount());
+    EXPECT_EQ(4u, cache.lod(0).vertexCount);
+    EXPECT_EQ(6u, cache.lod(0).indexCount);
+
+    EXPECT_FALSE(sge::cookObjMesh("no/such/file.obj", path.c_str(), {}));
+    EXPECT_FALSE(sge::cookObjMesh(obj.c_str(), "no/such/dir/file.sgemesh", {}));
+
+    remove(obj.c_str());
+    remove(path.c_str());
+}
+
+TEST (MeshCache_Test, Fresh_Only_After_Source) {
+    const std::string obj = tempPath("sge_meshcache_fresh.obj");
+    const std::string path = sge::meshCachePath(obj.c_str());
+    const std::string text = "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n";
+    remove(path.c_str());
+    writeFile(obj, text);
+    EXPECT_FALSE(sge::isMeshCacheFresh(obj.c_str(), path.c_str()));
+
+    // Date the source back so that coarse file times still tell them apart.
+    const time_t past = time(nullptr) - 10;
+    const utimbuf times = {past, past};
+    ASSERT_EQ(0, utime(obj.c_str(), &times));
+    ASSERT_TRUE(sge::cookObjMesh(obj.c_str(), path.c_str(), {}));
+    EXPECT_TRUE(sge::isMeshCacheFresh(obj.c_str(), path.c_str()));
+
+    // Saved again straight after cooking, likely within the same second.
+    writeFile(obj, text);
+    EXPECT_FALSE(sge::isMeshCacheFresh(obj.c_str(), path.c_str()));
+
+    // The cache is all there is without its source.
+    remove(obj.c_str());
+    EXPECT_TRUE(sge::isMeshCacheFresh(obj.c_str(), path.c_str()));
+
+    remove(path.c_str());
+}
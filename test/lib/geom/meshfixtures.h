@@ -0,0 +1,88 @@
+//
+// Meshes shared by the geometry tests and benchmarks.
+//
+#ifndef __SGE_TEST_MESHFIXTURES_H
+#define __SGE_TEST_MESHFIXTURES_H
+
+#include "lib.h"
+
+namespace fixture {
+
+/**
+ * An indexed grid of w x h quads in the xy plane, two triangles each,
+ * with texture coordinates (x * uScale, y * vScale).
+ */
+inline sge::Mesh grid (const u32 w, const u32 h, const float uScale = 0.0f, const float vScale = 0.0f,
+                       const Vec3f &normal = Vec3f(0.0f, 0.0f, 1.0f)) {
+    sge::Mesh m;
+    for (u32 y = 0; y <= h; ++y) {
+        for (u32 x = 0; x <= w; ++x) {
+            m.addVertex(sge::Vertex(Vec3f(static_cast<float>(x), static_cast<float>(y), 0.0f), normal,
+                                    Vec2f(static_cast<float>(x) * uScale, static_cast<float>(y) * vScale),
+                                    Color(255, 255, 255)));
+        }
+    }
+    for (u32 y = 0; y < h; ++y) {
+        for (u32 x = 0; x < w; ++x) {
+            const u32 v = y * (w + 1) + x;
+            m.addFace(v, v + 1, v + w + 2);
+            m.addFace(v, v + w + 2, v + w + 1);
+        }
+    }
+    return m;
+}
+
+/**
+ * A w x h grid of quads in the xy plane, built with autoQuad so every
+ * inner corner is repeated by each quad that shares it. x is moved by up
+ * to jitter at each corner.
+ */
+inline sge::Mesh quadGrid (const u32 w, const u32 h, const float jitter = 0.0f) {
+    sge::Random r(3);
+    auto corner = [&](const u32 x, const u32 y) {
+        const float j = r.nextFloat(-jitter, jitter);
+        return sge::Vertex(static_cast<float>(x) + j, static_cast<float>(y), 0.0f,
+                           0.0f, 0.0f, 1.0f, static_cast<float>(x) / w, static_cast<float>(y) / h,
+                           255, 255, 255, 255);
+    };
+
+    sge::Mesh m;
+    for (u32 y = 0; y < h; ++y) {
+        for (u32 x = 0; x < w; ++x) {
+            m.autoQuad(corner(x, y), corner(x + 1, y), corner(x + 1, y + 1), corner(x, y + 1));
+        }
+    }
+    return m;
+}
+
+/** A welded unit sphere of 6 x n x n quads, projected from a cube. */
+inline sge::Mesh sphere (const u32 n) {
+    sge::Mesh m;
+    const Vec3f axes[3] = {Vec3f(1, 0, 0), Vec3f(0, 1, 0), Vec3f(0, 0, 1)};
+    for (u32 face = 0; face < 6; ++face) {
+        const float sign = (face < 3) ? 1.0f : -1.0f;
+        const u32 base = m.vertCount();
+        for (u32 y = 0; y <= n; ++y) {
+            for (u32 x = 0; x <= n; ++x) {
+                const float s = 2.0f * x / n - 1.0f;
+                const float t = 2.0f * y / n - 1.0f;
+                const Vec3f p = (axes[face % 3] * sign + axes[(face + 1) % 3] * s +
+                                 axes[(face + 2) % 3] * t * sign).normalize();
+                m.addVertex(sge::Vertex(p, p, Vec2f_Zero, Color(255, 255, 255)));
+            }
+        }
+        for (u32 y = 0; y < n; ++y) {
+            for (u32 x = 0; x < n; ++x) {
+                const u32 i = base + y * (n + 1) + x;
+                m.addFace(i, i + 1, i + n + 2);
+                m.addFace(i, i + n + 2, i + n + 1);
+            }
+        }
+    }
+    m.simplify();
+    return m;
+}
+
+} /* namespace fixture */
+
+#endif /* __SGE_TEST_MESHFIXTURES_H */
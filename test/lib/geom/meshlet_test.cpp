@@ -0,0 +1,137 @@
+//
+// Meshlet Tests
+//
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "lib.h"
+#include "meshfixtures.h"
+
+using sge::Frustum;
+using sge::Mesh;
+using sge::MeshletMesh;
+
+static std::vector<std::array<u32, 3>> sortedTriangles (const std::vector<u32> &indices) {
+    std::vector<std::array<u32, 3>> tris;
+    for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+        tris.push_back({{indices[t], indices[t + 1], indices[t + 2]}});
+    }
+    std::sort(tris.begin(), tris.end());
+    return tris;
+}
+
+TEST (Meshlet_Test, Build) {
+    const Mesh m = fixture::sphere(24);
+    const MeshletMesh mm(m);
+
+    ASSERT_GT(mm.meshletCount(), 0u);
+    EXPECT_EQ(mm.meshletCount(), mm.spheres.size());
+
+    std::vector<u32> all;
+    u32 full = 0;
+    for (u32 i = 0; i < mm.meshletCount(); ++i) {
+        const sge::Meshlet &ml = mm.meshlets[i];
+        EXPECT_LE(ml.vertexCount, sge::kMeshletMaxVertices);
+        EXPECT_LE(ml.triangleCount, sge::kMeshletMaxTriangles);
+        EXPECT_GT(ml.triangleCount, 0u);
+        full += (ml.vertexCount + 3 > sge::kMeshletMaxVertices ||
+                 ml.triangleCount == sge::kMeshletMaxTriangles) ? 1 : 0;
+
+        for (u32 k = 0; k < ml.vertexCount; ++k) {
+            const Vec3f &p = m.vertices[mm.vertices[ml.vertexOffset + k]].position;
+            EXPECT_LE((p - ml.sphere.center).mag(), ml.sphere.radius * 1.0001f);
+            EXPECT_TRUE(contains(ml.box, p));
+        }
+        mm.appendIndices(i, all);
+    }
+
+    // Every triangle exactly once, with its winding.
+    EXPECT_EQ(sortedTriangles(m.indices), sortedTriangles(all));
+
+    // Grown meshlets are mostly full.
+    EXPECT_GT(full, mm.meshletCount() * 3 / 4);
+}
+
+TEST (Meshlet_Test, Limits) {
+    const Mesh m = fixture::grid(16, 16);
+    const MeshletMesh mm(m, 16, 8);
+
+    std::vector<u32> all;
+    for (u32 i = 0; i < mm.meshletCount(); ++i) {
+        EXPECT_LE(mm.meshlets[i].vertexCount, 16u);
+        EXPECT_LE(mm.meshlets[i].triangleCount, 8u);
+        mm.appendIndices(i, all);
+    }
+    EXPECT_EQ(sortedTriangles(m.indices), sortedTriangles(all));
+}
+
+TEST (Meshlet_Test, Cone_Is_Conservative) {
+    const Mesh m = fixture::sphere(16);
+    const MeshletMesh mm(m);
+    sge::Random r(9);
+
+    u32 culled = 0;
+    for (u32 k = 0; k < 64; ++k) {
+        const Vec3f eye = Vec3f(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f),
+                                r.nextFloat(-1.0f, 1.0f)).setMag(r.nextFloat(1.5f, 20.0f));
+        for (u32 i = 0; i < mm.meshletCount(); ++i) {
+            if (!mm.isBackFacing(i, eye)) {
+                continue;
+            }
+            ++culled;
+
+            std::vector<u32> tris;
+            mm.appendIndices(i, tris);
+            for (size_t t = 0; t < tris.size(); t += 3) {
+                const Vec3f &a = m.vertices[tris[t]].position;
+                const Vec3f &b = m.vertices[tris[t + 1]].position;
+                const Vec3f &c = m.vertices[tris[t + 2]].position;
+                EXPECT_GE((b - a).cross(c - a).dot(a - eye), 0.0f);
+            }
+        }
+    }
+
+    // Roughly half of a sphere faces away from any viewpoint outside it.
+    EXPECT_GT(culled, 64u * mm.meshletCount() / 5);
+}
+
+TEST (Meshlet_Test, Cull) {
+    const Mesh m = fixture::grid(32, 32);
+    MeshletMesh mm(m);
+    std::vector<u32> indices;
+
+    // Everything is in the default frustum; the grid faces +z.
+    EXPECT_EQ(mm.meshletCount(), mm.cull(Frustum(), Vec3f(16.0f, 16.0f, 10.0f), indices));
+    EXPECT_EQ(sortedTriangles(m.indices), sortedTriangles(indices));
+
+    EXPECT_EQ(0u, mm.cull(Frustum(), Vec3f(16.0f, 16.0f, -10.0f), indices));
+    EXPECT_TRUE(indices.empty());
+
+    // Camera at (0, 0, 10) looking down -z with a 90 degree field of view
+    // sees the corner of the grid within 10 units of the origin.
+    const float n = 1.0f;
+    const float f = 100.0f;
+    const Mat4f projection(1.0f, 0.0f, 0.0f, 0.0f,
+                           0.0f, 1.0f, 0.0f, 0.0f,
+                           0.0f, 0.0f, -(f + n) / (f - n), -1.0f,
+                           0.0f, 0.0f, -(2.0f * f * n) / (f - n), 0.0f);
+    const Mat4f view(1.0f, 0.0f, 0.0f, 0.0f,
+                     0.0f, 1.0f, 0.0f, 0.0f,
+                     0.0f, 0.0f, 1.0f, 0.0f,
+                     0.0f, 0.0f, -10.0f, 1.0f);
+    const u32 visible = mm.cull(Frustum(projection * view), Vec3f(0.0f, 0.0f, 10.0f), indices);
+    EXPECT_GT(visible, 0u);
+    EXPECT_LT(visible, mm.meshletCount());
+    EXPECT_EQ(indices.size() % 3, 0u);
+
+    // Every triangle in view was kept.
+    const auto kept = sortedTriangles(indices);
+    for (size_t t = 0; t < m.indices.size(); t += 3) {
+        const Vec3f &a = m.vertices[m.indices[t]].position;
+        if (a.x < 9.0f && a.y < 9.0f) {
+            EXPECT_TRUE(std::binary_search(kept.begin(), kept.end(),
+                                           std::array<u32, 3>{{m.indices[t], m.indices[t + 1], m.indices[t + 2]}}));
+        }
+    }
+}
@@ -0,0 +1,226 @@
+//
+// Mesh Normal and Tangent Generation Tests
+//
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "lib.h"
+#include "meshfixtures.h"
+
+using sge::CornerTable;
+using sge::Mesh;
+using sge::Vertex;
+
+static constexpr float kEpsilon = 1e-5f;
+
+// Corner angles come from an approximate atan2, so weights are only good
+// to about 1e-4.
+static constexpr float kWeightEpsilon = 2e-4f;
+
+// A grid with no normals, and texture coordinates u = x * uScale, v = y.
+static Mesh grid (const u32 w, const u32 h, const float uScale = 1.0f) {
+    return fixture::grid(w, h, uScale, 1.0f, Vec3f_Zero);
+}
+
+// A unit cube sharing its 8 corners between all of its faces.
+static Mesh weldedCube () {
+    Mesh m;
+    for (u32 i = 0; i < 8; ++i) {
+        m.addVertex(Vertex((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f,
+                           0, 0, 0, 0, 0, 255, 255, 255, 255));
+    }
+    const u32 quads[6][4] = {{0, 2, 3, 1}, {4, 5, 7, 6}, {0, 1, 5, 4},
+                             {2, 6, 7, 3}, {0, 4, 6, 2}, {1, 3, 7, 5}};
+    for (const auto &q : quads) {
+        m.addFace(q[0], q[1], q[2]);
+        m.addFace(q[0], q[2], q[3]);
+    }
+    return m;
+}
+
+// Every face normal points away from the centre of the cube.
+static void expectOutward (const Mesh &m) {
+    for (u32 f = 0; f < m.faceCount(); ++f) {
+        const Vec3f &a = m.vertices[m.indices[f * 3]].position;
+        const Vec3f &b = m.vertices[m.indices[f * 3 + 1]].position;
+        const Vec3f &c = m.vertices[m.indices[f * 3 + 2]].position;
+        EXPECT_GT((b - a).cross(c - a).dot(a + b + c), 0.0f);
+    }
+}
+
+TEST (MeshNormals_Test, Flat_Grid) {
+    Mesh m = grid(8, 6);
+    const u32 count = m.vertCount();
+    m.generateNormals();
+
+    EXPECT_EQ(count, m.vertCount());
+    for (const Vertex &v : m.vertices) {
+        EXPECT_NEAR(0.0f, v.normal.x, kEpsilon);
+        EXPECT_NEAR(0.0f, v.normal.y, kEpsilon);
+        EXPECT_NEAR(1.0f, v.normal.z, kEpsilon);
+    }
+}
+
+TEST (MeshNormals_Test, Cube_Hard_Edges) {
+    Mesh m = weldedCube();
+    expectOutward(m);
+    m.generateNormals();
+
+    // Every corner is split into one vertex per face.
+    EXPECT_EQ(24u, m.vertCount());
+    EXPECT_EQ(36u, m.indexCount());
+    for (u32 f = 0; f < m.faceCount(); ++f) {
+        const Vec3f &a = m.vertices[m.indices[f * 3]].position;
+        const Vec3f &b = m.vertices[m.indices[f * 3 + 1]].position;
+        const Vec3f &c = m.vertices[m.indices[f * 3 + 2]].position;
+        const Vec3f expected = (b - a).cross(c - a).normalize();
+        for (u32 k = 0; k < 3; ++k) {
+            const Vec3f &n = m.vertices[m.indices[f * 3 + k]].normal;
+            EXPECT_NEAR(expected.x, n.x, kEpsilon);
+            EXPECT_NEAR(expected.y, n.y, kEpsilon);
+            EXPECT_NEAR(expected.z, n.z, kEpsilon);
+        }
+    }
+}
+
+TEST (MeshNormals_Test, Cube_Smooth) {
+    Mesh m = weldedCube();
+    m.generateNormals(math::kPi);
+
+    // Each corner averages three faces equally, whichever way they are
+    // triangulated.
+    EXPECT_EQ(8u, m.vertCount());
+    for (const Vertex &v : m.vertices) {
+        const Vec3f expected = v.position.normalize();
+        EXPECT_NEAR(expected.x, v.normal.x, kWeightEpsilon);
+        EXPECT_NEAR(expected.y, v.normal.y, kWeightEpsilon);
+        EXPECT_NEAR(expected.z, v.normal.z, kWeightEpsilon);
+    }
+}
+
+TEST (MeshNormals_Test, Smooths_Across_Seams) {
+    // Vertices at the same position but with different texture
+    // coordinates still share one normal.
+    Mesh m = weldedCube();
+    for (u32 f = 0; f < m.faceCount(); ++f) {
+        for (u32 k = 0; k < 3; ++k) {
+            Vertex v = m.vertices[m.indices[f * 3 + k]];
+            v.texCoord = Vec2f(static_cast<float>(f), static_cast<float>(k));
+            m.indices[f * 3 + k] = m.vertCount();
+            m.addVertex(v);
+        }
+    }
+    m.generateNormals(math::kPi);
+
+    EXPECT_EQ(8u + 36u, m.vertCount());
+    for (u32 c = 0; c < m.indexCount(); ++c) {
+        const Vertex &v = m.vertices[m.indices[c]];
+        const Vec3f expected = v.position.normalize();
+        EXPECT_NEAR(expected.x, v.normal.x, kWeightEpsilon);
+        EXPECT_NEAR(expected.y, v.normal.y, kWeightEpsilon);
+        EXPECT_NEAR(expected.z, v.normal.z, kWeightEpsilon);
+    }
+}
+
+TEST (MeshNormals_Test, Threaded_Matches) {
+    Mesh m = grid(200, 100);
+    for (Vertex &v : m.vertices) {
+        v.position.z = sinf(v.position.x * 0.1f) * cosf(v.position.y * 0.07f) * 4.0f;
+    }
+
+    Mesh serial = m;
+    Mesh threaded = m;
+    serial.generateNormals(0.5f, false);
+    threaded.generateNormals(0.5f, true);
+
+    ASSERT_EQ(serial.vertCount(), threaded.vertCount());
+    EXPECT_EQ(serial.indices, threaded.indices);
+    for (u32 i = 0; i < serial.vertCount(); ++i) {
+        EXPECT_EQ(serial.vertices[i].normal, threaded.vertices[i].normal);
+    }
+
+    const std::vector<Vec4f> t1 = serial.generateTangents(false);
+    const std::vector<Vec4f> t2 = serial.generateTangents(true);
+    ASSERT_EQ(t1.size(), t2.size());
+    for (size_t i = 0; i < t1.size(); ++i) {
+        EXPECT_EQ(t1[i], t2[i]);
+    }
+}
+
+TEST (MeshNormals_Test, Update_Deformed) {
+    Mesh m = grid(30, 20);
+    m.generateNormals(math::kPi);
+    const CornerTable table(m);
+
+    for (Vertex &v : m.vertices) {
+        v.position.z = sinf(v.position.x * 0.3f) * 2.0f;
+    }
+    Mesh expected = m;
+    expected.generateNormals(math::kPi);
+    sge::updateNormals(m, table, math::kPi);
+
+    ASSERT_EQ(expected.vertCount(), m.vertCount());
+    for (u32 i = 0; i < m.vertCount(); ++i) {
+        EXPECT_EQ(expected.vertices[i].normal, m.vertices[i].normal);
+    }
+    // Normals lean away from the slope.
+    EXPECT_LT(m.vertices[1].normal.x, 0.0f);
+}
+
+TEST (MeshNormals_Test, Corner_Table) {
+    const Mesh m = weldedCube();
+    const CornerTable table(m);
+
+    ASSERT_EQ(9u, table.cornerOffsets.size());
+    EXPECT_EQ(36u, table.corners.size());
+    for (u32 v = 0; v < 8; ++v) {
+        for (u32 j = table.cornerOffsets[v]; j < table.cornerOffsets[v + 1]; ++j) {
+            EXPECT_EQ(v, m.indices[table.corners[j]]);
+        }
+    }
+    EXPECT_EQ(9u, table.groupOffsets.size());
+    EXPECT_EQ(8u, table.groupVertices.size());
+}
+
+TEST (MeshNormals_Test, Tangents) {
+    Mesh m = grid(4, 4);
+    m.generateNormals();
+    const std::vector<Vec4f> tangents = m.generateTangents();
+
+    ASSERT_EQ(m.vertCount(), tangents.size());
+    for (const Vec4f &t : tangents) {
+        EXPECT_NEAR(1.0f, t.x, kEpsilon);
+        EXPECT_NEAR(0.0f, t.y, kEpsilon);
+        EXPECT_NEAR(0.0f, t.z, kEpsilon);
+        EXPECT_EQ(1.0f, t.w);
+    }
+}
+
+TEST (MeshNormals_Test, Tangents_Mirrored) {
+    Mesh m = grid(4, 4, -1.0f);
+    m.generateNormals();
+    const std::vector<Vec4f> tangents = m.generateTangents();
+
+    for (const Vec4f &t : tangents) {
+        EXPECT_NEAR(-1.0f, t.x, kEpsilon);
+        EXPECT_NEAR(0.0f, t.y, kEpsilon);
+        EXPECT_NEAR(0.0f, t.z, kEpsilon);
+        EXPECT_EQ(-1.0f, t.w);
+    }
+}
+
+TEST (MeshNormals_Test, Tangents_Orthogonal) {
+    Mesh m = grid(20, 20, 0.5f);
+    for (Vertex &v : m.vertices) {
+        v.position.z = sinf(v.position.x * 0.4f + v.position.y * 0.2f);
+    }
+    m.generateNormals(math::kPi);
+    const std::vector<Vec4f> tangents = m.generateTangents();
+
+    for (u32 i = 0; i < m.vertCount(); ++i) {
+        const Vec3f t(tangents[i].x, tangents[i].y, tangents[i].z);
+        EXPECT_NEAR(1.0f, t.mag(), kEpsilon);
+        EXPECT_NEAR(0.0f, t.dot(m.vertices[i].normal), 1e-4f);
+        EXPECT_GT(t.x, 0.0f);
+    }
+}
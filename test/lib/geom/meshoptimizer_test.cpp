@@ -0,0 +1,136 @@
+//
+// Mesh Optimizer Tests
+//
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "lib.h"
+#include "meshfixtures.h"
+
+using sge::Mesh;
+using sge::Vertex;
+
+// An indexed grid of w x h quads in the xy plane, triangles shuffled.
+static Mesh shuffledGrid (const u32 w, const u32 h) {
+    Mesh m = fixture::grid(w, h);
+    sge::Random r(5);
+    for (size_t i = m.faceCount() - 1; i > 0; --i) {
+        const size_t j = static_cast<u32>(r.nextInt()) % (i + 1);
+        std::swap_ranges(&m.indices[i * 3], &m.indices[i * 3 + 3], &m.indices[j * 3]);
+    }
+    return m;
+}
+
+// Every triangle as its positions, rotated to start from the smallest so
+// rotations compare equal but windings don't, sorted.
+static std::vector<std::array<float, 9>> triangleSet (const Mesh &m) {
+    std::vector<std::array<float, 9>> tris;
+    for (u32 t = 0; t < m.faceCount(); ++t) {
+        std::array<float, 9> best;
+        for (u32 first = 0; first < 3; ++first) {
+            std::array<float, 9> tri;
+            for (u32 k = 0; k < 3; ++k) {
+                const Vec3f &p = m.vertices[m.indices[t * 3 + (first + k) % 3]].position;
+                tri[k * 3] = p.x;
+                tri[k * 3 + 1] = p.y;
+                tri[k * 3 + 2] = p.z;
+            }
+            if (first == 0 || tri < best) {
+                best = tri;
+            }
+        }
+        tris.push_back(best);
+    }
+    std::sort(tris.begin(), tris.end());
+    return tris;
+}
+
+TEST (MeshOptimizer_Test, Analyze) {
+    const std::vector<u32> one = {0, 1, 2};
+    sge::VertexCacheStats s = sge::analyzeVertexCache(one, 3);
+    EXPECT_EQ(3u, s.transformed);
+    EXPECT_FLOAT_EQ(3.0f, s.acmr);
+    EXPECT_FLOAT_EQ(1.0f, s.atvr);
+
+    // Two triangles sharing an edge.
+    const std::vector<u32> quad = {0, 1, 2, 0, 2, 3};
+    s = sge::analyzeVertexCache(quad, 4);
+    EXPECT_EQ(4u, s.transformed);
+    EXPECT_FLOAT_EQ(2.0f, s.acmr);
+
+    // Vertex 0 is pushed out of a 4 entry FIFO by the time it is reused.
+    const std::vector<u32> fifo = {0, 1, 2, 3, 4, 0};
+    EXPECT_EQ(6u, sge::analyzeVertexCache(fifo, 5, 4).transformed);
+    EXPECT_EQ(5u, sge::analyzeVertexCache(fifo, 5, 5).transformed);
+    EXPECT_FLOAT_EQ(1.2f, sge::analyzeVertexCache(fifo, 5, 3).atvr);
+}
+
+TEST (MeshOptimizer_Test, VertexCache) {
+    Mesh m = shuffledGrid(64, 64);
+    const auto tris = triangleSet(m);
+    const sge::VertexCacheStats before = sge::analyzeVertexCache(m.indices, m.vertCount());
+
+    sge::optimizeVertexCache(m.indices, m.vertCount());
+    const sge::VertexCacheStats after = sge::analyzeVertexCache(m.indices, m.vertCount());
+
+    EXPECT_GT(before.acmr, 2.5f);
+    EXPECT_LT(after.acmr, 0.8f);
+    EXPECT_LT(after.atvr, 1.5f);
+    EXPECT_EQ(tris, triangleSet(m));
+}
+
+TEST (MeshOptimizer_Test, Overdraw) {
+    Mesh m = sge::ICOSphere(Vec3f_Zero, 1.0f).toMesh();
+    m.simplify();
+    Mesh grid = shuffledGrid(32, 32);
+    const u32 base = m.vertCount();
+    for (const Vertex &v : grid.vertices) {
+        m.addVertex(v);
+    }
+    for (const u32 i : grid.indices) {
+        m.indices.push_back(base + i);
+    }
+    const auto tris = triangleSet(m);
+
+    sge::optimizeVertexCache(m.indices, m.vertCount());
+    const sge::VertexCacheStats cached = sge::analyzeVertexCache(m.indices, m.vertCount());
+    sge::optimizeOverdraw(m.indices, m.positions(), 1.05f);
+    const sge::VertexCacheStats sorted = sge::analyzeVertexCache(m.indices, m.vertCount());
+
+    EXPECT_EQ(tris, triangleSet(m));
+    EXPECT_LT(sorted.acmr, cached.acmr * 1.2f);
+}
+
+TEST (MeshOptimizer_Test, VertexFetch) {
+    Mesh m = shuffledGrid(8, 8);
+    m.addVertex(Vertex(100.0f, 0.0f, 0.0f, 0, 0, 1, 0, 0, 255, 255, 255, 255)); // Unused
+    const auto tris = triangleSet(m);
+
+    sge::optimizeVertexFetch(m.vertices, m.indices);
+
+    EXPECT_EQ(81u, m.vertCount());
+    EXPECT_EQ(tris, triangleSet(m));
+
+    // Each vertex is first used in order.
+    u32 next = 0;
+    for (const u32 i : m.indices) {
+        ASSERT_LE(i, next);
+        next = std::max(next, i + 1);
+    }
+}
+
+TEST (MeshOptimizer_Test, Mesh_Optimize) {
+    Mesh m = shuffledGrid(40, 30);
+    const auto tris = triangleSet(m);
+    const float before = sge::analyzeVertexCache(m.indices, m.vertCount()).acmr;
+
+    m.optimize();
+
+    EXPECT_EQ(tris, triangleSet(m));
+    EXPECT_LT(sge::analyzeVertexCache(m.indices, m.vertCount()).acmr, before * 0.5f);
+
+    Mesh empty;
+    empty.optimize();
+    EXPECT_EQ(0u, empty.vertCount());
+}
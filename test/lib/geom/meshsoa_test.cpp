@@ -0,0 +1,84 @@
+//
+// MeshSoA Tests
+//
+#include <gtest/gtest.h>
+#include "lib.h"
+
+using sge::Aabb;
+using sge::Mesh;
+using sge::MeshSoA;
+using sge::Vertex;
+using sge::VertexLayout;
+
+static Mesh randomMesh (const u32 count) {
+    sge::Random r(7);
+    Mesh m;
+    for (u32 k = 0; k < count; ++k) {
+        m.addVertex(Vertex(r.nextFloat(-5.0f, 5.0f), r.nextFloat(-5.0f, 5.0f), r.nextFloat(-5.0f, 5.0f),
+                           r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f),
+                           r.nextFloat(0.0f, 1.0f), r.nextFloat(0.0f, 1.0f),
+                           static_cast<u8>(k), static_cast<u8>(k * 3), static_cast<u8>(k * 7), 255));
+    }
+    for (u32 k = 0; k + 2 < count; k += 3) {
+        m.addFace(k, k + 1, k + 2);
+    }
+    return m;
+}
+
+TEST (MeshSoA_Test, Round_Trip) {
+    const Mesh m = randomMesh(301);
+    const MeshSoA soa(m);
+
+    EXPECT_EQ(m.vertCount(), soa.vertCount());
+    EXPECT_EQ(m.indexCount(), soa.indexCount());
+    EXPECT_EQ(m.faceCount(), soa.faceCount());
+    EXPECT_EQ(m.vertCount(), soa.normals.size());
+    EXPECT_EQ(m.vertCount(), soa.texCoords.size());
+    EXPECT_EQ(m.vertCount(), soa.colors.size());
+
+    for (u32 i = 0; i < m.vertCount(); ++i) {
+        EXPECT_EQ(m.vertices[i].position, soa.positions[i]);
+        EXPECT_EQ(m.vertices[i].color, soa.colors[i]);
+        EXPECT_EQ(m.vertices[i], soa.vertex(i));
+    }
+
+    const Mesh back = soa.toMesh();
+    EXPECT_EQ(m.vertices, back.vertices);
+    EXPECT_EQ(m.indices, back.indices);
+}
+
+TEST (MeshSoA_Test, Add) {
+    MeshSoA soa;
+    soa.addVertex(Vertex(1.0f, 2.0f, 3.0f, 0, 0, 1, 0.5f, 0.25f, 1, 2, 3, 4));
+    soa.addVertex(Vertex(-1.0f, 0.0f, 0.0f, 0, 1, 0, 0, 0, 0, 0, 0, 0));
+    soa.addVertex(Vertex(0.0f, -2.0f, 5.0f, 1, 0, 0, 0, 0, 0, 0, 0, 0));
+    soa.addFace(0, 1, 2);
+
+    EXPECT_EQ(3u, soa.vertCount());
+    EXPECT_EQ(1u, soa.faceCount());
+    EXPECT_EQ(Vec2f(0.5f, 0.25f), soa.texCoords[0]);
+    EXPECT_EQ(Color(1, 2, 3, 4), soa.colors[0]);
+
+    const Aabb box = soa.bounds();
+    EXPECT_EQ(Vec3f(-1.0f, -2.0f, 0.0f), box.min);
+    EXPECT_EQ(Vec3f(1.0f, 2.0f, 5.0f), box.max);
+}
+
+TEST (MeshSoA_Test, Layouts) {
+    const VertexLayout layouts[] = {MeshSoA::positionLayout(), MeshSoA::normalLayout(),
+                                    MeshSoA::texCoordLayout(), MeshSoA::colorLayout()};
+    const VertexLayout full = Vertex::layout();
+
+    // Same locations and formats as an interleaved Vertex, one per buffer.
+    u32 stride = 0;
+    for (u32 i = 0; i < 4; ++i) {
+        ASSERT_EQ(1u, layouts[i].attributes().size());
+        EXPECT_EQ(full.attributes()[i].location, layouts[i].attributes()[0].location);
+        EXPECT_EQ(full.attributes()[i].type, layouts[i].attributes()[0].type);
+        EXPECT_EQ(full.attributes()[i].components, layouts[i].attributes()[0].components);
+        EXPECT_EQ(0u, layouts[i].attributes()[0].offset);
+        stride += layouts[i].stride();
+    }
+    EXPECT_EQ(full.stride(), stride);
+    EXPECT_EQ(12u, MeshSoA::positionLayout().stride());
+}
@@ -0,0 +1,331 @@
+//
+// Wavefront .obj Importer Tests
+//
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+#include "lib.h"
+
+using sge::Mesh;
+using sge::ObjDocument;
+using sge::ObjGroup;
+using sge::ObjMeshGroup;
+
+typedef std::array<u32, 3> IndexTriple;
+
+// A 1-based index to the element at 0-based index i of count, written
+// relative to the end half of the time.
+static void appendIndex (std::string &text, sge::Random &r, const u32 i, const u32 count) {
+    char buffer[16];
+    if (r.nextInt() & 1) {
+        snprintf(buffer, sizeof(buffer), "%d", static_cast<s32>(i) - static_cast<s32>(count));
+    } else {
+        snprintf(buffer, sizeof(buffer), "%u", i + 1);
+    }
+    text += buffer;
+}
+
+// .obj text of groups groups of quads. Each quad adds two positions, a
+// texture coordinate and a normal, and picks its corners from the last
+// few of each, so many corners repeat an index triple. A long comment
+// line sits in the middle.
+static std::string objText (const u32 groups, const u32 quadsPerGroup) {
+    sge::Random r(11);
+    std::string text = "# Generated\no generated\n";
+    char line[128];
+    u32 positions = 0;
+    u32 texCoords = 0;
+    u32 normals = 0;
+
+    for (u32 g = 0; g < groups; ++g) {
+        snprintf(line, sizeof(line), "g group%u\n", g);
+        text += line;
+        if (g == groups / 2) {
+            text += "# " + std::string(300, 'x') + "\n";
+        }
+
+        for (u32 q = 0; q < quadsPerGroup; ++q) {
+            for (u32 k = 0; k < 2; ++k, ++positions) {
+                snprintf(line, sizeof(line), "v %.6f %.6f %.6f\n", r.nextFloat(-10.0f, 10.0f),
+                         r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+                text += line;
+            }
+            snprintf(line, sizeof(line), "vt %.6f %.6f\n", r.nextFloat(), r.nextFloat());
+            text += line;
+            ++texCoords;
+            snprintf(line, sizeof(line), "vn %.6f %.6f %.6f\n", r.nextFloat(), r.nextFloat(), 1.0f);
+            text += line;
+            ++normals;
+
+            text += "f";
+            for (u32 c = 0; c < 4; ++c) {
+                const u32 p = positions - 1 - static_cast<u32>(r.nextInt()) % std::min(positions, 6u);
+                const u32 t = texCoords - 1 - static_cast<u32>(r.nextInt()) % std::min(texCoords, 3u);
+                const u32 n = normals - 1 - static_cast<u32>(r.nextInt()) % std::min(normals, 2u);
+                text += " ";
+                appendIndex(text, r, p, positions);
+                text += "/";
+                appendIndex(text, r, t, texCoords);
+                text += "/";
+                appendIndex(text, r, n, normals);
+            }
+            text += "\n";
+        }
+    }
+    return text;
+}
+
+static ObjDocument parse (const std::string &text, const size_t chunks = 1) {
+    return ObjDocument(text.data(), text.data() + text.size(), chunks);
+}
+
+static void expectSameDocument (const ObjDocument &a, const ObjDocument &b) {
+    ASSERT_EQ(a.isValid(), b.isValid());
+    EXPECT_EQ(a.name, b.name);
+    ASSERT_EQ(a.vertexCount(), b.vertexCount());
+    for (size_t i = 0; i < a.vertexCount(); ++i) {
+        EXPECT_EQ(a.position(static_cast<s32>(i)), b.position(static_cast<s32>(i)));
+    }
+    ASSERT_EQ(a.groups.size(), b.groups.size());
+    for (size_t g = 0; g < a.groups.size(); ++g) {
+        EXPECT_EQ(a.groups[g].name, b.groups[g].name);
+        EXPECT_EQ(a.groups[g].positionIndex, b.groups[g].positionIndex);
+        EXPECT_EQ(a.groups[g].textureIndex, b.groups[g].textureIndex);
+        EXPECT_EQ(a.groups[g].normalIndex, b.groups[g].normalIndex);
+    }
+}
+
+static std::string tempPath (const char *name) {
+    return ::testing::TempDir() + name;
+}
+
+static void writeFile (const std::string &path, const std::string &text) {
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file) {
+        fwrite(text.data(), 1, text.size(), file);
+        fclose(file);
+    }
+}
+
+TEST (Obj_Test, Parse_Elements) {
+    const ObjDocument doc = parse("# A quad and a triangle\n"
+                                  "o Thing\n"
+                                  "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                                  "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+                                  "vn 0 0 1\n"
+                                  "g top\n"
+                                  "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+                                  "g bottom\n"
+                                  "f -4/-4/-1 -2/-2/-1 -3/-3/-1\n");
+
+    ASSERT_TRUE(doc.isValid());
+    EXPECT_EQ("Thing", doc.name);
+    EXPECT_EQ(4u, doc.vertexCount());
+    EXPECT_TRUE(doc.hasNormals());
+    EXPECT_TRUE(doc.hasTexture());
+    EXPECT_EQ(Vec3f(1.0f, 1.0f, 0.0f), doc.position(2));
+    EXPECT_EQ(Vec2f(0.0f, 1.0f), doc.texCoord(3));
+    EXPECT_EQ(Vec3f(0.0f, 0.0f, 1.0f), doc.normal(0));
+
+    ASSERT_EQ(2u, doc.groups.size());
+    EXPECT_EQ(3u, doc.faceCount());
+
+    // The quad is split into a fan around its first corner.
+    const ObjGroup &top = doc.groups[0];
+    EXPECT_EQ("top", top.name);
+    EXPECT_EQ(std::vector<u32>({0, 1, 2, 0, 2, 3}), top.positionIndex);
+    EXPECT_EQ(std::vector<u32>({0, 1, 2, 0, 2, 3}), top.textureIndex);
+    EXPECT_EQ(std::vector<u32>(6, 0), top.normalIndex);
+
+    // Relative indices count back from the last element read.
+    const ObjGroup &bottom = doc.groups[1];
+    EXPECT_EQ("bottom", bottom.name);
+    EXPECT_EQ(std::vector<u32>({0, 2, 1}), bottom.positionIndex);
+    EXPECT_EQ(std::vector<u32>({0, 2, 1}), bottom.textureIndex);
+}
+
+TEST (Obj_Test, Faces_Before_A_Group_Are_Default) {
+    const ObjDocument doc = parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\ng named\nf 3 2 1\n");
+    ASSERT_TRUE(doc.isValid());
+    ASSERT_EQ(2u, doc.groups.size());
+    EXPECT_EQ("default", doc.groups[0].name);
+    EXPECT_EQ("named", doc.groups[1].name);
+    EXPECT_FALSE(doc.hasNormals());
+    EXPECT_FALSE(doc.hasTexture());
+}
+
+TEST (Obj_Test, Rejects_Malformed_Lines) {
+    EXPECT_FALSE(parse("v 0 0\n").isValid());
+    EXPECT_FALSE(parse("v 0 0 0\nv 1 0 0\nf 1 2 3\n").isValid());
+    EXPECT_FALSE(parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2\n").isValid());
+    EXPECT_FALSE(parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 -4\n").isValid());
+    EXPECT_FALSE(parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nvn 0 0 1\nf 1//1 2//1 3//2\n").isValid());
+    EXPECT_FALSE(parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3x\n").isValid());
+}
+
+TEST (Obj_Test, Ignores_Indices_Of_Missing_Elements) {
+    // Some exporters write normal and texture indices without the elements.
+    const ObjDocument doc = parse("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1/1/1 2/1/1 3/1/1\nf 1//5 2//5 3//5\n");
+    ASSERT_TRUE(doc.isValid());
+    EXPECT_EQ(2u, doc.faceCount());
+}
+
+TEST (Obj_Test, Chunked_Matches_Serial) {
+    // Few groups against many chunks, so groups continue across chunks.
+    const std::string text = objText(5, 600);
+    const ObjDocument serial = parse(text);
+    ASSERT_TRUE(serial.isValid());
+    ASSERT_EQ(5u, serial.groups.size());
+    EXPECT_EQ(5u * 600u * 2u, serial.faceCount());
+
+    for (const size_t chunks : {2, 3, 4, 7, 16, 64}) {
+        SCOPED_TRACE(chunks);
+        expectSameDocument(serial, parse(text, chunks));
+    }
+
+    // More chunks than lines leaves most of them empty.
+    const std::string small = "o small\nv 0 0 0\nv 1 0 0\nv 0 1 0\ng a\nf 1 2 3\nf -1 -2 -3\n";
+    expectSameDocument(parse(small), parse(small, 1000));
+}
+
+TEST (Obj_Test, Chunked_Stops_At_First_Error) {
+    std::string text = objText(4, 300);
+    const size_t middle = text.find('\n', text.size() / 2) + 1;
+    text.insert(middle, "f 1 2\n");
+
+    for (const size_t chunks : {1, 2, 5, 9}) {
+        EXPECT_FALSE(parse(text, chunks).isValid()) << chunks;
+    }
+}
+
+TEST (Obj_Test, File_Matches_Memory) {
+    const std::string text = objText(3, 200);
+    const std::string path = tempPath("sge_obj_file.obj");
+    writeFile(path, text);
+
+    expectSameDocument(parse(text), ObjDocument(path.c_str()));
+    expectSameDocument(parse(text), ObjDocument(path.c_str(), true));
+    EXPECT_FALSE(ObjDocument("no/such/file.obj").isValid());
+
+    remove(path.c_str());
+}
+
+TEST (Obj_Test, Mesh_Welds_Index_Triples) {
+    // A cube of 8 positions and 6 normals: 24 distinct corners.
+    const ObjDocument cube = parse("v -1 -1 -1\nv 1 -1 -1\nv -1 1 -1\nv 1 1 -1\n"
+                                   "v -1 -1 1\nv 1 -1 1\nv -1 1 1\nv 1 1 1\n"
+                                   "vn 0 0 -1\nvn 0 0 1\nvn 0 -1 0\nvn 0 1 0\nvn -1 0 0\nvn 1 0 0\n"
+                                   "f 1//1 3//1 4//1 2//1\nf 5//2 6//2 8//2 7//2\n"
+                                   "f 1//3 2//3 6//3 5//3\nf 3//4 7//4 8//4 4//4\n"
+                                   "f 1//5 5//5 7//5 3//5\nf 2//6 4//6 8//6 6//6\n");
+    const Mesh m = sge::meshFromObjDocument(cube);
+    EXPECT_EQ(24u, m.vertCount());
+    EXPECT_EQ(36u, m.indexCount());
+
+    // Every corner of a generated document keeps its attributes, with one
+    // vertex per distinct index triple.
+    const ObjDocument doc = parse(objText(3, 400));
+    const Mesh mesh = sge::meshFromObjDocument(doc);
+    std::set<IndexTriple> triples;
+    u32 c = 0;
+    for (const ObjGroup &g : doc.groups) {
+        for (size_t k = 0; k < g.vertexCount(); ++k, ++c) {
+            triples.insert({{g.positionIndex[k], g.textureIndex[k], g.normalIndex[k]}});
+            const sge::Vertex &v = mesh.vertices[mesh.indices[c]];
+            EXPECT_EQ(doc.position(g.positionIndex[k]), v.position);
+            EXPECT_EQ(doc.texCoord(g.textureIndex[k]), v.texCoord);
+            EXPECT_EQ(doc.normal(g.normalIndex[k]), v.normal);
+        }
+    }
+    EXPECT_EQ(triples.size(), mesh.vertCount());
+    EXPECT_LT(mesh.vertCount(), mesh.indexCount());
+}
+
+TEST (Obj_Test, Stream_Matches_Document) {
+    const std::string text = objText(4, 300);
+    const std::string path = tempPath("sge_obj_stream.obj");
+    writeFile(path, text);
+    const ObjDocument doc = parse(text);
+    ASSERT_TRUE(doc.isValid());
+
+    // Blocks smaller than the long comment line have to grow.
+    for (const size_t blockSize : {size_t(64), size_t(4096), sge::kObjStreamBlockSize}) {
+        SCOPED_TRACE(blockSize);
+        size_t g = 0;
+        const bool ok = sge::readObjStream(path.c_str(), [&](ObjMeshGroup &group) {
+            ASSERT_LT(g, doc.groups.size());
+            const ObjGroup &expected = doc.groups[g++];
+            EXPECT_EQ("generated", group.object);
+            EXPECT_EQ(expected.name, group.name);
+            EXPECT_EQ(0u, group.part);
+
+            const Mesh &m = group.mesh;
+            ASSERT_EQ(expected.vertexCount(), m.indexCount());
+            std::set<IndexTriple> triples;
+            for (size_t k = 0; k < expected.vertexCount(); ++k) {
+                triples.insert({{expected.positionIndex[k], expected.textureIndex[k], expected.normalIndex[k]}});
+                const sge::Vertex &v = m.vertices[m.indices[k]];
+                EXPECT_EQ(doc.position(expected.positionIndex[k]), v.position);
+                EXPECT_EQ(doc.texCoord(expected.textureIndex[k]), v.texCoord);
+                EXPECT_EQ(doc.normal(expected.normalIndex[k]), v.normal);
+            }
+            EXPECT_EQ(triples.size(), m.vertCount());
+        }, 0, blockSize);
+        EXPECT_TRUE(ok);
+        EXPECT_EQ(doc.groups.size(), g);
+    }
+
+    remove(path.c_str());
+}
+
+TEST (Obj_Test, Stream_Splits_Groups) {
+    const std::string text = objText(2, 250);
+    const std::string path = tempPath("sge_obj_stream_parts.obj");
+    writeFile(path, text);
+
+    // Quads add two faces at a time, so a part can pass maxFaces by one.
+    const size_t maxFaces = 99;
+    std::vector<std::string> names;
+    std::vector<u32> parts;
+    size_t faces = 0;
+    ASSERT_TRUE(sge::readObjStream(path.c_str(), [&](ObjMeshGroup &group) {
+        EXPECT_LE(group.mesh.faceCount(), maxFaces + 1);
+        names.push_back(group.name);
+        parts.push_back(group.part);
+        faces += group.mesh.faceCount();
+    }, maxFaces, 256));
+
+    // 500 faces a group, in parts of 100.
+    EXPECT_EQ(2u * 250u * 2u, faces);
+    ASSERT_EQ(10u, names.size());
+    for (size_t k = 0; k < names.size(); ++k) {
+        EXPECT_EQ((k < 5) ? "group0" : "group1", names[k]);
+        EXPECT_EQ(k % 5, parts[k]);
+    }
+
+    EXPECT_FALSE(sge::readObjStream("no/such/file.obj", [](ObjMeshGroup &) { }));
+    remove(path.c_str());
+}
+
+TEST (Obj_Test, Stream_Objects_Restart_Groups) {
+    const std::string path = tempPath("sge_obj_stream_objects.obj");
+    writeFile(path, "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+                    "f 1 2 3\no A\nf 1 2 3\ng x\nf -3 -2 -1\no B\nf 3 2 1\n");
+
+    std::vector<std::string> names;
+    ASSERT_TRUE(sge::readObjStream(path.c_str(), [&](ObjMeshGroup &group) {
+        names.push_back(group.object + "/" + group.name);
+
+        // No normals in the file, so they are generated. B's face is
+        // wound the other way.
+        const float z = (group.object == "B") ? -1.0f : 1.0f;
+        EXPECT_EQ(Vec3f(0.0f, 0.0f, z), group.mesh.vertices[0].normal);
+    }));
+    EXPECT_EQ(std::vector<std::string>({"untitled_obj/default", "A/default", "A/x", "B/default"}), names);
+
+    remove(path.c_str());
+}
@@ -0,0 +1,84 @@
+//
+// PackedMesh Tests
+//
+#include <gtest/gtest.h>
+#include "lib.h"
+
+using sge::Aabb;
+using sge::Mesh;
+using sge::PackedMesh;
+using sge::PackedVertex;
+using sge::Vertex;
+using sge::VertexLayout;
+
+TEST (PackedMesh_Test, Layouts) {
+    const VertexLayout full = Vertex::layout();
+    const VertexLayout packed = PackedVertex::layout();
+
+    EXPECT_EQ(36u, full.stride());
+    EXPECT_EQ(20u, packed.stride());
+    ASSERT_EQ(4u, full.attributes().size());
+    ASSERT_EQ(4u, packed.attributes().size());
+
+    // Same attribute locations, so either can be bound to the same VAO slots.
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(full.attributes()[i].location, packed.attributes()[i].location);
+    }
+    EXPECT_EQ(32u, full.attributes()[3].offset);
+    EXPECT_EQ(sge::kSnorm16, packed.attributes()[0].type);
+    EXPECT_EQ(2u, packed.attributes()[1].components);
+    EXPECT_TRUE(VertexLayout::isNormalized(sge::kUnorm8));
+    EXPECT_FALSE(VertexLayout::isNormalized(sge::kFloat16));
+}
+
+TEST (PackedMesh_Test, Round_Trip) {
+    const Mesh m = sge::ICOSphere(Vec3f(10.0f, -2.0f, 3.0f), 5.0f).toMesh();
+    const PackedMesh p(m);
+
+    Aabb bounds;
+    for (const Vertex &v : m.vertices) {
+        bounds.addPoint(v.position);
+    }
+    const Vec3f size = bounds.max - bounds.min;
+
+    ASSERT_EQ(m.vertCount(), p.vertCount());
+    EXPECT_EQ(m.indices, p.indices);
+    EXPECT_TRUE(bounds.center().compare(p.center, 1e-6f));
+    EXPECT_EQ(math::max(size.x, math::max(size.y, size.z)) * 0.5f, p.scale);
+
+    // Positions within half a step of scale / 32767.
+    const Mesh u = p.unpack();
+    for (size_t i = 0; i < m.vertices.size(); ++i) {
+        EXPECT_TRUE(m.vertices[i].position.compare(u.vertices[i].position, 1e-4f));
+        EXPECT_TRUE(m.vertices[i].normal.compare(u.vertices[i].normal, 1e-4f));
+        EXPECT_TRUE(m.vertices[i].texCoord.compare(u.vertices[i].texCoord, 1e-3f));
+        EXPECT_EQ(m.vertices[i].color, u.vertices[i].color);
+    }
+
+    // decodeMatrix maps packed positions to mesh space.
+    const Mat4f d = p.decodeMatrix();
+    for (size_t i = 0; i < m.vertices.size(); ++i) {
+        const PackedVertex &v = p.vertices[i];
+        const Vec4f q(math::unpackSnorm16(v.position[0]), math::unpackSnorm16(v.position[1]),
+                      math::unpackSnorm16(v.position[2]), 1.0f);
+        EXPECT_TRUE(u.vertices[i].position.compare((d * q).xyz(), 1e-5f));
+    }
+}
+
+TEST (PackedMesh_Test, Flat_And_Empty) {
+    // A plane has no height, and a point has no extent at all.
+    const Mesh plane = sge::Plane(Vec3f_Zero, Vec2f(4.0f, 2.0f)).toMesh();
+    const PackedMesh p(plane);
+    EXPECT_NEAR(2.0f, p.scale, 1e-6f);
+    for (size_t i = 0; i < plane.vertices.size(); ++i) {
+        EXPECT_TRUE(plane.vertices[i].position.compare(p.vertex(i).position, 1e-4f));
+    }
+
+    Mesh point;
+    point.addVertex(Vertex(1.0f, 2.0f, 3.0f, 0, 1, 0, 0, 0, 1, 2, 3, 4));
+    const PackedMesh q(point);
+    EXPECT_EQ(1.0f, q.scale);
+    EXPECT_EQ(point.vertices[0], q.vertex(0));
+
+    EXPECT_EQ(0u, PackedMesh(Mesh()).vertCount());
+}
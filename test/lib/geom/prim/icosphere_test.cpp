@@ -0,0 +1,61 @@
+//
+// ICOSphere Tests
+//
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "lib.h"
+
+using sge::ICOSphere;
+using sge::Mesh;
+
+TEST (ICOSphere_Test, Counts) {
+    for (u32 level = 0; level <= 5; ++level) {
+        const Mesh m = ICOSphere(Vec3f_Zero, 1.0f, level).toMesh();
+        EXPECT_EQ(20u << (2 * level), m.faceCount());
+        EXPECT_EQ((10u << (2 * level)) + 2, m.vertCount());
+    }
+}
+
+TEST (ICOSphere_Test, No_Duplicate_Vertices) {
+    Mesh m = ICOSphere(Vec3f_Zero, 1.0f, 3).toMesh();
+    const u32 count = m.vertCount();
+    m.simplify();
+    EXPECT_EQ(count, m.vertCount());
+}
+
+TEST (ICOSphere_Test, On_Sphere) {
+    const Vec3f center(1.0f, -2.0f, 3.0f);
+    const Mesh m = ICOSphere(center, 4.0f, 2).toMesh();
+
+    for (const sge::Vertex &v : m.vertices) {
+        EXPECT_NEAR(2.0f, (v.position - center).mag(), 1e-5f);
+        EXPECT_NEAR(1.0f, v.normal.mag(), 1e-5f);
+        EXPECT_TRUE(((v.position - center) * 0.5f).compare(v.normal, 1e-5f));
+    }
+}
+
+TEST (ICOSphere_Test, Closed_And_Outward) {
+    const Vec3f center(0.0f, 5.0f, 0.0f);
+    const Mesh m = ICOSphere(center, 2.0f, 3).toMesh();
+
+    // Every edge is used once in each direction.
+    std::vector<std::pair<u32, u32>> edges;
+    for (u32 f = 0; f < m.faceCount(); ++f) {
+        const u32 *t = &m.indices[f * 3];
+        for (u32 k = 0; k < 3; ++k) {
+            edges.emplace_back(t[k], t[(k + 1) % 3]);
+        }
+
+        const Vec3f &a = m.vertices[t[0]].position;
+        const Vec3f &b = m.vertices[t[1]].position;
+        const Vec3f &c = m.vertices[t[2]].position;
+        EXPECT_GT((b - a).cross(c - a).dot(a + b + c - center * 3.0f), 0.0f);
+    }
+    std::sort(edges.begin(), edges.end());
+    EXPECT_TRUE(std::adjacent_find(edges.begin(), edges.end()) == edges.end());
+    for (const auto &e : edges) {
+        EXPECT_TRUE(std::binary_search(edges.begin(), edges.end(), std::make_pair(e.second, e.first)));
+    }
+}
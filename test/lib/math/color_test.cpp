@@ -33,3 +33,13 @@ TEST (Color_Test, toVec4f) {
     EXPECT_EQ(Vec4f(0.0f, 0.0f, 0.0f, 255.0f), Color::fromHex("#000").toVec4f());
     EXPECT_EQ(Vec4f(0.0f, 0.0f, 0.0f, 1.0f), Color::fromHex("#000").toVec4f(true));
 }
+
+TEST (Color_Test, ConstantExpression) {
+    static constexpr Color kOrange = Color::fromHex("#FF8000");
+    static_assert(kOrange == Color(255, 128, 0, 255), "fromHex is a constant expression");
+    static_assert(Color::fromHex("#08F8") == Color(0x0088FF88u), "short form expands");
+    static_assert(Color::fromHex("#LLMMNN") == Color(0u), "stops at invalid digit");
+    static_assert(kOrange.isOpaque() && !kOrange.isHidden(), "");
+
+    EXPECT_EQ(Color(255, 128, 0, 255), kOrange);
+}
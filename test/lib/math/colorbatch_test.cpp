@@ -0,0 +1,210 @@
+//
+// Batch Color Tests
+//
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "lib.h"
+
+using sge::Vertex;
+
+static constexpr Color kClear(0, 0, 0, 0);
+
+static std::vector<Color> randomColors (sge::Random &r, const size_t count) {
+    std::vector<Color> c;
+    for (size_t k = 0; k < count; ++k) {
+        c.emplace_back(static_cast<u32>(r.nextInt()));
+    }
+    return c;
+}
+
+// Every 8 bit grey, primary and secondary, then random colors.
+static std::vector<Color> testColors () {
+    std::vector<Color> c;
+    for (int i = 0; i < 256; ++i) {
+        const u8 v = static_cast<u8>(i);
+        c.emplace_back(v, v, v, v);
+        c.emplace_back(v, 0, 0);
+        c.emplace_back(0, v, 0);
+        c.emplace_back(0, 0, v);
+        c.emplace_back(v, v, 0);
+        c.emplace_back(0, v, v);
+        c.emplace_back(v, 0, v);
+    }
+
+    sge::Random r(11);
+    const std::vector<Color> rc = randomColors(r, 4099);
+    c.insert(c.end(), rc.begin(), rc.end());
+    return c;
+}
+
+static ::testing::AssertionResult near (const Color &a, const Color &b, const int tolerance) {
+    if (std::abs(a.r - b.r) <= tolerance && std::abs(a.g - b.g) <= tolerance &&
+        std::abs(a.b - b.b) <= tolerance && std::abs(a.a - b.a) <= tolerance) {
+        return ::testing::AssertionSuccess();
+    }
+    return ::testing::AssertionFailure()
+          << "(" << +a.r << ", " << +a.g << ", " << +a.b << ", " << +a.a << ") vs ("
+          << +b.r << ", " << +b.g << ", " << +b.b << ", " << +b.a << ")";
+}
+
+TEST (ColorBatch_Test, Pack_Unpack_Match_Color) {
+    sge::Random r(1);
+
+    // Cover every tail length either side of the SIMD block sizes.
+    for (size_t count = 0; count < 20; ++count) {
+        const std::vector<Color> in = randomColors(r, count);
+        std::vector<u32> packed(count);
+        std::vector<Color> out(count, kClear);
+
+        packColors(in, packed);
+        unpackColors(packed, out);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(in[i].toU32(), packed[i]);
+            EXPECT_EQ(in[i], out[i]);
+        }
+    }
+
+    EXPECT_EQ(0x11223344u, Color(0x11223344).toU32());
+}
+
+TEST (ColorBatch_Test, Vec4f_Match_Color) {
+    const std::vector<Color> in = testColors();
+    std::vector<Vec4f> v(in.size());
+    std::vector<Color> out(in.size(), kClear);
+
+    colorsToVec4f(in, v);
+    colorsFromVec4f(v, out);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(in[i].toVec4f(true), v[i]);
+        EXPECT_EQ(in[i], out[i]);
+    }
+
+    // Rounds to nearest and saturates.
+    sge::Random r(2);
+    std::vector<Vec4f> f;
+    for (size_t k = 0; k < 1001; ++k) {
+        f.emplace_back(r.nextFloat(-0.5f, 1.5f), r.nextFloat(-0.5f, 1.5f),
+                       r.nextFloat(-0.5f, 1.5f), r.nextFloat(-0.5f, 1.5f));
+    }
+    out.resize(f.size(), kClear);
+    colorsFromVec4f(f, out);
+    for (size_t i = 0; i < f.size(); ++i) {
+        EXPECT_EQ(Color::fromVec4f(f[i], true), out[i]);
+    }
+    EXPECT_EQ(Color(0, 128, 255, 255), Color::fromVec4f(Vec4f(-1.0f, 127.5f, 254.6f, 300.0f)));
+}
+
+TEST (ColorBatch_Test, Linear_Match_Color) {
+    const std::vector<Color> in = testColors();
+    std::vector<Vec4f> lin(in.size());
+    std::vector<Color> out(in.size(), kClear);
+
+    colorsToLinear(in, lin);
+    colorsFromLinear(lin, out);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(in[i].toLinear(), lin[i]);
+        EXPECT_EQ(in[i], Color::fromLinear(lin[i]));
+        EXPECT_TRUE(near(in[i], out[i], 1));
+    }
+
+    EXPECT_EQ(Vec4f(0.0f, 1.0f, 1.0f, 1.0f), Color(0, 255, 255, 255).toLinear());
+    EXPECT_NEAR(0.2158605f, Color(128, 0, 0).toLinear().x, 1e-6f);
+}
+
+TEST (ColorBatch_Test, Srgb_Floats) {
+    std::vector<float> in;
+    for (int i = 0; i <= 10000; ++i) {
+        in.push_back(static_cast<float>(i) / 10000.0f);
+    }
+    std::vector<float> lin(in.size());
+    std::vector<float> enc(in.size());
+
+    srgbToLinear(in, lin);
+    linearToSrgb(in, enc);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_NEAR(srgbToLinear(in[i]), lin[i], 1e-6f);
+        EXPECT_NEAR(linearToSrgb(in[i]), enc[i], 1e-6f);
+        EXPECT_NEAR(in[i], linearToSrgb(srgbToLinear(in[i])), 1e-5f);
+    }
+}
+
+TEST (ColorBatch_Test, HSL_HSV_Match_Color) {
+    const std::vector<Color> in = testColors();
+    std::vector<Vec3f> hsl(in.size());
+    std::vector<Vec3f> hsv(in.size());
+    std::vector<Color> outHSL(in.size(), kClear);
+    std::vector<Color> outHSV(in.size(), kClear);
+
+    colorsToHSL(in, hsl);
+    colorsToHSV(in, hsv);
+    colorsFromHSL(hsl, outHSL);
+    colorsFromHSV(hsv, outHSV);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_TRUE(in[i].toHSL().compare(hsl[i], 1e-5f));
+        EXPECT_TRUE(in[i].toHSV().compare(hsv[i], 1e-5f));
+
+        const Color opaque(in[i].r, in[i].g, in[i].b);
+        EXPECT_TRUE(near(Color::fromHSL(hsl[i].x, hsl[i].y, hsl[i].z), outHSL[i], 1));
+        EXPECT_TRUE(near(Color::fromHSV(hsv[i].x, hsv[i].y, hsv[i].z), outHSV[i], 1));
+        EXPECT_TRUE(near(opaque, outHSL[i], 1));
+        EXPECT_TRUE(near(opaque, outHSV[i], 1));
+    }
+}
+
+TEST (ColorBatch_Test, FromHSL_Sweep) {
+    // Includes hues outside 0..360, which give greys.
+    sge::Random r(4);
+    std::vector<Vec3f> in;
+    for (size_t k = 0; k < 4003; ++k) {
+        in.emplace_back(r.nextFloat(-30.0f, 390.0f), r.nextFloat(0.0f, 1.0f), r.nextFloat(0.0f, 1.0f));
+    }
+    for (int h = 0; h <= 360; h += 15) {
+        in.emplace_back(static_cast<float>(h), 1.0f, 0.5f);
+    }
+    std::vector<Color> hsl(in.size(), kClear);
+    std::vector<Color> hsv(in.size(), kClear);
+
+    colorsFromHSL(in, hsl);
+    colorsFromHSV(in, hsv);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_TRUE(near(Color::fromHSL(in[i].x, in[i].y, in[i].z), hsl[i], 1));
+        EXPECT_TRUE(near(Color::fromHSV(in[i].x, in[i].y, in[i].z), hsv[i], 1));
+    }
+
+    EXPECT_EQ(Color(255, 0, 0), Color::fromHSV(0.0f));
+    EXPECT_EQ(Color(0, 255, 0), Color::fromHSV(120.0f));
+    EXPECT_EQ(Color(0, 0, 127), Color::fromHSV(240.0f, 1.0f, 0.5f));
+}
+
+TEST (ColorBatch_Test, Strided_Vertex_Colors) {
+    sge::Random r(6);
+    std::vector<Vertex> verts;
+    for (size_t k = 0; k < 13; ++k) {
+        verts.emplace_back(Vec3f_Zero, Vec3f_Zero, Vec2f_Zero, Color(static_cast<u32>(r.nextInt())));
+    }
+    StridedSpan<Color> colors(&verts[0].color, verts.size(), sizeof(Vertex));
+
+    std::vector<Vec3f> hsl(verts.size());
+    std::vector<u32> packed(verts.size());
+    colorsToHSL(colors, hsl);
+    packColors(colors, packed);
+
+    for (size_t i = 0; i < verts.size(); ++i) {
+        EXPECT_TRUE(verts[i].color.toHSL().compare(hsl[i], 1e-5f));
+        EXPECT_EQ(verts[i].color.toU32(), packed[i]);
+        hsl[i].x = 360.0f - hsl[i].x;
+    }
+
+    colorsFromHSL(hsl, colors);
+    for (size_t i = 0; i < verts.size(); ++i) {
+        EXPECT_TRUE(near(Color::fromHSL(hsl[i].x, hsl[i].y, hsl[i].z), verts[i].color, 1));
+    }
+}
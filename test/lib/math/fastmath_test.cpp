@@ -0,0 +1,189 @@
+//
+// math::fast Unit Tests
+//
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "lib.h"
+
+using math::fast::kLow;
+using math::fast::kHigh;
+
+enum Metric { kAbsolute, kRelative, kUlp };
+
+// count evenly spaced values over [lo, hi], padded to a multiple of 8.
+static std::vector<float> sweep (const float lo, const float hi, const size_t count) {
+    std::vector<float> v;
+    for (size_t i = 0; i < count; ++i) {
+        v.push_back(lo + (hi - lo) * static_cast<float>(i) / static_cast<float>(count - 1));
+    }
+    while (v.size() % 8 != 0) {
+        v.push_back(hi);
+    }
+    return v;
+}
+
+static double error (const float got, const double want, const Metric metric) {
+    const double diff = std::fabs(static_cast<double>(got) - want);
+    switch (metric) {
+    case kRelative:
+        return diff / std::fabs(want);
+    case kUlp: {
+        const float w = std::fabs(static_cast<float>(want));
+        return diff / static_cast<double>(std::nextafter(w, math::kInfty) - w);
+    }
+    default:
+        return diff;
+    }
+}
+
+// Largest error of f against ref over in, evaluating f on float, Floatx4
+// and Floatx8.
+template <typename F, typename R>
+static double maxError (const std::vector<float> &in, F f, R ref, const Metric metric) {
+    double worst = 0.0;
+    for (size_t i = 0; i < in.size(); i += 8) {
+        const Floatx4 r4 = f(Floatx4::load(&in[i]));
+        const Floatx8 r8 = f(Floatx8::load(&in[i]));
+
+        for (size_t k = 0; k < 8; ++k) {
+            const double want = ref(static_cast<double>(in[i + k]));
+            worst = std::max(worst, error(f(in[i + k]), want, metric));
+            worst = std::max(worst, error(r8[k], want, metric));
+            if (k < 4) {
+                worst = std::max(worst, error(r4[k], want, metric));
+            }
+        }
+    }
+    return worst;
+}
+
+TEST (FastMath_Test, Rsqrt) {
+    const auto ref = [](const double x) { return 1.0 / std::sqrt(x); };
+    const std::vector<float> in = sweep(1e-6f, 1e6f, 100000);
+    const std::vector<float> unit = sweep(0.5f, 2.0f, 10000);
+
+    EXPECT_LE(maxError(in, [](auto x) { return math::fast::rsqrt<kLow>(x); }, ref, kRelative), 5e-5);
+    EXPECT_LE(maxError(unit, [](auto x) { return math::fast::rsqrt<kLow>(x); }, ref, kRelative), 5e-5);
+    EXPECT_LE(maxError(in, [](auto x) { return math::fast::rsqrt<kHigh>(x); }, ref, kRelative), 3e-7);
+    EXPECT_LE(maxError(unit, [](auto x) { return math::fast::rsqrt<kHigh>(x); }, ref, kUlp), 3.0);
+}
+
+TEST (FastMath_Test, Sin_Cos) {
+    const auto sinRef = [](const double x) { return std::sin(x); };
+    const auto cosRef = [](const double x) { return std::cos(x); };
+    const std::vector<float> in = sweep(-8192.0f, 8192.0f, 200000);
+    const std::vector<float> turn = sweep(-math::kTau, math::kTau, 10000);
+
+    for (const std::vector<float> *v : {&in, &turn}) {
+        EXPECT_LE(maxError(*v, [](auto x) { return math::fast::sin<kLow>(x); }, sinRef, kAbsolute), 2e-5);
+        EXPECT_LE(maxError(*v, [](auto x) { return math::fast::cos<kLow>(x); }, cosRef, kAbsolute), 2e-5);
+        EXPECT_LE(maxError(*v, [](auto x) { return math::fast::sin<kHigh>(x); }, sinRef, kAbsolute), 2e-7);
+        EXPECT_LE(maxError(*v, [](auto x) { return math::fast::cos<kHigh>(x); }, cosRef, kAbsolute), 2e-7);
+    }
+
+    // Exact at 0, and sincos agrees with sin and cos.
+    EXPECT_EQ(0.0f, math::fast::sin(0.0f));
+    EXPECT_EQ(1.0f, math::fast::cos(0.0f));
+    for (const float x : turn) {
+        float s, c;
+        math::fast::sincos(x, s, c);
+        EXPECT_EQ(math::fast::sin(x), s);
+        EXPECT_EQ(math::fast::cos(x), c);
+    }
+
+    for (size_t i = 0; i + 8 <= turn.size(); i += 8) {
+        const Floatx8 x = Floatx8::load(&turn[i]);
+        Floatx8 s, c;
+        math::fast::sincos(x, s, c);
+        const Floatx8 sx = math::fast::sin(x);
+        const Floatx8 cx = math::fast::cos(x);
+        for (size_t k = 0; k < 8; ++k) {
+            EXPECT_EQ(sx[k], s[k]);
+            EXPECT_EQ(cx[k], c[k]);
+        }
+    }
+}
+
+TEST (FastMath_Test, Atan2) {
+    const std::vector<float> in = sweep(-3.0f, 3.0f, 800);
+
+    double low = 0.0;
+    double high = 0.0;
+    for (const float y : in) {
+        if (y == 0.0f) {
+            continue;
+        }
+
+        // Each Floatx8 holds one y against 8 values of x.
+        const auto lowF = [y](auto x) { return math::fast::atan2<kLow>(decltype(x)(y), x); };
+        const auto highF = [y](auto x) { return math::fast::atan2<kHigh>(decltype(x)(y), x); };
+        const auto ref = [y](const double x) { return std::atan2(static_cast<double>(y), x); };
+
+        low = std::max(low, maxError(in, lowF, ref, kAbsolute));
+        high = std::max(high, maxError(in, highF, ref, kAbsolute));
+    }
+    EXPECT_LE(low, 1e-4);
+    EXPECT_LE(high, 5e-7);
+
+    EXPECT_EQ(0.0f, math::fast::atan2(0.0f, 0.0f));
+    EXPECT_NEAR(math::kPi, math::fast::atan2(0.0f, -1.0f), 1e-6f);
+    EXPECT_NEAR(-math::kHalfPi, math::fast::atan2(-2.0f, 0.0f), 1e-6f);
+
+    // The same special cases, one per lane, each taking a different mix of
+    // the quadrant selects.
+    const Floatx4 a = math::fast::atan2(Floatx4(0.0f, 0.0f, -2.0f, -1.0f), Floatx4(0.0f, -1.0f, 0.0f, -1.0f));
+    EXPECT_EQ(0.0f, a[0]);
+    EXPECT_NEAR(math::kPi, a[1], 1e-6f);
+    EXPECT_NEAR(-math::kHalfPi, a[2], 1e-6f);
+    EXPECT_NEAR(-0.75f * math::kPi, a[3], 1e-6f);
+}
+
+TEST (FastMath_Test, Exp2) {
+    const auto ref = [](const double x) { return std::exp2(x); };
+    const std::vector<float> in = sweep(-126.0f, 127.0f, 200000);
+
+    EXPECT_LE(maxError(in, [](auto x) { return math::fast::exp2<kLow>(x); }, ref, kRelative), 2e-4);
+    EXPECT_LE(maxError(in, [](auto x) { return math::fast::exp2<kHigh>(x); }, ref, kRelative), 3e-7);
+    EXPECT_LE(maxError(in, [](auto x) { return math::fast::exp2<kHigh>(x); }, ref, kUlp), 3.0);
+
+    // Integers are exact.
+    for (int n = -126; n <= 127; ++n) {
+        EXPECT_EQ(std::ldexp(1.0f, n), math::fast::exp2(static_cast<float>(n)));
+    }
+}
+
+TEST (FastMath_Test, Log2) {
+    const auto ref = [](const double x) { return std::log2(x); };
+    const std::vector<float> near = sweep(1.0f / 16.0f, 16.0f, 200000);
+    const std::vector<float> wide = sweep(1e-30f, 1e30f, 200000);
+
+    for (const std::vector<float> *v : {&near, &wide}) {
+        EXPECT_LE(maxError(*v, [](auto x) { return math::fast::log2<kLow>(x); }, ref, kAbsolute), 1.5e-4);
+    }
+    EXPECT_LE(maxError(near, [](auto x) { return math::fast::log2<kHigh>(x); }, ref, kAbsolute), 3e-7);
+    EXPECT_LE(maxError(wide, [](auto x) { return math::fast::log2<kHigh>(x); }, ref, kUlp), 1.0);
+
+    // Powers of 2 are exact.
+    for (int n = -126; n <= 127; ++n) {
+        EXPECT_EQ(static_cast<float>(n), math::fast::log2(std::ldexp(1.0f, n)));
+    }
+}
+
+TEST (FastMath_Test, Pow) {
+    const std::vector<float> in = sweep(0.01f, 10.0f, 2000);
+
+    double low = 0.0;
+    double high = 0.0;
+    for (const float y : sweep(-4.0f, 4.0f, 200)) {
+        const auto lowF = [y](auto x) { return math::fast::pow<kLow>(x, decltype(x)(y)); };
+        const auto highF = [y](auto x) { return math::fast::pow<kHigh>(x, decltype(x)(y)); };
+        const auto ref = [y](const double x) { return std::pow(x, static_cast<double>(y)); };
+
+        low = std::max(low, maxError(in, lowF, ref, kRelative));
+        high = std::max(high, maxError(in, highF, ref, kRelative));
+    }
+    EXPECT_LE(low, 5e-4);
+    EXPECT_LE(high, 2e-6);
+}
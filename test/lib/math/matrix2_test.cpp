@@ -70,3 +70,20 @@ TEST (Mat2f_Test, multiplication) {
 
     EXPECT_EQ(Mat2f(4.0f, 6.0f, 5.0f, 7.5f), M);
 }
+
+TEST (Mat2f_Test, multiplication_matches_scalar) {
+    sge::Random r(7);
+
+    for (int k = 0; k < 100; ++k) {
+        Mat2f a(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f),
+                r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+        Mat2f b(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f),
+                r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+
+        EXPECT_TRUE(mulScalar(a, b).compare(a * b, 1e-4f));
+
+        Mat2f c = a;
+        c *= b;
+        EXPECT_TRUE(mulScalar(a, b).compare(c, 1e-4f));
+    }
+}
@@ -33,3 +33,65 @@ TEST (Mat3f_Test, Inverse) {
                     0.0f, 0.25f, -0.25f),
               M);
 }
+
+TEST (Mat3f_Test, Multiplication_Matches_Scalar) {
+    sge::Random r(7);
+
+    for (int k = 0; k < 100; ++k) {
+        Mat3f a, b;
+        for (int c = 0; c < 3; ++c) {
+            a[c] = Vec3f(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+            b[c] = Vec3f(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+        }
+
+        EXPECT_TRUE(mulScalar(a, b).compare(a * b, 1e-3f));
+
+        Mat3f c = a;
+        c *= b;
+        EXPECT_TRUE(mulScalar(a, b).compare(c, 1e-3f));
+    }
+}
+
+TEST (Mat3f_Test, Multiplication_Identity) {
+    Mat3f M = Mat3f(2.0f, 2.0f, 3.0f,
+                    4.0f, 2.0f, 5.0f,
+                    4.0f, 2.0f, 1.0f);
+
+    EXPECT_EQ(M, M * Mat3f_Identity);
+    EXPECT_EQ(M, Mat3f_Identity * M);
+    EXPECT_TRUE(Mat3f_Identity.compare(M * M.inverse(), 1e-5f));
+}
+
+TEST (Mat3f_Test, Inverse_Matches_Scalar) {
+    sge::Random r(13);
+
+    for (int k = 0; k < 100; ++k) {
+        Mat3f m;
+        for (int c = 0; c < 3; ++c) {
+            m[c] = Vec3f(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+        }
+        if (fabsf(m.determinant()) < 1.0f) {
+            continue;
+        }
+
+        EXPECT_TRUE(inverseScalar(m).compare(m.inverse(), 1e-3f));
+        EXPECT_TRUE(inverseScalar(m).transpose().compare(m.normalMatrix(), 1e-3f));
+    }
+}
+
+TEST (Mat3f_Test, Inverse_Singular) {
+    Mat3f M = Mat3f_One;
+
+    EXPECT_FALSE(M.inverseSelf());
+    EXPECT_EQ(Mat3f_One, M);
+}
+
+TEST (Mat3f_Test, Inverse_Orthogonal) {
+    // Rotation by 90 degrees about z, then scale of (2, 4, 0.5).
+    Mat3f M = Mat3f(0.0f, 2.0f, 0.0f,
+                    -4.0f, 0.0f, 0.0f,
+                    0.0f, 0.0f, 0.5f);
+
+    EXPECT_TRUE(inverseScalar(M).compare(M.inverseOrthogonal(), 1e-6f));
+    EXPECT_TRUE(Mat3f_Identity.compare(M * M.inverseOrthogonal(), 1e-6f));
+}
@@ -24,3 +24,132 @@ TEST (Mat4f_Test, Inverse) {
                       -3.0f, 2.0f, -1.0f, 1.0f),
               M);
 }
+
+static Mat4f randomMat4f (sge::Random &r) {
+    Mat4f m;
+    for (int c = 0; c < 4; ++c) {
+        m[c] = Vec4f(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f),
+                     r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+    }
+    return m;
+}
+
+TEST (Mat4f_Test, Multiplication_Matches_Scalar) {
+    sge::Random r(7);
+
+    for (int k = 0; k < 100; ++k) {
+        Mat4f a = randomMat4f(r);
+        Mat4f b = randomMat4f(r);
+
+        EXPECT_TRUE(mulScalar(a, b).compare(a * b, 1e-3f));
+
+        Mat4f c = a;
+        c *= b;
+        EXPECT_TRUE(mulScalar(a, b).compare(c, 1e-3f));
+    }
+}
+
+TEST (Mat4f_Test, Vec4f_Multiplication_Matches_Scalar) {
+    sge::Random r(11);
+
+    for (int k = 0; k < 100; ++k) {
+        Mat4f m = randomMat4f(r);
+        Vec4f v = Vec4f(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f),
+                        r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+
+        EXPECT_TRUE(mulScalar(m, v).compare(m * v, 1e-3f));
+        EXPECT_TRUE(mulScalar(m, v).compare(v * m, 1e-3f));
+    }
+}
+
+TEST (Mat4f_Test, Multiplication_Identity) {
+    Mat4f M = Mat4f(2.0f, 2.0f, 4.0f, 0.0f,
+                    4.0f, 2.0f, 6.0f, 0.0f,
+                    4.0f, 2.0f, 2.0f, 0.0f,
+                    2.0f, 4.0f, 2.0f, 1.0f);
+
+    EXPECT_EQ(M, M * Mat4f_Identity);
+    EXPECT_EQ(M, Mat4f_Identity * M);
+    EXPECT_EQ(Vec4f(8.0f, 8.0f, 12.0f, 1.0f), M * Vec4f(1.0f, 1.0f, 0.0f, 1.0f));
+}
+
+TEST (Mat4f_Test, Inverse_Matches_Scalar) {
+    sge::Random r(13);
+
+    for (int k = 0; k < 100; ++k) {
+        Mat4f m = randomMat4f(r);
+        if (fabsf(m.determinant()) < 1.0f) {
+            continue;
+        }
+
+        EXPECT_TRUE(inverseScalar(m).compare(m.inverse(), 1e-3f));
+        EXPECT_TRUE(Mat4f_Identity.compare(m * m.inverse(), 1e-3f));
+    }
+}
+
+TEST (Mat4f_Test, Inverse_Singular) {
+    Mat4f M = Mat4f_One;
+
+    EXPECT_FALSE(M.inverseSelf());
+    EXPECT_EQ(Mat4f_One, M);
+}
+
+static Mat4f randomTransform (sge::Random &r, const bool scaled) {
+    Transform t;
+    t.setPosition(Vec3f(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f)));
+    t.setOrientation(Quat4f(r.nextFloat(-3.0f, 3.0f),
+                            Vec3f(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), 1.0f).normalize()));
+    if (scaled) {
+        t.setScale(Vec3f(r.nextFloat(0.1f, 4.0f), r.nextFloat(0.1f, 4.0f), r.nextFloat(0.1f, 4.0f)));
+    }
+    return t.transformationMatrix();
+}
+
+TEST (Mat4f_Test, Affine_Inverse) {
+    sge::Random r(17);
+
+    for (int k = 0; k < 100; ++k) {
+        Mat4f scaled = randomTransform(r, true);
+        Mat4f rigid = randomTransform(r, false);
+
+        EXPECT_TRUE(inverseScalar(scaled).compare(scaled.inverseAffine(), 1e-4f));
+        EXPECT_TRUE(inverseScalar(scaled).compare(scaled.inverseOrthogonal(), 1e-4f));
+        EXPECT_TRUE(inverseScalar(rigid).compare(rigid.inverseRigid(), 1e-4f));
+    }
+
+    // Shear is affine but not orthogonal.
+    Mat4f M = Mat4f(2.0f, 0.0f, 0.0f, 0.0f,
+                    1.0f, 1.0f, 0.0f, 0.0f,
+                    0.0f, 3.0f, 4.0f, 0.0f,
+                    5.0f, 6.0f, 7.0f, 1.0f);
+
+    EXPECT_TRUE(M.inverse().compare(M.inverseAffine(), 1e-6f));
+}
+
+TEST (Mat4f_Test, Normal_Matrix) {
+    sge::Random r(19);
+
+    for (int k = 0; k < 100; ++k) {
+        Mat4f m = randomTransform(r, true);
+        Mat3f upper = Mat3f(m[0].xyz(), m[1].xyz(), m[2].xyz());
+
+        EXPECT_TRUE(inverseScalar(upper).transpose().compare(m.normalMatrix(), 1e-4f));
+    }
+}
+
+TEST (Mat4f_Test, ConstantExpression) {
+    static constexpr Mat4f kTranslate = Mat4f(1.0f, 0.0f, 0.0f, 0.0f,
+                                              0.0f, 1.0f, 0.0f, 0.0f,
+                                              0.0f, 0.0f, 1.0f, 0.0f,
+                                              2.0f, 3.0f, 4.0f, 1.0f);
+    static constexpr Mat4f kScale = Mat4f(Vec4f(2.0f, 0.0f, 0.0f, 0.0f), Vec4f(0.0f, 2.0f, 0.0f, 0.0f),
+                                          Vec4f(0.0f, 0.0f, 2.0f, 0.0f), Vec4f(0.0f, 0.0f, 0.0f, 1.0f));
+    static constexpr Mat4f kTransform = mulScalar(kTranslate, kScale);
+
+    static_assert(mulScalar(kTransform, Vec4f(1.0f, 1.0f, 1.0f, 1.0f)) == Vec4f(4.0f, 5.0f, 6.0f, 1.0f),
+                  "products are constant expressions");
+    static_assert(kTransform.determinant() == 8.0f, "determinant is a constant expression");
+    static_assert(kTranslate.transpose().transpose() == kTranslate, "");
+
+    EXPECT_EQ(kTransform, kTranslate * kScale);
+}
@@ -0,0 +1,96 @@
+//
+// Packed Format Unit Tests
+//
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include "lib.h"
+
+TEST (Packed_Test, Half_Exact) {
+    // Every finite half converts to float and back unchanged.
+    for (u32 h = 0; h < 0x10000u; ++h) {
+        if ((h & 0x7C00u) == 0x7C00u) {
+            continue;
+        }
+        EXPECT_EQ(h, math::floatToHalf(math::halfToFloat(static_cast<u16>(h))));
+    }
+
+    EXPECT_EQ(0x3C00u, math::floatToHalf(1.0f));
+    EXPECT_EQ(0xC000u, math::floatToHalf(-2.0f));
+    EXPECT_EQ(0x7BFFu, math::floatToHalf(65504.0f));
+    EXPECT_EQ(0x0001u, math::floatToHalf(5.9604644775390625e-8f));
+    EXPECT_EQ(0.5f, math::halfToFloat(0x3800u));
+}
+
+TEST (Packed_Test, Half_Rounding) {
+    // Nearest, ties to even, overflow to infinity.
+    EXPECT_EQ(0x3C00u, math::floatToHalf(1.0f + 1.0f / 4096.0f));
+    EXPECT_EQ(0x3C02u, math::floatToHalf(1.0f + 3.0f / 2048.0f));
+    EXPECT_EQ(0x3C01u, math::floatToHalf(1.0f + 1.0f / 1500.0f));
+    EXPECT_EQ(0x7C00u, math::floatToHalf(65520.0f));
+    EXPECT_EQ(0xFC00u, math::floatToHalf(-1e10f));
+    EXPECT_EQ(0x0000u, math::floatToHalf(1e-10f));
+    EXPECT_TRUE(std::isnan(math::halfToFloat(math::floatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+
+    sge::Random r(1);
+    for (int k = 0; k < 10000; ++k) {
+        const float f = r.nextFloat(-1000.0f, 1000.0f);
+        EXPECT_NEAR(f, math::halfToFloat(math::floatToHalf(f)), fabsf(f) / 2048.0f);
+    }
+
+    const Vec4f v(0.25f, -3.5f, 100.0f, 0.0f);
+    EXPECT_EQ(v, Vec4h(v).toVec4f());
+    EXPECT_EQ(Vec2f(0.5f, 0.75f), Vec2h(Vec2f(0.5f, 0.75f)).toVec2f());
+}
+
+TEST (Packed_Test, Normalized) {
+    EXPECT_EQ(32767, math::packSnorm16(1.0f));
+    EXPECT_EQ(-32767, math::packSnorm16(-2.0f));
+    EXPECT_EQ(0, math::packSnorm16(0.0f));
+    EXPECT_EQ(-1.0f, math::unpackSnorm16(-32768));
+    EXPECT_EQ(65535, math::packUnorm16(1.5f));
+    EXPECT_EQ(0, math::packUnorm16(-0.5f));
+    EXPECT_EQ(127, math::packSnorm8(1.0f));
+    EXPECT_EQ(-64, math::packSnorm8(-0.5f));
+
+    for (int i = -32767; i <= 32767; i += 7) {
+        const s16 s = static_cast<s16>(i);
+        EXPECT_EQ(s, math::packSnorm16(math::unpackSnorm16(s)));
+    }
+    for (int i = 0; i <= 65535; i += 5) {
+        const u16 u = static_cast<u16>(i);
+        EXPECT_EQ(u, math::packUnorm16(math::unpackUnorm16(u)));
+    }
+}
+
+TEST (Packed_Test, Octahedral) {
+    const Vec3f axes[] = {Vec3f(1, 0, 0), Vec3f(-1, 0, 0), Vec3f(0, 1, 0),
+                          Vec3f(0, -1, 0), Vec3f(0, 0, 1), Vec3f(0, 0, -1)};
+    for (const Vec3f &a : axes) {
+        EXPECT_TRUE(a.compare(math::octDecode(math::octEncode(a)), 1e-6f));
+    }
+    EXPECT_EQ(Vec3f(0, 0, 1), math::octDecode(math::octEncode(Vec3f_Zero)));
+
+    // Within 0.005 degrees through snorm16, 1.5 degrees through snorm8.
+    sge::Random r(2);
+    const auto degrees = [](const Vec3f &a, const Vec3f &b) {
+        return atan2f(a.cross(b).mag(), a.dot(b)) * 180.0f / math::kPi;
+    };
+    float worst16 = 0.0f;
+    float worst8 = 0.0f;
+    for (int k = 0; k < 20000; ++k) {
+        const Vec3f n = Vec3f(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f),
+                              r.nextFloat(-1.0f, 1.0f)).normalize();
+        const Vec2f e = math::octEncode(n);
+        EXPECT_TRUE(fabsf(e.x) <= 1.0f && fabsf(e.y) <= 1.0f);
+
+        const Vec2f e16(math::unpackSnorm16(math::packSnorm16(e.x)),
+                        math::unpackSnorm16(math::packSnorm16(e.y)));
+        const Vec2f e8(math::unpackSnorm8(math::packSnorm8(e.x)),
+                       math::unpackSnorm8(math::packSnorm8(e.y)));
+        worst16 = math::max(worst16, degrees(n, math::octDecode(e16)));
+        worst8 = math::max(worst8, degrees(n, math::octDecode(e8)));
+    }
+    EXPECT_LT(worst16, 0.005f);
+    EXPECT_LT(worst8, 1.5f);
+}
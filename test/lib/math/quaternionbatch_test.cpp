@@ -0,0 +1,122 @@
+//
+// Batch Quaternion Tests
+//
+#include <gtest/gtest.h>
+#include <vector>
+#include "lib.h"
+
+static Quat4f randomRotation (sge::Random &r) {
+    const Vec3f axis = Vec3f(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f),
+                             r.nextFloat(-1.0f, 1.0f)).normalize();
+
+    return Quat4f(r.nextFloat(-math::kPi, math::kPi), axis).normalize();
+}
+
+static Quat4fArray randomRotations (sge::Random &r, const size_t count) {
+    Quat4fArray q;
+    for (size_t n = 0; n < count; ++n) {
+        q.add(randomRotation(r));
+    }
+    return q;
+}
+
+static std::vector<float> randomWeights (sge::Random &r, const size_t count) {
+    std::vector<float> t;
+    for (size_t n = 0; n < count; ++n) {
+        t.push_back(r.nextFloat());
+    }
+    return t;
+}
+
+TEST (QuaternionBatch_Test, Scalar_Slerp) {
+    const Quat4f a = Quat4f_Identity;
+    const Quat4f b = Quat4f(math::kPi * 0.5f, Vec3f(0.0f, 0.0f, 1.0f));
+
+    EXPECT_TRUE(slerp(a, b, 0.0f).compare(a, 1e-6f));
+    EXPECT_TRUE(slerp(a, b, 1.0f).compare(b, 1e-6f));
+    EXPECT_TRUE(slerp(a, b, 0.25f).compare(Quat4f(math::kPi * 0.125f, Vec3f(0.0f, 0.0f, 1.0f)), 1e-6f));
+
+    // -b is the same rotation; the shorter arc is taken either way.
+    EXPECT_TRUE(slerp(a, b * -1.0f, 0.25f).compare(slerp(a, b, 0.25f), 1e-6f));
+    EXPECT_TRUE(nlerp(a, b * -1.0f, 0.5f).compare(slerp(a, b, 0.5f), 1e-6f));
+}
+
+TEST (QuaternionBatch_Test, Normalize) {
+    sge::Random r(1);
+    Quat4fArray q;
+    for (size_t n = 0; n < 11; ++n) {
+        q.add(randomRotation(r) * r.nextFloat(0.5f, 4.0f));
+    }
+    q.add(Quat4f(0.0f, 0.0f, 0.0f, 0.0f));
+    const Quat4fArray in = q;
+
+    normalize(q);
+
+    for (size_t n = 0; n < q.size(); ++n) {
+        EXPECT_TRUE(in.get(n).normalize().compare(q.get(n), 1e-6f));
+    }
+    EXPECT_EQ(Quat4f(0.0f, 0.0f, 0.0f, 0.0f), q.get(11));
+}
+
+TEST (QuaternionBatch_Test, Batch_Matches_Scalar) {
+    sge::Random r(2);
+
+    // Cover every tail length either side of the SIMD block size.
+    for (size_t count = 0; count < 20; ++count) {
+        const Quat4fArray a = randomRotations(r, count);
+        const Quat4fArray b = randomRotations(r, count);
+        const std::vector<float> t = randomWeights(r, count);
+        Quat4fArray n, s, n1, s1;
+
+        nlerp(a, b, t, n);
+        slerp(a, b, t, s);
+        nlerp(a, b, 0.3f, n1);
+        slerp(a, b, 0.3f, s1);
+
+        ASSERT_EQ(count, n.size());
+        ASSERT_EQ(count, s.size());
+        for (size_t k = 0; k < count; ++k) {
+            EXPECT_TRUE(nlerp(a.get(k), b.get(k), t[k]).compare(n.get(k), 1e-5f));
+            EXPECT_TRUE(slerp(a.get(k), b.get(k), t[k]).compare(s.get(k), 1e-5f));
+            EXPECT_TRUE(nlerp(a.get(k), b.get(k), 0.3f).compare(n1.get(k), 1e-5f));
+            EXPECT_TRUE(slerp(a.get(k), b.get(k), 0.3f).compare(s1.get(k), 1e-5f));
+        }
+    }
+}
+
+TEST (QuaternionBatch_Test, In_Place) {
+    sge::Random r(3);
+    Quat4fArray a = randomRotations(r, 13);
+    const Quat4fArray b = randomRotations(r, 13);
+    const Quat4fArray in = a;
+
+    slerp(a, b, 0.7f, a);
+
+    for (size_t k = 0; k < a.size(); ++k) {
+        EXPECT_TRUE(slerp(in.get(k), b.get(k), 0.7f).compare(a.get(k), 1e-5f));
+    }
+}
+
+TEST (QuaternionBatch_Test, SlerpFast_Error_Bound) {
+    sge::Random r(4);
+    const size_t count = 4096;
+    const Quat4fArray a = randomRotations(r, count);
+    const Quat4fArray b = randomRotations(r, count);
+    Quat4fArray fast, exact;
+
+    for (float t = 0.0f; t <= 1.0f; t += 0.0625f) {
+        slerpFast(a, b, t, fast);
+        slerp(a, b, t, exact);
+
+        for (size_t k = 0; k < count; ++k) {
+            EXPECT_TRUE(exact.get(k).compare(fast.get(k), kQuatSlerpFastMaxError));
+        }
+    }
+
+    const std::vector<float> t = randomWeights(r, count);
+    slerpFast(a, b, t, fast);
+    slerp(a, b, t, exact);
+    for (size_t k = 0; k < count; ++k) {
+        EXPECT_TRUE(exact.get(k).compare(fast.get(k), kQuatSlerpFastMaxError));
+    }
+}
@@ -25,7 +25,7 @@ static Vec3f apply_transform_direction (const Transform &tr, const Vec3f &v_in)
 
 TEST (Transform_Test, Translation_Matrix) {
     Transform t = Transform();
-    t.position = Vec3f(1.0f, 2.0f, 3.0f);
+    t.setPosition(Vec3f(1.0f, 2.0f, 3.0f));
 
     Mat4f m = t.translationMatrix();
 
@@ -35,7 +35,7 @@ TEST (Transform_Test, Translation_Matrix) {
 
 TEST (Transform_Test, Scale_Matrix) {
     Transform t = Transform();
-    t.scale = Vec3f(0.5f, 2.0f, 3.0f);
+    t.setScale(Vec3f(0.5f, 2.0f, 3.0f));
 
     Mat4f m = t.scaleMatrix();
 
@@ -53,7 +53,7 @@ TEST (Transform_Test, No_Transform) {
 TEST (Transform_Test, Clear_Transform) {
     Vec3f v = Vec3f_Zero;
     Transform t = Transform();
-    t.position += Vec3f(2.0f, 2.0f, 2.0f);
+    t.translate(Vec3f(2.0f, 2.0f, 2.0f));
 
     EXPECT_EQ(Vec3f(2.0f, 2.0f, 2.0f), apply_transform_position(t, v));
     EXPECT_EQ(Vec3f_Zero, apply_transform_direction(t, v));
@@ -63,3 +63,61 @@ TEST (Transform_Test, Clear_Transform) {
     EXPECT_EQ(Vec3f_Zero, apply_transform_position(t, v));
     EXPECT_EQ(Vec3f_Zero, apply_transform_direction(t, v));
 }
+
+TEST (Transform_Test, Matrix_Matches_Components) {
+    Transform t = Transform(Vec3f(1.0f, -2.0f, 3.0f),
+                            Quat4f(0.7f, Vec3f(0.0f, 0.6f, 0.8f)),
+                            Vec3f(0.5f, 2.0f, 3.0f));
+    Mat4f trs = t.translationMatrix() * t.orientationMatrix() * t.scaleMatrix();
+
+    EXPECT_TRUE(trs.compare(t.transformationMatrix(), 1e-5f));
+    EXPECT_TRUE(Mat4f_Identity.compare(t.viewTransformationMatrix() * trs, 1e-5f));
+}
+
+TEST (Transform_Test, Cached_Matrix) {
+    Transform t = Transform();
+    t.setPosition(Vec3f(1.0f, 2.0f, 3.0f));
+
+    Mat4f m = t.transformationMatrix();
+    EXPECT_EQ(m, t.transformationMatrix());
+    EXPECT_EQ(1u, t.matrixRebuilds());
+    EXPECT_EQ(1u, t.matrixReuses());
+
+    // Every mutator invalidates the cache.
+    t.rotateL(0.5f, Vec3f_Y);
+    EXPECT_NE(m, t.transformationMatrix());
+    m = t.transformationMatrix();
+    t.rotateW(0.5f, Vec3f_X);
+    EXPECT_NE(m, t.transformationMatrix());
+    m = t.transformationMatrix();
+    t.translate(Vec3f_X);
+    EXPECT_NE(m, t.transformationMatrix());
+    m = t.transformationMatrix();
+    t.setScale(Vec3f(2.0f, 2.0f, 2.0f));
+    EXPECT_NE(m, t.transformationMatrix());
+    m = t.transformationMatrix();
+    t.setOrientation(Quat4f_Identity);
+    EXPECT_NE(m, t.transformationMatrix());
+    EXPECT_EQ(6u, t.matrixRebuilds());
+    EXPECT_EQ(5u, t.matrixReuses());
+
+    t.resetMatrixStats();
+    Mat4f v = t.viewTransformationMatrix();
+    EXPECT_EQ(v, t.viewTransformationMatrix());
+    EXPECT_EQ(1u, t.matrixRebuilds());
+    EXPECT_EQ(1u, t.matrixReuses());
+
+    // Rebuilding the view matrix also rebuilds the model matrix, but is
+    // counted once.
+    t.translate(Vec3f_Y);
+    t.resetMatrixStats();
+    EXPECT_NE(v, t.viewTransformationMatrix());
+    EXPECT_EQ(1u, t.matrixRebuilds());
+    EXPECT_EQ(0u, t.matrixReuses());
+    t.transformationMatrix();
+    EXPECT_EQ(1u, t.matrixRebuilds());
+    EXPECT_EQ(1u, t.matrixReuses());
+
+    t.reset();
+    EXPECT_EQ(Mat4f_Identity, t.viewTransformationMatrix());
+}
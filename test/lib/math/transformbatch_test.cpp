@@ -0,0 +1,118 @@
+//
+// Batch Transform Tests
+//
+#include <gtest/gtest.h>
+#include <vector>
+#include "lib.h"
+
+using sge::Mesh;
+using sge::Vertex;
+
+static Mat4f randomAffine (sge::Random &r) {
+    Mat4f m = Mat4f_Identity;
+    for (int c = 0; c < 4; ++c) {
+        for (int k = 0; k < 3; ++k) {
+            m[c][k] = r.nextFloat(-4.0f, 4.0f);
+        }
+    }
+    return m;
+}
+
+static std::vector<Vec3f> randomVec3s (sge::Random &r, const size_t count) {
+    std::vector<Vec3f> v;
+    for (size_t k = 0; k < count; ++k) {
+        v.emplace_back(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f),
+                       r.nextFloat(-10.0f, 10.0f));
+    }
+    return v;
+}
+
+TEST (TransformBatch_Test, Points_Match_Mat4f) {
+    sge::Random r(3);
+    const Mat4f m = randomAffine(r);
+
+    // Cover every tail length either side of the SIMD block sizes.
+    for (size_t count = 0; count < 20; ++count) {
+        const std::vector<Vec3f> in = randomVec3s(r, count);
+        std::vector<Vec3f> out(count);
+
+        transformPoints(m, in, out);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_TRUE((m * Vec4f(in[i], 1.0f)).xyz().compare(out[i], 1e-3f));
+        }
+    }
+}
+
+TEST (TransformBatch_Test, Directions_Ignore_Translation) {
+    sge::Random r(5);
+    const Mat4f m = randomAffine(r);
+    const std::vector<Vec3f> in = randomVec3s(r, 19);
+    std::vector<Vec3f> out(in.size());
+
+    transformDirections(m, in, out);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_TRUE((m * Vec4f(in[i], 0.0f)).xyz().compare(out[i], 1e-3f));
+    }
+}
+
+TEST (TransformBatch_Test, Vec4f_Match_Mat4f) {
+    sge::Random r(7);
+    Mat4f m;
+    for (int c = 0; c < 4; ++c) {
+        m[c] = Vec4f(r.nextFloat(-4.0f, 4.0f), r.nextFloat(-4.0f, 4.0f),
+                     r.nextFloat(-4.0f, 4.0f), r.nextFloat(-4.0f, 4.0f));
+    }
+
+    std::vector<Vec4f> in;
+    for (int k = 0; k < 11; ++k) {
+        in.emplace_back(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f),
+                        r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f));
+    }
+    std::vector<Vec4f> out(in.size());
+
+    transformPoints(m, in, out);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        EXPECT_TRUE(mulScalar(m, in[i]).compare(out[i], 1e-3f));
+    }
+}
+
+TEST (TransformBatch_Test, Mesh_In_Place) {
+    Mesh mesh;
+    for (int k = 0; k < 13; ++k) {
+        const float f = static_cast<float>(k);
+        mesh.addVertex(Vertex(f, 2.0f * f, 3.0f * f, 0, 1, 0, f, f, 1, 2, 3, 4));
+    }
+
+    const Mat4f m = Mat4f(0.0f, 1.0f, 0.0f, 0.0f,
+                          -1.0f, 0.0f, 0.0f, 0.0f,
+                          0.0f, 0.0f, 1.0f, 0.0f,
+                          5.0f, 6.0f, 7.0f, 1.0f);
+
+    transformPoints(m, mesh.positions());
+    transformDirections(m, mesh.normals());
+
+    for (int k = 0; k < 13; ++k) {
+        const float f = static_cast<float>(k);
+        EXPECT_EQ(Vertex(5.0f - 2.0f * f, 6.0f + f, 7.0f + 3.0f * f,
+                         -1, 0, 0, f, f, 1, 2, 3, 4),
+                  mesh.vertices[k]);
+    }
+}
+
+TEST (TransformBatch_Test, Threaded_Matches_Scalar) {
+    sge::Random r(9);
+    const Mat4f m = randomAffine(r);
+    const std::vector<Vec3f> in = randomVec3s(r, 3 * kTransformBatchGrain + 5);
+    std::vector<Vec3f> expected(in.size());
+    std::vector<Vec3f> out(in.size());
+
+    transformPointsScalar(m, in, expected);
+    transformPoints(m, in, out, true);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        ASSERT_TRUE(expected[i].compare(out[i], 1e-3f));
+    }
+}
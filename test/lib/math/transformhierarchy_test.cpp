@@ -0,0 +1,105 @@
+//
+// Transform Hierarchy Tests
+//
+#include <gtest/gtest.h>
+#include "lib.h"
+
+static Transform offset (const float x, const float y, const float z) {
+    return Transform(Vec3f(x, y, z));
+}
+
+static Vec3f worldPosition (const TransformHierarchy &h, const u32 node) {
+    return (h.world(node) * Vec4f(0.0f, 0.0f, 0.0f, 1.0f)).xyz();
+}
+
+TEST (TransformHierarchy_Test, Propagates_To_Children) {
+    TransformHierarchy h;
+    const u32 root = h.add(offset(1.0f, 0.0f, 0.0f));
+    const u32 child = h.add(offset(0.0f, 2.0f, 0.0f), root);
+    const u32 grandchild = h.add(offset(0.0f, 0.0f, 3.0f), child);
+
+    h.update();
+
+    EXPECT_EQ(3u, h.lastUpdated());
+    EXPECT_EQ(TransformHierarchy::kNoParent, h.parent(root));
+    EXPECT_EQ(child, h.parent(grandchild));
+    EXPECT_EQ(Vec3f(1.0f, 0.0f, 0.0f), worldPosition(h, root));
+    EXPECT_EQ(Vec3f(1.0f, 2.0f, 0.0f), worldPosition(h, child));
+    EXPECT_EQ(Vec3f(1.0f, 2.0f, 3.0f), worldPosition(h, grandchild));
+}
+
+TEST (TransformHierarchy_Test, Only_Dirty_Subtrees_Update) {
+    TransformHierarchy h;
+    const u32 a = h.add(offset(1.0f, 0.0f, 0.0f));
+    const u32 b = h.add(offset(-1.0f, 0.0f, 0.0f));
+    const u32 a1 = h.add(offset(0.0f, 1.0f, 0.0f), a);
+    const u32 b1 = h.add(offset(0.0f, 1.0f, 0.0f), b);
+    h.add(offset(0.0f, 1.0f, 0.0f), a1);
+
+    h.update();
+    EXPECT_EQ(5u, h.lastUpdated());
+
+    h.update();
+    EXPECT_EQ(0u, h.lastUpdated());
+
+    // Moving a1 moves its child too, but nothing under b.
+    h.modify(a1).translate(Vec3f(0.0f, 0.0f, 5.0f));
+    h.update();
+    EXPECT_EQ(2u, h.lastUpdated());
+    EXPECT_EQ(Vec3f(1.0f, 1.0f, 5.0f), worldPosition(h, a1));
+
+    h.setLocal(b, offset(-2.0f, 0.0f, 0.0f));
+    h.update();
+    EXPECT_EQ(2u, h.lastUpdated());
+    EXPECT_EQ(Vec3f(-2.0f, 1.0f, 0.0f), worldPosition(h, b1));
+}
+
+TEST (TransformHierarchy_Test, Ids_Survive_Reordering) {
+    TransformHierarchy h;
+    const u32 a = h.add(offset(1.0f, 0.0f, 0.0f));
+    const u32 b = h.add(offset(2.0f, 0.0f, 0.0f));
+    // Children of the first root, added after the second root.
+    const u32 a1 = h.add(offset(0.0f, 1.0f, 0.0f), a);
+    const u32 a2 = h.add(offset(0.0f, 0.0f, 1.0f), a1);
+
+    h.update();
+
+    EXPECT_EQ(a, h.parent(a1));
+    EXPECT_EQ(a1, h.parent(a2));
+    EXPECT_EQ(TransformHierarchy::kNoParent, h.parent(b));
+    EXPECT_EQ(Vec3f(2.0f, 0.0f, 0.0f), worldPosition(h, b));
+    EXPECT_EQ(Vec3f(1.0f, 1.0f, 1.0f), worldPosition(h, a2));
+}
+
+TEST (TransformHierarchy_Test, Threaded_Matches_Serial) {
+    sge::Random r(3);
+    TransformHierarchy serial, threaded;
+    std::vector<u32> nodes;
+
+    // Many small trees with interleaved insertion.
+    for (u32 k = 0; k < 3 * kTransformHierarchyGrain; ++k) {
+        const u32 parent = (nodes.empty() || r.nextFloat() < 0.3f)
+                               ? TransformHierarchy::kNoParent
+                               : nodes[static_cast<u32>(r.nextFloat() * nodes.size()) % nodes.size()];
+        const Transform t = Transform(Vec3f(r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f), r.nextFloat(-1.0f, 1.0f)),
+                                      Quat4f(r.nextFloat(-1.0f, 1.0f), Vec3f_Y));
+        nodes.push_back(serial.add(t, parent));
+        threaded.add(t, parent);
+    }
+
+    serial.update();
+    threaded.update(true);
+    EXPECT_EQ(nodes.size(), threaded.lastUpdated());
+
+    for (u32 k = 0; k < nodes.size(); k += 7) {
+        serial.modify(nodes[k]).rotateL(0.1f, Vec3f_X);
+        threaded.modify(nodes[k]).rotateL(0.1f, Vec3f_X);
+    }
+    serial.update();
+    threaded.update(true);
+    EXPECT_EQ(serial.lastUpdated(), threaded.lastUpdated());
+
+    for (u32 node : nodes) {
+        EXPECT_EQ(serial.world(node), threaded.world(node));
+    }
+}
@@ -214,3 +214,16 @@ TEST (Vec3f_Test, Swizzle_Vec2f) {
     EXPECT_EQ(Vec2f(1.0f, 3.0f), Vec3f(1.0f, 2.0f, 3.0f).xz());
     EXPECT_EQ(Vec2f(2.0f, 3.0f), Vec3f(1.0f, 2.0f, 3.0f).yz());
 }
+
+TEST (Vec3f_Test, ConstantExpression) {
+    static constexpr Vec3f kA = Vec3f(1.0f, 2.0f, 3.0f);
+    static constexpr Vec3f kB = Vec3f(4.0f, 5.0f, 6.0f);
+
+    static_assert(kA.dot(kB) == 32.0f, "dot is a constant expression");
+    static_assert(kA.cross(kB) == Vec3f(-3.0f, 6.0f, -3.0f), "cross is a constant expression");
+    static_assert((kA + kB) * 2.0f - kB == Vec3f(6.0f, 9.0f, 12.0f), "operators are constant expressions");
+    static_assert(kB.clamp(Vec3f(0.0f), Vec3f(5.0f)) == Vec3f(4.0f, 5.0f, 5.0f), "");
+    static_assert(kA.xz() == Vec2f(1.0f, 3.0f), "");
+
+    EXPECT_EQ(Vec3f(5.0f, 7.0f, 9.0f), kA + kB);
+}
@@ -0,0 +1,151 @@
+//
+// Vec3x4 / Vec3x8 Tests
+//
+#include <gtest/gtest.h>
+#include <vector>
+#include "lib.h"
+
+static std::vector<Vec3f> randomVec3s (sge::Random &r, const size_t count) {
+    std::vector<Vec3f> v;
+    for (size_t k = 0; k < count; ++k) {
+        v.emplace_back(r.nextFloat(-10.0f, 10.0f), r.nextFloat(-10.0f, 10.0f),
+                       r.nextFloat(-10.0f, 10.0f));
+    }
+    return v;
+}
+
+// Each operation checked lane by lane against the Vec3f equivalent.
+template <typename V>
+static void checkMatchesVec3f () {
+    sge::Random r(21);
+    const int width = V::kWidth;
+    const std::vector<Vec3f> a = randomVec3s(r, width);
+    const std::vector<Vec3f> b = randomVec3s(r, width);
+
+    const V wa = V::gather(a, 0);
+    const V wb = V::gather(b, 0);
+
+    const auto dot = wa.dot(wb);
+    const auto magSq = wa.magSq();
+    const auto mag = wa.mag();
+    const V cross = wa.cross(wb);
+    const V norm = wa.normalize();
+    const V sum = wa + wb;
+    const V scaled = wa * 2.0f;
+    const V lerp = wa.lerp(wb, 0.25f);
+
+    for (int i = 0; i < width; ++i) {
+        EXPECT_NEAR(a[i].dot(b[i]), dot[i], 1e-3f);
+        EXPECT_NEAR(a[i].magSq(), magSq[i], 1e-3f);
+        EXPECT_NEAR(a[i].mag(), mag[i], 1e-4f);
+        EXPECT_TRUE(a[i].cross(b[i]).compare(cross.lane(i), 1e-3f));
+        EXPECT_TRUE(a[i].normalize().compare(norm.lane(i), 1e-5f));
+        EXPECT_EQ(a[i] + b[i], sum.lane(i));
+        EXPECT_EQ(a[i] * 2.0f, scaled.lane(i));
+        EXPECT_TRUE((a[i] + 0.25f * (b[i] - a[i])).compare(lerp.lane(i), 1e-4f));
+    }
+}
+
+TEST (Vec3Wide_Test, Vec3x4_Matches_Vec3f) {
+    checkMatchesVec3f<Vec3x4>();
+}
+
+TEST (Vec3Wide_Test, Vec3x8_Matches_Vec3f) {
+    checkMatchesVec3f<Vec3x8>();
+}
+
+TEST (Vec3Wide_Test, Normalize_Zero) {
+    Vec3x4 v = Vec3x4(Floatx4(0.0f, 3.0f, 0.0f, 0.0f),
+                      Floatx4(0.0f, 4.0f, 0.0f, 0.0f),
+                      Floatx4(0.0f, 0.0f, 0.0f, 2.0f));
+    v.normalizeSelf();
+
+    EXPECT_EQ(Vec3f_Zero, v.lane(0));
+    EXPECT_TRUE(Vec3f(0.6f, 0.8f, 0.0f).compare(v.lane(1), 1e-6f));
+    EXPECT_EQ(Vec3f_Zero, v.lane(2));
+    EXPECT_TRUE(Vec3f_Z.compare(v.lane(3), 1e-6f));
+}
+
+TEST (Vec3Wide_Test, Lerp_Clamps_Ratio) {
+    const Vec3x8 a = Vec3x8(Vec3f(1.0f, 2.0f, 3.0f));
+    const Vec3x8 b = Vec3x8(Vec3f(3.0f, 6.0f, 9.0f));
+
+    EXPECT_EQ(Vec3f(1.0f, 2.0f, 3.0f), a.lerp(b, -1.0f).lane(5));
+    EXPECT_EQ(Vec3f(2.0f, 4.0f, 6.0f), a.lerp(b, 0.5f).lane(5));
+    EXPECT_EQ(Vec3f(3.0f, 6.0f, 9.0f), a.lerp(b, 2.0f).lane(5));
+}
+
+TEST (Vec3Wide_Test, Gather_Scatter_Tail) {
+    sge::Random r(4);
+    const std::vector<Vec3f> src = randomVec3s(r, 11);
+    std::vector<Vec3f> dst(11);
+
+    for (size_t i = 0; i < src.size(); i += 8) {
+        Vec3x8::gather(src, i).scatter(dst, i);
+    }
+    EXPECT_EQ(src, dst);
+
+    // Lanes past the end are zero.
+    const Vec3x8 tail = Vec3x8::gather(src, 8);
+    EXPECT_EQ(src[10], tail.lane(2));
+    EXPECT_EQ(Vec3f_Zero, tail.lane(3));
+    EXPECT_EQ(Vec3f_Zero, tail.lane(7));
+}
+
+TEST (Vec3Wide_Test, Gather_Scatter_Indexed) {
+    sge::Random r(6);
+    std::vector<Vec3f> v = randomVec3s(r, 16);
+    const std::vector<Vec3f> orig = v;
+    const u32 indices[] = {15, 3, 8, 0};
+
+    Vec3x4 w = Vec3x4::gatherIndexed(v, indices);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(orig[indices[i]], w.lane(i));
+    }
+
+    (-w).scatterIndexed(v, indices, 3);
+    for (u32 k = 0; k < 16; ++k) {
+        if (k == 15 || k == 3 || k == 8) {
+            EXPECT_EQ(-orig[k], v[k]);
+        } else {
+            EXPECT_EQ(orig[k], v[k]);
+        }
+    }
+}
+
+TEST (Vec3Wide_Test, Gather_Strided) {
+    std::vector<sge::Vertex> verts;
+    for (int k = 0; k < 5; ++k) {
+        const float f = static_cast<float>(k);
+        verts.emplace_back(f, f + 1.0f, f + 2.0f, 0, 0, 1, 0, 0, 0, 0, 0, 0);
+    }
+    const StridedSpan<Vec3f> positions(&verts[0].position, verts.size(), sizeof(sge::Vertex));
+
+    const Vec3x4 w = Vec3x4::gather(positions, 1);
+    EXPECT_EQ(Vec3f(1.0f, 2.0f, 3.0f), w.lane(0));
+    EXPECT_EQ(Vec3f(4.0f, 5.0f, 6.0f), w.lane(3));
+
+    // Scatter leaves the other Vertex members alone.
+    (w * 2.0f).scatter(positions, 0);
+    EXPECT_EQ(Vec3f(2.0f, 4.0f, 6.0f), verts[0].position);
+    EXPECT_EQ(Vec3f(8.0f, 10.0f, 12.0f), verts[3].position);
+    EXPECT_EQ(Vec3f(4.0f, 5.0f, 6.0f), verts[4].position);
+    EXPECT_EQ(Vec3f_Z, verts[2].normal);
+}
+
+TEST (Floatx_Test, Masks) {
+    const Floatx4 a = Floatx4(1.0f, 2.0f, 3.0f, 4.0f);
+    const Floatx4 b = Floatx4(2.5f);
+
+    EXPECT_EQ(0x3, cmpLt(a, b).movemask());
+    EXPECT_EQ(0xC, cmpGe(a, b).movemask());
+    EXPECT_EQ(0x0, cmpEq(a, b).movemask());
+
+    const Floatx4 s = select(cmpLt(a, b), a, b);
+    EXPECT_FLOAT_EQ(1.0f, s[0]);
+    EXPECT_FLOAT_EQ(2.5f, s[3]);
+
+    const Floatx8 c = Floatx8(a, b);
+    EXPECT_EQ(0xFC, cmpGt(c, Floatx8(2.0f)).movemask());
+    EXPECT_EQ(0xF3, cmpLe(c, Floatx8(2.5f)).movemask());
+}
@@ -0,0 +1,67 @@
+//
+// MappedFile Tests
+//
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include "lib.h"
+
+static std::string writeTempFile (const std::string &contents) {
+    const std::string name = ::testing::TempDir() + "sge_mappedfile_test.txt";
+    FILE *file = fopen(name.c_str(), "wb");
+    if (file) {
+        fwrite(contents.data(), 1, contents.size(), file);
+        fclose(file);
+    }
+    return name;
+}
+
+TEST (MappedFile_Test, Maps_Contents) {
+    const std::string contents = "v 1 2 3\nf 1 2 3\n";
+    const std::string name = writeTempFile(contents);
+
+    sge::MappedFile file(name.c_str());
+    ASSERT_TRUE(file.isOpen());
+    ASSERT_EQ(contents.size(), file.size());
+    EXPECT_EQ(contents, std::string(file.data(), file.size()));
+
+    remove(name.c_str());
+}
+
+TEST (MappedFile_Test, Empty_File) {
+    const std::string name = writeTempFile("");
+
+    sge::MappedFile file(name.c_str());
+    EXPECT_TRUE(file.isOpen());
+    EXPECT_EQ(0u, file.size());
+
+    remove(name.c_str());
+}
+
+TEST (MappedFile_Test, Missing_File) {
+    sge::MappedFile file("no/such/file.obj");
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(0u, file.size());
+}
+
+TEST (MappedFile_Test, Move) {
+    const std::string name = writeTempFile("abc");
+
+    sge::MappedFile a(name.c_str());
+    sge::MappedFile b(std::move(a));
+    EXPECT_FALSE(a.isOpen());
+    ASSERT_TRUE(b.isOpen());
+    EXPECT_EQ("abc", std::string(b.data(), b.size()));
+
+    sge::MappedFile c;
+    c = std::move(b);
+    EXPECT_FALSE(b.isOpen());
+    ASSERT_TRUE(c.isOpen());
+    EXPECT_EQ('a', c.data()[0]);
+
+    c.close();
+    EXPECT_FALSE(c.isOpen());
+
+    remove(name.c_str());
+}
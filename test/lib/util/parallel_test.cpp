@@ -0,0 +1,34 @@
+//
+// Parallel Helper Tests
+//
+#include <gtest/gtest.h>
+#include <vector>
+#include "lib.h"
+
+TEST (Parallel_Test, Visits_Each_Index_Once) {
+    for (size_t count : {0, 1, 7, 100, 1001}) {
+        std::vector<int> visits(count, 0);
+
+        sge::parallelFor(count, 10, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                ++visits[i];
+            }
+        });
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(1, visits[i]);
+        }
+    }
+}
+
+TEST (Parallel_Test, Small_Range_Runs_Inline) {
+    int calls = 0;
+
+    sge::parallelFor(8, 8, [&](const size_t begin, const size_t end) {
+        ++calls;
+        EXPECT_EQ(0u, begin);
+        EXPECT_EQ(8u, end);
+    });
+
+    EXPECT_EQ(1, calls);
+}
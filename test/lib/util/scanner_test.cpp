@@ -0,0 +1,201 @@
+//
+// Scanner Tests
+//
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "lib.h"
+
+static float parse (const char *text, size_t *used = nullptr) {
+    float f = -12345.0f;
+    const char *end = text + strlen(text);
+    const char *next = sge::parseFloat(text, end, f);
+    if (used) {
+        *used = next ? static_cast<size_t>(next - text) : 0;
+    }
+    return f;
+}
+
+TEST (Scanner_Test, Parse_Float_Matches_Strtof) {
+    const char *cases[] = {
+        "0", "-0", "1", "-1", "+2.5", "3.14159265", "0.1", "1e10", "1E-10", "-7.5e+3",
+        "0.000123456", "123456789", ".5", "5.", "1.17549435e-38", "3.4028234e38",
+        "0.30000000000000004", "16777217", "9007199254740993", "123456789012345678901234",
+        "0.0000000000000000000000000001", "2.2250738585072014e-308", "1e-50", "1e50",
+        "-0.7071067811865476", "1.000000059604644775390625"
+    };
+    for (const char *text : cases) {
+        size_t used = 0;
+        const float f = parse(text, &used);
+        EXPECT_EQ(strlen(text), used) << text;
+        EXPECT_EQ(strtof(text, nullptr), f) << text;
+    }
+}
+
+TEST (Scanner_Test, Parse_Float_Random_Values) {
+    sge::Random r(3);
+    char text[64];
+    for (u32 k = 0; k < 10000; ++k) {
+        const float value = r.nextFloat(-1000.0f, 1000.0f);
+        snprintf(text, sizeof(text), "%.6f", value);
+        EXPECT_EQ(strtof(text, nullptr), parse(text)) << text;
+        snprintf(text, sizeof(text), "%.9g", value);
+        EXPECT_EQ(strtof(text, nullptr), parse(text)) << text;
+    }
+}
+
+TEST (Scanner_Test, Parse_Float_Halfway_Between_Floats) {
+    // Just above 1 + 2^-24, halfway between 1 and the next float, so a
+    // double rounded to float would tie back to 1.
+    EXPECT_EQ(strtof("1.00000005960464478", nullptr), parse("1.00000005960464478"));
+    EXPECT_EQ(strtof("1.000000059604645", nullptr), parse("1.000000059604645"));
+    EXPECT_EQ(strtof("1.000000059604644", nullptr), parse("1.000000059604644"));
+
+    // Halfway points of random floats, written with 16 and 17 significant
+    // digits, so some parse to exactly halfway as a double and others to
+    // either side of it.
+    sge::Random r(7);
+    char text[64];
+    for (u32 k = 0; k < 10000; ++k) {
+        const float value = r.nextFloat(-1000.0f, 1000.0f);
+        const double halfway = (static_cast<double>(value) +
+                                static_cast<double>(std::nextafter(value, 2000.0f))) * 0.5;
+        snprintf(text, sizeof(text), "%.15e", halfway);
+        EXPECT_EQ(strtof(text, nullptr), parse(text)) << text;
+        snprintf(text, sizeof(text), "%.16e", halfway);
+        EXPECT_EQ(strtof(text, nullptr), parse(text)) << text;
+    }
+}
+
+TEST (Scanner_Test, Parse_Float_Special_Values) {
+    EXPECT_TRUE(std::isinf(parse("inf")));
+    EXPECT_TRUE(std::isinf(parse("-inf")));
+    EXPECT_TRUE(std::isnan(parse("nan")));
+    EXPECT_TRUE(std::signbit(parse("-0.0")));
+}
+
+TEST (Scanner_Test, Parse_Float_Stops_At_Non_Number) {
+    size_t used = 0;
+    EXPECT_EQ(1.5f, parse("1.5/2", &used));
+    EXPECT_EQ(3u, used);
+    EXPECT_EQ(2.0f, parse("2e", &used));
+    EXPECT_EQ(1u, used);
+    EXPECT_EQ(2.0f, parse("2e+x", &used));
+    EXPECT_EQ(1u, used);
+
+    float f = 0.0f;
+    const char *text = "x1";
+    EXPECT_EQ(nullptr, sge::parseFloat(text, text + 2, f));
+    text = "-.";
+    EXPECT_EQ(nullptr, sge::parseFloat(text, text + 2, f));
+    EXPECT_EQ(nullptr, sge::parseFloat(text, text, f));
+
+    // Leading space isn't part of a number, whatever strtof accepts.
+    text = "\n 5.5";
+    EXPECT_EQ(nullptr, sge::parseFloat(text, text + 5, f));
+    text = " 0.5";
+    EXPECT_EQ(nullptr, sge::parseFloat(text, text + 4, f));
+    text = "-\tinf";
+    EXPECT_EQ(nullptr, sge::parseFloat(text, text + 5, f));
+}
+
+TEST (Scanner_Test, Parse_Float_Respects_End) {
+    const char *text = "12345";
+    float f = 0.0f;
+    EXPECT_EQ(text + 3, sge::parseFloat(text, text + 3, f));
+    EXPECT_EQ(123.0f, f);
+}
+
+TEST (Scanner_Test, Parse_Int) {
+    s32 i = 0;
+    const char *text = "-42/7";
+    EXPECT_EQ(text + 3, sge::parseInt(text, text + 5, i));
+    EXPECT_EQ(-42, i);
+
+    text = "2147483647";
+    EXPECT_NE(nullptr, sge::parseInt(text, text + strlen(text), i));
+    EXPECT_EQ(2147483647, i);
+    text = "-2147483648";
+    EXPECT_NE(nullptr, sge::parseInt(text, text + strlen(text), i));
+    EXPECT_EQ(-2147483647 - 1, i);
+
+    text = "2147483648";
+    EXPECT_EQ(nullptr, sge::parseInt(text, text + strlen(text), i));
+    text = "-";
+    EXPECT_EQ(nullptr, sge::parseInt(text, text + 1, i));
+}
+
+TEST (Scanner_Test, Read_Float_Stops_At_End_Of_Line) {
+    const std::string text = "1 2\n 3.5\n";
+    sge::Scanner s(text.data(), text.data() + text.size());
+
+    float f = 0.0f;
+    EXPECT_TRUE(s.readFloat(f));
+    EXPECT_TRUE(s.readFloat(f));
+    EXPECT_EQ(2.0f, f);
+    const char *before = s.position();
+    EXPECT_FALSE(s.readFloat(f));
+    EXPECT_EQ(before, s.position());
+    EXPECT_EQ(2.0f, f);
+    EXPECT_TRUE(s.atEndOfLine());
+
+    s.skipLine();
+    EXPECT_TRUE(s.readFloat(f));
+    EXPECT_EQ(3.5f, f);
+}
+
+TEST (Scanner_Test, Reads_Lines) {
+    const std::string text = "v 1 2.5 -3\r\n\n  # comment\nf 1/2/3 4//6\ng  name with spaces  \nlast";
+    sge::Scanner s(text.data(), text.data() + text.size());
+
+    const char *word;
+    ASSERT_EQ(1u, s.readWord(word));
+    EXPECT_EQ('v', word[0]);
+    float x, y, z;
+    EXPECT_TRUE(s.readFloat(x));
+    EXPECT_TRUE(s.readFloat(y));
+    EXPECT_TRUE(s.readFloat(z));
+    EXPECT_FALSE(s.readFloat(x));
+    EXPECT_EQ(1.0f, x);
+    EXPECT_EQ(2.5f, y);
+    EXPECT_EQ(-3.0f, z);
+    s.skipSpace();
+    EXPECT_TRUE(s.atEndOfLine());
+    s.skipLine();
+
+    EXPECT_EQ(0u, s.readWord(word));
+    s.skipLine();
+    ASSERT_EQ(1u, s.readWord(word));
+    EXPECT_EQ('#', word[0]);
+    s.skipLine();
+
+    ASSERT_EQ(1u, s.readWord(word));
+    s32 i;
+    EXPECT_TRUE(s.readInt(i));
+    EXPECT_EQ(1, i);
+    EXPECT_TRUE(s.match('/'));
+    EXPECT_TRUE(s.readInt(i));
+    EXPECT_TRUE(s.match('/'));
+    EXPECT_TRUE(s.readInt(i));
+    EXPECT_EQ(3, i);
+    EXPECT_TRUE(s.readInt(i));
+    EXPECT_TRUE(s.match('/'));
+    EXPECT_TRUE(s.match('/'));
+    EXPECT_FALSE(s.match('/'));
+    EXPECT_TRUE(s.readInt(i));
+    EXPECT_EQ(6, i);
+    s.skipLine();
+
+    ASSERT_EQ(1u, s.readWord(word));
+    const size_t len = s.readRest(word);
+    EXPECT_EQ("name with spaces", std::string(word, len));
+    s.skipLine();
+
+    EXPECT_EQ(4u, s.readWord(word));
+    EXPECT_TRUE(s.atEndOfLine());
+    EXPECT_EQ('\0', s.peek());
+    s.skipLine();
+    EXPECT_TRUE(s.atEnd());
+}
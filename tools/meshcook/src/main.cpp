@@ -0,0 +1,78 @@
+//
+// sge-meshcook: Convert .obj files to mesh caches.
+//
+// Usage: sge-meshcook [-l ratio,ratio,...] [-s] file.obj...
+//
+// Writes file.obj.sgemesh next to each file, as the engine would cook it
+// on first load. -l sets the levels of detail, e.g. -l 0.5,0.25; -l ""
+// writes the full mesh only. -s parses on one thread.
+//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#include "lib.h"
+
+using namespace sge;
+
+static void usage () {
+    fprintf(stderr, "Usage: sge-meshcook [-l ratio,ratio,...] [-s] file.obj...\n");
+}
+
+static bool parseRatios (const char *text, std::vector<float> &ratios) {
+    ratios.clear();
+    const char *end = text + strlen(text);
+    for (const char *p = text; p < end; ) {
+        float ratio;
+        p = parseFloat(p, end, ratio);
+        if (!p || ratio <= 0.0f || ratio > 1.0f) {
+            return false;
+        }
+        if (p < end && *p++ != ',') {
+            return false;
+        }
+        ratios.push_back(ratio);
+    }
+    return true;
+}
+
+int main (int argc, char **argv) {
+    std::vector<float> ratios(std::begin(kDefaultCookLodRatios), std::end(kDefaultCookLodRatios));
+    bool threaded = true;
+    int cooked = 0;
+    int failed = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            if (!parseRatios(argv[++i], ratios)) {
+                fprintf(stderr, "Bad level of detail ratios -- %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        } else if (strcmp(argv[i], "-s") == 0) {
+            threaded = false;
+        } else if (argv[i][0] == '-') {
+            usage();
+            return EXIT_FAILURE;
+        } else {
+            const std::string cachePath = meshCachePath(argv[i]);
+            const u64 start = Clock::millisTime();
+            if (cookObjMesh(argv[i], cachePath.c_str(), ratios, threaded)) {
+                const MeshCache cache(cachePath.c_str());
+                printf("%s: %u vertices, %u levels, %llu ms\n", cachePath.c_str(),
+                       cache.isValid() ? cache.lod(0).vertexCount : 0, cache.lodCount(),
+                       static_cast<unsigned long long>(Clock::millisTime() - start));
+                ++cooked;
+            } else {
+                ++failed;
+            }
+        }
+    }
+
+    if (cooked + failed == 0) {
+        usage();
+        return EXIT_FAILURE;
+    }
+    return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}